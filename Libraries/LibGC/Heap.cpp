@@ -244,9 +244,14 @@ void Heap::collect_garbage(CollectionType collection_type, bool print_report)
     {
         TemporaryChange change(m_collecting_garbage, true);
 
-        Core::ElapsedTimer collection_measurement_timer;
-        if (print_report)
-            collection_measurement_timer.start();
+        auto collection_measurement_timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+
+        PhaseTimes phase_times;
+        auto phase_timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+        auto finish_phase = [&phase_timer](AK::Duration& phase_time) {
+            phase_time = phase_timer.elapsed_time();
+            phase_timer.start();
+        };
 
         if (collection_type == CollectionType::CollectGarbage) {
             if (m_gc_deferrals) {
@@ -255,10 +260,14 @@ void Heap::collect_garbage(CollectionType collection_type, bool print_report)
             }
             HashMap<Cell*, HeapRoot> roots;
             gather_roots(roots);
+            finish_phase(phase_times.gather_roots);
             mark_live_cells(roots);
+            finish_phase(phase_times.mark_live_cells);
         }
         finalize_unmarked_cells();
-        sweep_dead_cells(print_report, collection_measurement_timer);
+        finish_phase(phase_times.finalize_unmarked_cells);
+        sweep_dead_cells(print_report, collection_measurement_timer, phase_times);
+        record_pause(collection_type, collection_measurement_timer.elapsed_time(), print_report);
     }
 
     auto tasks = move(m_post_gc_tasks);
@@ -266,6 +275,29 @@ void Heap::collect_garbage(CollectionType collection_type, bool print_report)
         task();
 }
 
+void Heap::record_pause(CollectionType collection_type, AK::Duration pause_time, bool print_report)
+{
+    auto& statistics = m_pause_statistics[to_underlying(collection_type)];
+    ++statistics.collection_count;
+    statistics.total_pause_time += pause_time;
+    if (pause_time > statistics.longest_pause_time)
+        statistics.longest_pause_time = pause_time;
+
+    if (!print_report)
+        return;
+
+    auto report_pauses = [](StringView name, PauseStatistics const& statistics) {
+        auto average_pause_ms = statistics.collection_count ? statistics.total_pause_time.to_milliseconds() / static_cast<i64>(statistics.collection_count) : 0;
+        dbgln("{:>15}: {} collections, {} ms total, {} ms average, {} ms longest", name, statistics.collection_count, statistics.total_pause_time.to_milliseconds(), average_pause_ms, statistics.longest_pause_time.to_milliseconds());
+    };
+
+    dbgln("Garbage collection pauses");
+    dbgln("=============================================");
+    report_pauses("Regular"sv, m_pause_statistics[to_underlying(CollectionType::CollectGarbage)]);
+    report_pauses("Full"sv, m_pause_statistics[to_underlying(CollectionType::CollectEverything)]);
+    dbgln("=============================================");
+}
+
 void Heap::enqueue_post_gc_task(AK::Function<void()> task)
 {
     m_post_gc_tasks.append(move(task));
@@ -462,7 +494,7 @@ void Heap::finalize_unmarked_cells()
     });
 }
 
-void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measurement_timer)
+void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measurement_timer, PhaseTimes const& phase_times)
 {
     dbgln_if(HEAP_DEBUG, "sweep_dead_cells:");
     Vector<HeapBlock*, 32> empty_blocks;
@@ -526,9 +558,16 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
             return IterationDecision::Continue;
         });
 
+        auto sweep_time = time_spent - phase_times.gather_roots - phase_times.mark_live_cells - phase_times.finalize_unmarked_cells;
+        auto as_milliseconds = [](AK::Duration duration) { return static_cast<double>(duration.to_microseconds()) / 1000.0; };
+
         dbgln("Garbage collection report");
         dbgln("=============================================");
         dbgln("     Time spent: {} ms", time_spent.to_milliseconds());
+        dbgln("   Gather roots: {:.3} ms", as_milliseconds(phase_times.gather_roots));
+        dbgln("        Marking: {:.3} ms", as_milliseconds(phase_times.mark_live_cells));
+        dbgln("     Finalizing: {:.3} ms", as_milliseconds(phase_times.finalize_unmarked_cells));
+        dbgln("       Sweeping: {:.3} ms", as_milliseconds(sweep_time));
         dbgln("     Live cells: {} ({} bytes)", live_cells, live_cell_bytes);
         dbgln("Collected cells: {} ({} bytes)", collected_cells, collected_cell_bytes);
         dbgln("    Live blocks: {} ({} bytes)", live_block_count, live_block_count * HeapBlock::block_size);
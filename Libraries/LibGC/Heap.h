@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/Badge.h>
 #include <AK/Function.h>
 #include <AK/HashTable.h>
@@ -13,7 +14,9 @@
 #include <AK/Noncopyable.h>
 #include <AK/NonnullOwnPtr.h>
 #include <AK/StackInfo.h>
+#include <AK/StdLibExtras.h>
 #include <AK/Swift.h>
+#include <AK/Time.h>
 #include <AK/Types.h>
 #include <AK/Vector.h>
 #include <LibCore/Forward.h>
@@ -54,6 +57,14 @@ public:
     };
 
     void collect_garbage(CollectionType = CollectionType::CollectGarbage, bool print_report = false);
+
+    struct PauseStatistics {
+        size_t collection_count { 0 };
+        AK::Duration total_pause_time;
+        AK::Duration longest_pause_time;
+    };
+    PauseStatistics const& pause_statistics(CollectionType type) const { return m_pause_statistics[to_underlying(type)]; }
+
     AK::JsonObject dump_graph();
 
     bool should_collect_on_every_allocation() const { return m_should_collect_on_every_allocation; }
@@ -113,7 +124,14 @@ private:
     void gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>&, FlatPtr, FlatPtr min_block_address, FlatPtr max_block_address);
     void mark_live_cells(HashMap<Cell*, HeapRoot> const& live_cells);
     void finalize_unmarked_cells();
-    void sweep_dead_cells(bool print_report, Core::ElapsedTimer const&);
+
+    struct PhaseTimes {
+        AK::Duration gather_roots;
+        AK::Duration mark_live_cells;
+        AK::Duration finalize_unmarked_cells;
+    };
+    void sweep_dead_cells(bool print_report, Core::ElapsedTimer const&, PhaseTimes const&);
+    void record_pause(CollectionType, AK::Duration, bool print_report);
 
     ALWAYS_INLINE CellAllocator& allocator_for_size(size_t cell_size)
     {
@@ -156,6 +174,7 @@ private:
     bool m_should_gc_when_deferral_ends { false };
 
     bool m_collecting_garbage { false };
+    Array<PauseStatistics, 2> m_pause_statistics;
     StackInfo m_stack_info;
     AK::Function<void(HashMap<Cell*, GC::HeapRoot>&)> m_gather_embedder_roots;
 
@@ -7,12 +7,185 @@
  */
 
 #include "TextLayout.h"
+#include <AK/ByteString.h>
+#include <AK/HashMap.h>
+#include <AK/IntrusiveList.h>
 #include <AK/TypeCasts.h>
 #include <LibGfx/Point.h>
 #include <harfbuzz/hb.h>
 
 namespace Gfx {
 
+struct ShapingCacheKey {
+    Font const* font { nullptr };
+    StringView text;
+    ReadonlySpan<ShapeFeature> features;
+
+    [[nodiscard]] u32 hash() const
+    {
+        auto hash = pair_int_hash(ptr_hash(font), text.hash());
+        for (auto const& feature : features)
+            hash = pair_int_hash(hash, pair_int_hash(string_hash(feature.tag, sizeof(feature.tag)), feature.value));
+        return hash;
+    }
+};
+
+struct OwnShapingCacheKey {
+    explicit OwnShapingCacheKey(ShapingCacheKey const& other)
+        : font(*other.font)
+        , text(other.text)
+        , features(other.features)
+    {
+    }
+
+    operator ShapingCacheKey() const { return { font.ptr(), text.view(), features.span() }; }
+
+    [[nodiscard]] u32 hash() const { return static_cast<ShapingCacheKey>(*this).hash(); }
+    [[nodiscard]] bool operator==(OwnShapingCacheKey const& other) const = default;
+    [[nodiscard]] bool operator==(ShapingCacheKey const& other) const
+    {
+        return font.ptr() == other.font && text == other.text && features.span() == other.features;
+    }
+
+    // NOTE: Holding on to the font keeps its address from being reused by another font while the entry is alive.
+    NonnullRefPtr<Font const> font;
+    ByteString text;
+    ShapeFeatures features;
+};
+
+}
+
+namespace AK {
+
+namespace Detail {
+template<>
+inline constexpr bool IsHashCompatible<Gfx::ShapingCacheKey, Gfx::OwnShapingCacheKey> = true;
+template<>
+inline constexpr bool IsHashCompatible<Gfx::OwnShapingCacheKey, Gfx::ShapingCacheKey> = true;
+}
+
+template<>
+struct Traits<Gfx::ShapingCacheKey> : public DefaultTraits<Gfx::ShapingCacheKey> {
+    static unsigned hash(Gfx::ShapingCacheKey const& key) { return key.hash(); }
+};
+
+template<>
+struct Traits<Gfx::OwnShapingCacheKey> : public DefaultTraits<Gfx::OwnShapingCacheKey> {
+    static unsigned hash(Gfx::OwnShapingCacheKey const& key) { return key.hash(); }
+};
+
+}
+
+namespace Gfx {
+
+// The output of HarfBuzz for one glyph, in pixels.
+struct ShapedGlyph {
+    u32 glyph_id { 0 };
+    FloatPoint offset;
+    FloatPoint advance;
+};
+
+// A bounded cache of shaped text, evicting the least recently used entry once full.
+class ShapingCache {
+public:
+    static constexpr size_t maximum_entry_count = 16384;
+
+    // NOTE: Text is mostly shaped a word or a short chunk at a time. Longer strings are rarely shaped twice, and would
+    //       only push more useful entries out of the cache.
+    static constexpr size_t maximum_text_length = 256;
+
+    static ShapingCache& the()
+    {
+        static ShapingCache cache;
+        return cache;
+    }
+
+    Vector<ShapedGlyph> const* get(ShapingCacheKey const& key)
+    {
+        auto entry = m_entries.get(key);
+        if (!entry.has_value()) {
+            ++m_statistics.misses;
+            return nullptr;
+        }
+        ++m_statistics.hits;
+        m_lru_list.remove(**entry);
+        m_lru_list.prepend(**entry);
+        return &(*entry)->glyphs;
+    }
+
+    Vector<ShapedGlyph> const& set(ShapingCacheKey const& key, Vector<ShapedGlyph> glyphs)
+    {
+        while (m_entries.size() >= maximum_entry_count) {
+            auto* least_recently_used = m_lru_list.take_last();
+            m_entries.remove(static_cast<ShapingCacheKey>(least_recently_used->key));
+            ++m_statistics.evictions;
+        }
+
+        auto entry = make<Entry>(OwnShapingCacheKey { key }, move(glyphs));
+        auto& glyphs_in_entry = entry->glyphs;
+        m_lru_list.prepend(*entry);
+        m_entries.set(OwnShapingCacheKey { key }, move(entry));
+        return glyphs_in_entry;
+    }
+
+    bool is_enabled() const { return m_enabled; }
+    void set_enabled(bool enabled)
+    {
+        m_enabled = enabled;
+        if (!enabled)
+            clear();
+    }
+
+    void clear()
+    {
+        m_lru_list.clear();
+        m_entries.clear();
+        m_statistics = {};
+    }
+
+    ShapingCacheStatistics statistics() const
+    {
+        auto statistics = m_statistics;
+        statistics.entry_count = m_entries.size();
+        return statistics;
+    }
+
+private:
+    struct Entry {
+        Entry(OwnShapingCacheKey key, Vector<ShapedGlyph> glyphs)
+            : key(move(key))
+            , glyphs(move(glyphs))
+        {
+        }
+
+        OwnShapingCacheKey key;
+        Vector<ShapedGlyph> glyphs;
+        IntrusiveListNode<Entry> list_node;
+
+        using List = IntrusiveList<&Entry::list_node>;
+    };
+
+    HashMap<OwnShapingCacheKey, NonnullOwnPtr<Entry>> m_entries;
+    Entry::List m_lru_list;
+    ShapingCacheStatistics m_statistics;
+    bool m_enabled { true };
+};
+
+ShapingCacheStatistics shaping_cache_statistics()
+{
+    return ShapingCache::the().statistics();
+}
+
+void clear_shaping_cache()
+{
+    ShapingCache::the().clear();
+}
+
+void set_shaping_cache_enabled(bool enabled)
+{
+    ShapingCache::the().set_enabled(enabled);
+}
+
 Vector<NonnullRefPtr<GlyphRun>> shape_text(FloatPoint baseline_start, Utf8View string, FontCascadeList const& font_cascade_list)
 {
     if (string.length() == 0)
@@ -52,16 +225,12 @@ Vector<NonnullRefPtr<GlyphRun>> shape_text(FloatPoint baseline_start, Utf8View s
     return runs;
 }
 
-RefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spacing, Utf8View string, Gfx::Font const& font, GlyphRun::TextType text_type, ShapeFeatures const& features)
+static Vector<ShapedGlyph> shape_with_harfbuzz(Utf8View string, Gfx::Font const& font, ShapeFeatures const& features)
 {
     static hb_buffer_t* buffer = hb_buffer_create();
     hb_buffer_add_utf8(buffer, reinterpret_cast<char const*>(string.bytes()), string.byte_length(), 0, -1);
     hb_buffer_guess_segment_properties(buffer);
 
-    u32 glyph_count;
-    auto* glyph_info = hb_buffer_get_glyph_infos(buffer, &glyph_count);
-    Vector<hb_glyph_info_t> const input_glyph_info({ glyph_info, glyph_count });
-
     auto* hb_font = font.harfbuzz_font();
     hb_feature_t const* hb_features_data = nullptr;
     Vector<hb_feature_t> hb_features;
@@ -80,28 +249,58 @@ RefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spacing, Utf
 
     hb_shape(hb_font, buffer, hb_features_data, features.size());
 
-    glyph_info = hb_buffer_get_glyph_infos(buffer, &glyph_count);
+    u32 glyph_count;
+    auto* glyph_info = hb_buffer_get_glyph_infos(buffer, &glyph_count);
     auto* positions = hb_buffer_get_glyph_positions(buffer, &glyph_count);
 
+    Vector<ShapedGlyph> shaped_glyphs;
+    shaped_glyphs.ensure_capacity(glyph_count);
+    for (size_t i = 0; i < glyph_count; ++i) {
+        shaped_glyphs.unchecked_append({
+            .glyph_id = glyph_info[i].codepoint,
+            .offset = FloatPoint { positions[i].x_offset, positions[i].y_offset } / text_shaping_resolution,
+            .advance = FloatPoint { positions[i].x_advance, positions[i].y_advance } / text_shaping_resolution,
+        });
+    }
+
+    hb_buffer_reset(buffer);
+    return shaped_glyphs;
+}
+
+RefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spacing, Utf8View string, Gfx::Font const& font, GlyphRun::TextType text_type, ShapeFeatures const& features)
+{
+    Vector<ShapedGlyph> uncached_glyphs;
+    Vector<ShapedGlyph> const* shaped_glyphs = nullptr;
+
+    if (auto& cache = ShapingCache::the(); cache.is_enabled() && string.byte_length() <= ShapingCache::maximum_text_length) {
+        ShapingCacheKey key { &font, string.as_string(), features.span() };
+        shaped_glyphs = cache.get(key);
+        if (!shaped_glyphs)
+            shaped_glyphs = &cache.set(key, shape_with_harfbuzz(string, font, features));
+    } else {
+        uncached_glyphs = shape_with_harfbuzz(string, font, features);
+        shaped_glyphs = &uncached_glyphs;
+    }
+
     Vector<Gfx::DrawGlyph> glyph_run;
+    glyph_run.ensure_capacity(shaped_glyphs->size());
     FloatPoint point = baseline_start;
-    for (size_t i = 0; i < glyph_count; ++i) {
+    for (size_t i = 0; i < shaped_glyphs->size(); ++i) {
+        auto const& shaped_glyph = shaped_glyphs->at(i);
 
         auto position = point
             - FloatPoint { 0, font.pixel_metrics().ascent }
-            + FloatPoint { positions[i].x_offset, positions[i].y_offset } / text_shaping_resolution;
-        glyph_run.append({ position, glyph_info[i].codepoint });
-        point += FloatPoint { positions[i].x_advance, positions[i].y_advance } / text_shaping_resolution;
+            + shaped_glyph.offset;
+        glyph_run.unchecked_append({ position, shaped_glyph.glyph_id });
+        point += shaped_glyph.advance;
 
         // don't apply spacing to last glyph
         // https://drafts.csswg.org/css-text/#example-7880704e
-        if (i != (glyph_count - 1))
+        if (i != (shaped_glyphs->size() - 1))
             point.translate_by(letter_spacing, 0);
     }
 
-    auto run = adopt_ref(*new Gfx::GlyphRun(move(glyph_run), font, text_type, point.x() - baseline_start.x()));
-    hb_buffer_reset(buffer);
-    return run;
+    return adopt_ref(*new Gfx::GlyphRun(move(glyph_run), font, text_type, point.x() - baseline_start.x()));
 }
 
 float measure_text_width(Utf8View const& string, Gfx::Font const& font, ShapeFeatures const& features)
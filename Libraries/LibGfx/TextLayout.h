@@ -32,6 +32,8 @@ struct DrawGlyph {
 typedef struct ShapeFeature {
     char tag[4];
     u32 value;
+
+    bool operator==(ShapeFeature const&) const = default;
 } ShapeFeature;
 
 using ShapeFeatures = Vector<ShapeFeature, 4>;
@@ -74,4 +76,20 @@ RefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spacing, Utf
 Vector<NonnullRefPtr<GlyphRun>> shape_text(FloatPoint baseline_start, Utf8View string, FontCascadeList const&);
 float measure_text_width(Utf8View const& string, Gfx::Font const& font, ShapeFeatures const& features);
 
+// Shaping results are cached per (font, text, features), independently of where and with what letter spacing the
+// text is placed. The cache is shared by everything that shapes text in this process.
+struct ShapingCacheStatistics {
+    u64 hits { 0 };
+    u64 misses { 0 };
+    u64 evictions { 0 };
+    size_t entry_count { 0 };
+
+    float hit_rate() const { return hits + misses == 0 ? 0 : static_cast<float>(hits) / static_cast<float>(hits + misses); }
+};
+ShapingCacheStatistics shaping_cache_statistics();
+void clear_shaping_cache();
+
+// Disabling the cache also clears it. Only meant for measuring what the cache saves.
+void set_shaping_cache_enabled(bool);
+
 }
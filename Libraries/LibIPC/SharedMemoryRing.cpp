@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/BuiltinWrappers.h>
+#include <LibCore/System.h>
+#include <LibIPC/SharedMemoryRing.h>
+
+namespace IPC {
+
+ErrorOr<SharedMemoryRing> SharedMemoryRing::create(size_t capacity)
+{
+    VERIFY(popcount(capacity) == 1);
+
+    auto buffer = TRY(Core::AnonymousBuffer::create_with_size(data_offset + capacity));
+    new (buffer.data<void>()) Header;
+    return SharedMemoryRing { move(buffer), capacity };
+}
+
+ErrorOr<SharedMemoryRing> SharedMemoryRing::attach(int fd, size_t capacity)
+{
+    if (popcount(capacity) != 1) {
+        (void)Core::System::close(fd);
+        return Error::from_string_literal("Shared memory ring capacity is not a power of two");
+    }
+
+    // NOTE: The peer tells us how big the ring is, so make sure it really is that big before mapping all of it.
+    auto stat = Core::System::fstat(fd);
+    if (stat.is_error() || static_cast<size_t>(stat.value().st_size) < data_offset + capacity) {
+        (void)Core::System::close(fd);
+        return Error::from_string_literal("Shared memory ring is smaller than its capacity");
+    }
+
+    auto buffer = TRY(Core::AnonymousBuffer::create_from_anon_fd(fd, data_offset + capacity));
+    return SharedMemoryRing { move(buffer), capacity };
+}
+
+void SharedMemoryRing::copy_in(u64 offset, ReadonlyBytes bytes)
+{
+    if (bytes.is_empty())
+        return;
+    auto index = offset & (m_capacity - 1);
+    auto size_until_end = min(bytes.size(), m_capacity - index);
+    memcpy(data() + index, bytes.data(), size_until_end);
+    if (size_until_end < bytes.size())
+        memcpy(data(), bytes.data() + size_until_end, bytes.size() - size_until_end);
+}
+
+void SharedMemoryRing::copy_out(u64 offset, Bytes bytes)
+{
+    if (bytes.is_empty())
+        return;
+    auto index = offset & (m_capacity - 1);
+    auto size_until_end = min(bytes.size(), m_capacity - index);
+    memcpy(bytes.data(), data() + index, size_until_end);
+    if (size_until_end < bytes.size())
+        memcpy(bytes.data() + size_until_end, data(), bytes.size() - size_until_end);
+}
+
+bool SharedMemoryRing::try_write(u32 sequence_number, ReadonlyBytes bytes)
+{
+    auto record_size = sizeof(RecordHeader) + align_up_to(bytes.size(), sizeof(RecordHeader));
+    if (record_size > m_capacity)
+        return false;
+
+    auto& header = this->header();
+    auto write_offset = header.write_offset.load(AK::MemoryOrder::memory_order_relaxed);
+    auto read_offset = header.read_offset.load(AK::MemoryOrder::memory_order_acquire);
+    auto used = write_offset - read_offset;
+    if (used > m_capacity || m_capacity - used < record_size)
+        return false;
+
+    RecordHeader record_header { .size = static_cast<u32>(bytes.size()), .sequence_number = sequence_number };
+    copy_in(write_offset, { reinterpret_cast<u8 const*>(&record_header), sizeof(record_header) });
+    copy_in(write_offset + sizeof(RecordHeader), bytes);
+
+    // NOTE: This has to be sequentially consistent with the following take_wakeup_request(), so that either the
+    //       consumer sees this record before it goes to sleep, or we see that it went to sleep.
+    header.write_offset.store(write_offset + record_size);
+    return true;
+}
+
+bool SharedMemoryRing::take_wakeup_request()
+{
+    return header().consumer_wants_wakeup.exchange(0) != 0;
+}
+
+ErrorOr<Optional<SharedMemoryRing::Record>> SharedMemoryRing::try_read()
+{
+    auto& header = this->header();
+    auto read_offset = header.read_offset.load(AK::MemoryOrder::memory_order_relaxed);
+    auto write_offset = header.write_offset.load(AK::MemoryOrder::memory_order_acquire);
+    if (read_offset == write_offset)
+        return Optional<Record> {};
+
+    // NOTE: The producer lives in another process, so don't trust anything it wrote.
+    auto available = write_offset - read_offset;
+    if (available < sizeof(RecordHeader) || available > m_capacity)
+        return Error::from_string_literal("Shared memory ring offsets are inconsistent");
+
+    RecordHeader record_header;
+    copy_out(read_offset, { reinterpret_cast<u8*>(&record_header), sizeof(record_header) });
+    auto record_size = sizeof(RecordHeader) + align_up_to(record_header.size, sizeof(RecordHeader));
+    if (record_size > available)
+        return Error::from_string_literal("Shared memory ring record is larger than the ring's contents");
+
+    Record record;
+    record.sequence_number = record_header.sequence_number;
+    TRY(record.bytes.try_resize(record_header.size));
+    copy_out(read_offset + sizeof(RecordHeader), record.bytes);
+
+    header.read_offset.store(read_offset + record_size, AK::MemoryOrder::memory_order_release);
+    return record;
+}
+
+void SharedMemoryRing::request_wakeup()
+{
+    header().consumer_wants_wakeup.store(1);
+}
+
+bool SharedMemoryRing::is_empty() const
+{
+    auto const& header = this->header();
+    return header.read_offset.load(AK::MemoryOrder::memory_order_relaxed) == header.write_offset.load();
+}
+
+}
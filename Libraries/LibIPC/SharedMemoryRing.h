@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/Error.h>
+#include <AK/Optional.h>
+#include <AK/Vector.h>
+#include <LibCore/AnonymousBuffer.h>
+
+namespace IPC {
+
+// A lock-free ring of variable-sized messages in shared memory, with a single producer in one process and a single
+// consumer in another. The ring itself never blocks: the producer finds out whether the consumer has gone to sleep
+// waiting for more messages, and it's up to the owner to wake it up (e.g. through a socket).
+class SharedMemoryRing {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 256 * KiB;
+
+    static ErrorOr<SharedMemoryRing> create(size_t capacity = DEFAULT_CAPACITY);
+    static ErrorOr<SharedMemoryRing> attach(int fd, size_t capacity);
+
+    int fd() const { return m_buffer.fd(); }
+    size_t capacity() const { return m_capacity; }
+
+    // Producer side.
+
+    // Returns false if there isn't enough free space for the message right now.
+    bool try_write(u32 sequence_number, ReadonlyBytes);
+    // Returns whether the consumer asked to be woken up since the last call.
+    bool take_wakeup_request();
+
+    // Consumer side.
+
+    struct Record {
+        u32 sequence_number { 0 };
+        Vector<u8> bytes;
+    };
+    // Returns an empty Optional if the ring is empty, and an error if the producer left it in an inconsistent state.
+    ErrorOr<Optional<Record>> try_read();
+    // Asks the producer to wake us up after its next write.
+    void request_wakeup();
+    bool is_empty() const;
+
+private:
+    struct Header {
+        // Both offsets only ever grow; they're taken modulo the capacity to index into the data.
+        AK_CACHE_ALIGNED Atomic<u64> write_offset { 0 };
+        AK_CACHE_ALIGNED Atomic<u64> read_offset { 0 };
+        AK_CACHE_ALIGNED Atomic<u32> consumer_wants_wakeup { 1 };
+    };
+
+    struct RecordHeader {
+        u32 size { 0 };
+        u32 sequence_number { 0 };
+    };
+
+    static constexpr size_t data_offset = align_up_to(sizeof(Header), AK_SYSTEM_CACHE_ALIGNMENT_SIZE);
+
+    SharedMemoryRing(Core::AnonymousBuffer buffer, size_t capacity)
+        : m_buffer(move(buffer))
+        , m_capacity(capacity)
+    {
+    }
+
+    Header& header() { return *reinterpret_cast<Header*>(m_buffer.data<u8>()); }
+    Header const& header() const { return *reinterpret_cast<Header const*>(m_buffer.data<u8>()); }
+    u8* data() { return m_buffer.data<u8>() + data_offset; }
+
+    void copy_in(u64 offset, ReadonlyBytes);
+    void copy_out(u64 offset, Bytes);
+
+    Core::AnonymousBuffer m_buffer;
+    size_t m_capacity { 0 };
+};
+
+}
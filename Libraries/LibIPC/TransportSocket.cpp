@@ -145,26 +145,26 @@ void TransportSocket::wait_until_readable()
     VERIFY(maybe_did_become_readable.value());
 }
 
-struct MessageHeader {
+struct TransportSocket::MessageHeader {
     enum class Type : u8 {
         Payload = 0,
         FileDescriptorAcknowledgement = 1,
+        SharedMemoryRing = 2,
+        Wakeup = 3,
     };
     Type type { Type::Payload };
     u32 payload_size { 0 };
     u32 fd_count { 0 };
+    // Only set for the types that are delivered in order, i.e. Payload and SharedMemoryRing.
+    u32 sequence_number { 0 };
 };
 
-void TransportSocket::post_message(Vector<u8> const& bytes_to_write, Vector<NonnullRefPtr<AutoCloseFileDescriptor>> const& fds)
+void TransportSocket::enqueue_message_on_socket(MessageHeader const& header, ReadonlyBytes payload, Vector<NonnullRefPtr<AutoCloseFileDescriptor>> const& fds)
 {
     Vector<u8> message_buffer;
-    message_buffer.resize(sizeof(MessageHeader) + bytes_to_write.size());
-    MessageHeader header;
-    header.payload_size = bytes_to_write.size();
-    header.fd_count = fds.size();
-    header.type = MessageHeader::Type::Payload;
+    message_buffer.resize(sizeof(MessageHeader) + payload.size());
     memcpy(message_buffer.data(), &header, sizeof(MessageHeader));
-    memcpy(message_buffer.data() + sizeof(MessageHeader), bytes_to_write.data(), bytes_to_write.size());
+    memcpy(message_buffer.data() + sizeof(MessageHeader), payload.data(), payload.size());
 
     for (auto const& fd : fds)
         m_fds_retained_until_received_by_peer.enqueue(fd);
@@ -181,6 +181,57 @@ void TransportSocket::post_message(Vector<u8> const& bytes_to_write, Vector<Nonn
     m_send_queue->enqueue_message(move(message_buffer), move(raw_fds));
 }
 
+void TransportSocket::post_message(Vector<u8> const& bytes_to_write, Vector<NonnullRefPtr<AutoCloseFileDescriptor>> const& fds)
+{
+    // NOTE: Sequence numbers have to be handed out in the same order as messages are put in the send queue and the ring.
+    Threading::MutexLocker locker(m_send_mutex);
+    auto sequence_number = m_next_outgoing_sequence_number++;
+
+    // OPTIMIZATION: Messages without file descriptors go through shared memory if we've set it up, and only cost a
+    //               syscall when the peer went to sleep and has to be woken up.
+    if (m_outgoing_ring.has_value() && fds.is_empty() && m_outgoing_ring->try_write(sequence_number, bytes_to_write)) {
+        if (m_outgoing_ring->take_wakeup_request())
+            enqueue_message_on_socket({ .type = MessageHeader::Type::Wakeup }, {}, {});
+        return;
+    }
+
+    MessageHeader header;
+    header.payload_size = bytes_to_write.size();
+    header.fd_count = fds.size();
+    header.type = MessageHeader::Type::Payload;
+    header.sequence_number = sequence_number;
+    enqueue_message_on_socket(header, bytes_to_write, fds);
+}
+
+ErrorOr<void> TransportSocket::enable_shared_memory_transport()
+{
+    Threading::MutexLocker locker(m_send_mutex);
+    if (m_outgoing_ring.has_value())
+        return {};
+
+    auto ring = TRY(SharedMemoryRing::create());
+    auto fd = adopt_ref(*new AutoCloseFileDescriptor(TRY(Core::System::dup(ring.fd()))));
+    u32 capacity = ring.capacity();
+
+    // NOTE: This goes through the socket in order with everything else, so the peer starts reading the ring exactly
+    //       when it gets to the messages we put in it.
+    MessageHeader header;
+    header.payload_size = sizeof(capacity);
+    header.fd_count = 1;
+    header.type = MessageHeader::Type::SharedMemoryRing;
+    header.sequence_number = m_next_outgoing_sequence_number++;
+    enqueue_message_on_socket(header, { reinterpret_cast<u8 const*>(&capacity), sizeof(capacity) }, { fd });
+
+    m_outgoing_ring = move(ring);
+    return {};
+}
+
+bool TransportSocket::is_using_shared_memory_transport() const
+{
+    Threading::MutexLocker locker(m_send_mutex);
+    return m_outgoing_ring.has_value();
+}
+
 ErrorOr<void> TransportSocket::send_message(Core::LocalSocket& socket, ReadonlyBytes& bytes_to_write, Vector<int>& unowned_fds)
 {
     auto num_fds_to_transfer = unowned_fds.size();
@@ -250,26 +301,36 @@ TransportSocket::ShouldShutdown TransportSocket::read_as_many_messages_as_possib
     while (index + sizeof(MessageHeader) <= m_unprocessed_bytes.size()) {
         MessageHeader header;
         memcpy(&header, m_unprocessed_bytes.data() + index, sizeof(MessageHeader));
-        if (header.type == MessageHeader::Type::Payload) {
+        if (header.type == MessageHeader::Type::Payload || header.type == MessageHeader::Type::SharedMemoryRing) {
             if (header.payload_size + sizeof(MessageHeader) > m_unprocessed_bytes.size() - index)
                 break;
             if (header.fd_count > m_unprocessed_fds.size())
                 break;
-            Message message;
+            SequencedMessage sequenced_message;
+            sequenced_message.sequence_number = header.sequence_number;
+            sequenced_message.is_shared_memory_ring = header.type == MessageHeader::Type::SharedMemoryRing;
             received_fd_count += header.fd_count;
             for (size_t i = 0; i < header.fd_count; ++i)
-                message.fds.enqueue(m_unprocessed_fds.dequeue());
-            message.bytes.append(m_unprocessed_bytes.data() + index + sizeof(MessageHeader), header.payload_size);
-            callback(move(message));
+                sequenced_message.fds.append(m_unprocessed_fds.dequeue());
+            sequenced_message.bytes.append(m_unprocessed_bytes.data() + index + sizeof(MessageHeader), header.payload_size);
+            m_messages_from_socket.enqueue(move(sequenced_message));
         } else if (header.type == MessageHeader::Type::FileDescriptorAcknowledgement) {
             VERIFY(header.payload_size == 0);
             acknowledged_fd_count += header.fd_count;
+        } else if (header.type == MessageHeader::Type::Wakeup) {
+            // Nothing to do here, the peer just wants us to look at the ring.
+            VERIFY(header.payload_size == 0);
         } else {
             VERIFY_NOT_REACHED();
         }
         index += header.payload_size + sizeof(MessageHeader);
     }
 
+    if (auto result = deliver_messages_in_order(callback); result.is_error()) {
+        dbgln("TransportSocket::read_as_much_as_possible_without_blocking: {}", result.error());
+        should_shutdown = true;
+    }
+
     if (should_shutdown)
         return ShouldShutdown::Yes;
 
@@ -301,14 +362,94 @@ TransportSocket::ShouldShutdown TransportSocket::read_as_many_messages_as_possib
     return ShouldShutdown::No;
 }
 
+ErrorOr<void> TransportSocket::deliver_messages_in_order(Function<void(Message&&)>& callback)
+{
+    auto deliver = [&](SequencedMessage&& sequenced_message) {
+        Message message;
+        message.bytes = move(sequenced_message.bytes);
+        for (auto& fd : sequenced_message.fds)
+            message.fds.enqueue(move(fd));
+        callback(move(message));
+    };
+
+    for (;;) {
+        if (!m_messages_from_socket.is_empty() && m_messages_from_socket.head().sequence_number == m_next_incoming_sequence_number) {
+            auto sequenced_message = m_messages_from_socket.dequeue();
+            ++m_next_incoming_sequence_number;
+            if (sequenced_message.is_shared_memory_ring)
+                TRY(attach_incoming_ring(move(sequenced_message)));
+            else
+                deliver(move(sequenced_message));
+            continue;
+        }
+
+        if (!m_messages_from_ring.is_empty() && m_messages_from_ring.head().sequence_number == m_next_incoming_sequence_number) {
+            ++m_next_incoming_sequence_number;
+            deliver(m_messages_from_ring.dequeue());
+            continue;
+        }
+
+        if (TRY(read_messages_from_incoming_ring()))
+            continue;
+        if (!m_incoming_ring.has_value())
+            return {};
+
+        // NOTE: The peer only wakes us up through the socket if we ask for it, so ask before going to sleep, and then
+        //       look at the ring once more in case something was written to it in between.
+        m_incoming_ring->request_wakeup();
+        if (m_incoming_ring->is_empty())
+            return {};
+    }
+}
+
+ErrorOr<bool> TransportSocket::read_messages_from_incoming_ring()
+{
+    if (!m_incoming_ring.has_value())
+        return false;
+
+    bool did_read_any_messages = false;
+    for (;;) {
+        auto record = TRY(m_incoming_ring->try_read());
+        if (!record.has_value())
+            break;
+        SequencedMessage sequenced_message;
+        sequenced_message.sequence_number = record->sequence_number;
+        sequenced_message.bytes = move(record->bytes);
+        m_messages_from_ring.enqueue(move(sequenced_message));
+        did_read_any_messages = true;
+    }
+    return did_read_any_messages;
+}
+
+ErrorOr<void> TransportSocket::attach_incoming_ring(SequencedMessage&& message)
+{
+    if (m_incoming_ring.has_value() || message.bytes.size() != sizeof(u32) || message.fds.size() != 1)
+        return Error::from_string_literal("Unexpected shared memory ring from peer");
+
+    u32 capacity = 0;
+    memcpy(&capacity, message.bytes.data(), sizeof(capacity));
+    m_incoming_ring = TRY(SharedMemoryRing::attach(message.fds.first().take_fd(), capacity));
+
+    // The peer has moved its messages over to shared memory, so move ours over as well.
+    if (auto result = enable_shared_memory_transport(); result.is_error())
+        dbgln("TransportSocket: Couldn't set up shared memory, sending messages through the socket: {}", result.error());
+    return {};
+}
+
 ErrorOr<int> TransportSocket::release_underlying_transport_for_transfer()
 {
+    if (is_using_shared_memory_transport())
+        return Error::from_string_literal("Can't transfer a transport that uses shared memory");
+
     Threading::RWLockLocker<Threading::LockMode::Write> lock(m_socket_rw_lock);
     return m_socket->release_fd();
 }
 
 ErrorOr<IPC::File> TransportSocket::clone_for_transfer()
 {
+    if (is_using_shared_memory_transport())
+        return Error::from_string_literal("Can't transfer a transport that uses shared memory");
+
     Threading::RWLockLocker<Threading::LockMode::Write> lock(m_socket_rw_lock);
     return IPC::File::clone_fd(m_socket->fd().value());
 }
@@ -10,6 +10,8 @@
 #include <AK/MemoryStream.h>
 #include <AK/Queue.h>
 #include <LibCore/Socket.h>
+#include <LibIPC/File.h>
+#include <LibIPC/SharedMemoryRing.h>
 #include <LibThreading/ConditionVariable.h>
 #include <LibThreading/MutexProtected.h>
 #include <LibThreading/RWLock.h>
@@ -86,6 +88,12 @@ public:
 
     void post_message(Vector<u8> const&, Vector<NonnullRefPtr<AutoCloseFileDescriptor>> const&);
 
+    // Sends messages without file descriptors through a ring in shared memory from now on, and asks the peer to do the
+    // same, so that they don't cost a syscall each. The socket is still used for file descriptors, for messages that
+    // don't fit in the ring, and to wake up the peer when it's waiting for messages.
+    ErrorOr<void> enable_shared_memory_transport();
+    bool is_using_shared_memory_transport() const;
+
     enum class ShouldShutdown {
         No,
         Yes,
@@ -97,6 +105,7 @@ public:
     ShouldShutdown read_as_many_messages_as_possible_without_blocking(Function<void(Message&&)>&&);
 
     // Obnoxious name to make it clear that this is a dangerous operation.
+    // NOTE: This fails once the shared memory transport is in use, as the rings can't move along with the socket.
     ErrorOr<int> release_underlying_transport_for_transfer();
 
     ErrorOr<IPC::File> clone_for_transfer();
@@ -104,6 +113,19 @@ public:
 private:
     static ErrorOr<void> send_message(Core::LocalSocket&, ReadonlyBytes& bytes, Vector<int>& unowned_fds);
 
+    struct MessageHeader;
+    void enqueue_message_on_socket(MessageHeader const&, ReadonlyBytes, Vector<NonnullRefPtr<AutoCloseFileDescriptor>> const&);
+
+    struct SequencedMessage {
+        u32 sequence_number { 0 };
+        bool is_shared_memory_ring { false };
+        Vector<u8> bytes;
+        Vector<File> fds;
+    };
+    ErrorOr<void> attach_incoming_ring(SequencedMessage&&);
+    ErrorOr<bool> read_messages_from_incoming_ring();
+    ErrorOr<void> deliver_messages_in_order(Function<void(Message&&)>&);
+
     NonnullOwnPtr<Core::LocalSocket> m_socket;
     mutable Threading::RWLock m_socket_rw_lock;
     ByteBuffer m_unprocessed_bytes;
@@ -116,6 +138,17 @@ private:
 
     RefPtr<Threading::Thread> m_send_thread;
     RefPtr<SendQueue> m_send_queue;
+
+    // Every message gets a sequence number, so that the peer can put the messages it gets through the socket and
+    // through the ring back in the order they were posted in.
+    mutable Threading::Mutex m_send_mutex;
+    u32 m_next_outgoing_sequence_number { 0 };
+    Optional<SharedMemoryRing> m_outgoing_ring;
+
+    u32 m_next_incoming_sequence_number { 0 };
+    Optional<SharedMemoryRing> m_incoming_ring;
+    Queue<SequencedMessage, 64> m_messages_from_socket;
+    Queue<SequencedMessage, 64> m_messages_from_ring;
 };
 
 }
@@ -20,6 +20,10 @@ void Client::die()
         promise->reject(Error::from_string_literal("ImageDecoder disconnected"));
     }
     m_pending_decoded_images.clear();
+
+    auto pending_streamed_frames = move(m_pending_streamed_frames);
+    for (auto& [_, pending] : pending_streamed_frames)
+        pending.on_error();
 }
 
 NonnullRefPtr<Core::Promise<DecodedImage>> Client::decode_image(ReadonlyBytes encoded_data, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type)
@@ -57,10 +61,29 @@ NonnullRefPtr<Core::Promise<DecodedImage>> Client::decode_image(ReadonlyBytes en
     return promise;
 }
 
-void Client::did_decode_image(i64 image_id, bool is_animated, u32 loop_count, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations, Gfx::FloatPoint scale, Gfx::ColorSpace color_space)
+void Client::request_streamed_frames(i64 image_id, size_t first_frame_index, size_t count, StreamedFramesCallback on_decoded, StreamedFramesErrorCallback on_error)
+{
+    if (!is_open()) {
+        on_error();
+        return;
+    }
+
+    m_pending_streamed_frames.set(image_id, { move(on_decoded), move(on_error) });
+    async_request_streamed_frames(image_id, first_frame_index, count);
+}
+
+void Client::release_streamed_image(i64 image_id)
+{
+    m_pending_streamed_frames.remove(image_id);
+    if (is_open())
+        async_release_streamed_image(image_id);
+}
+
+void Client::did_decode_image(i64 image_id, bool is_animated, u32 loop_count, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations, Gfx::FloatPoint scale, Gfx::ColorSpace color_space, bool is_streamed)
 {
     auto bitmaps = move(bitmap_sequence.bitmaps);
     VERIFY(!bitmaps.is_empty());
+    VERIFY(is_streamed ? bitmaps.size() <= durations.size() : bitmaps.size() == durations.size());
 
     auto maybe_promise = m_pending_decoded_images.take(image_id);
     if (!maybe_promise.has_value()) {
@@ -73,7 +96,7 @@ void Client::did_decode_image(i64 image_id, bool is_animated, u32 loop_count, Gf
     image.is_animated = is_animated;
     image.loop_count = loop_count;
     image.scale = scale;
-    image.frames.ensure_capacity(bitmaps.size());
+    image.frames.ensure_capacity(durations.size());
     image.color_space = move(color_space);
     for (size_t i = 0; i < bitmaps.size(); ++i) {
         if (!bitmaps[i]) {
@@ -85,9 +108,33 @@ void Client::did_decode_image(i64 image_id, bool is_animated, u32 loop_count, Gf
         image.frames.empend(bitmaps[i].release_nonnull(), durations[i]);
     }
 
+    if (is_streamed) {
+        for (size_t i = bitmaps.size(); i < durations.size(); ++i)
+            image.frames.empend(nullptr, durations[i]);
+        image.streamed_image_id = image_id;
+    }
+
     promise->resolve(move(image));
 }
 
+void Client::did_decode_streamed_frames(i64 image_id, u32 first_frame_index, Gfx::BitmapSequence bitmap_sequence)
+{
+    auto pending = m_pending_streamed_frames.take(image_id);
+    if (!pending.has_value())
+        return;
+    pending->on_decoded(first_frame_index, move(bitmap_sequence.bitmaps));
+}
+
+void Client::did_fail_to_decode_streamed_frames(i64 image_id, String error_message)
+{
+    auto pending = m_pending_streamed_frames.take(image_id);
+    if (!pending.has_value())
+        return;
+
+    dbgln("ImageDecoderClient: Failed to decode frames of streamed image with ID {}: {}", image_id, error_message);
+    pending->on_error();
+}
+
 void Client::did_fail_to_decode_image(i64 image_id, String error_message)
 {
     auto maybe_promise = m_pending_decoded_images.take(image_id);
@@ -16,7 +16,8 @@
 namespace ImageDecoderClient {
 
 struct Frame {
-    NonnullRefPtr<Gfx::Bitmap> bitmap;
+    // NOTE: This is null for frames of a streamed image that have not been requested yet.
+    RefPtr<Gfx::Bitmap> bitmap;
     u32 duration { 0 };
 };
 
@@ -26,8 +27,15 @@ struct DecodedImage {
     u32 loop_count { 0 };
     Vector<Frame> frames;
     Gfx::ColorSpace color_space;
+
+    // Large animated images are streamed: only the first frame is decoded up front, and the decoder is kept alive in
+    // the ImageDecoder process so that the other frames can be requested with request_streamed_frames().
+    Optional<i64> streamed_image_id;
 };
 
+using StreamedFramesCallback = Function<void(size_t first_frame_index, Vector<RefPtr<Gfx::Bitmap>>)>;
+using StreamedFramesErrorCallback = Function<void()>;
+
 class Client final
     : public IPC::ConnectionToServer<ImageDecoderClientEndpoint, ImageDecoderServerEndpoint>
     , public ImageDecoderClientEndpoint {
@@ -40,15 +48,27 @@ public:
 
     NonnullRefPtr<Core::Promise<DecodedImage>> decode_image(ReadonlyBytes, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size = {}, Optional<ByteString> mime_type = {});
 
+    // Decodes `count` frames of a streamed image, starting at `first_frame_index` and wrapping around to the first frame.
+    // Exactly one of the callbacks is invoked, unless the image is released first.
+    void request_streamed_frames(i64 image_id, size_t first_frame_index, size_t count, StreamedFramesCallback on_decoded, StreamedFramesErrorCallback on_error);
+    void release_streamed_image(i64 image_id);
+
     Function<void()> on_death;
 
 private:
     virtual void die() override;
 
-    virtual void did_decode_image(i64 image_id, bool is_animated, u32 loop_count, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations, Gfx::FloatPoint scale, Gfx::ColorSpace color_space) override;
+    virtual void did_decode_image(i64 image_id, bool is_animated, u32 loop_count, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations, Gfx::FloatPoint scale, Gfx::ColorSpace color_space, bool is_streamed) override;
+    virtual void did_decode_streamed_frames(i64 image_id, u32 first_frame_index, Gfx::BitmapSequence bitmap_sequence) override;
+    virtual void did_fail_to_decode_streamed_frames(i64 image_id, String error_message) override;
     virtual void did_fail_to_decode_image(i64 image_id, String error_message) override;
 
     HashMap<i64, NonnullRefPtr<Core::Promise<DecodedImage>>> m_pending_decoded_images;
+    struct PendingStreamedFrames {
+        StreamedFramesCallback on_decoded;
+        StreamedFramesErrorCallback on_error;
+    };
+    HashMap<i64, PendingStreamedFrames> m_pending_streamed_frames;
 };
 
 }
@@ -37,4 +37,44 @@ void BasicBlock::grow(size_t additional_size)
     m_buffer.resize(m_buffer.size() + additional_size);
 }
 
+void BasicBlock::remove_instructions(HashTable<size_t> const& instruction_offsets)
+{
+    if (instruction_offsets.is_empty())
+        return;
+
+    Vector<u8> buffer;
+    buffer.ensure_capacity(m_buffer.size());
+    HashMap<size_t, SourceRecord> source_map;
+    m_last_instruction_start_offset = 0;
+
+    for (size_t offset = 0; offset < m_buffer.size();) {
+        auto& instruction = *reinterpret_cast<Instruction*>(m_buffer.data() + offset);
+        auto length = instruction.length();
+
+        if (instruction_offsets.contains(offset)) {
+            Instruction::destroy(instruction);
+        } else {
+            if (auto source_record = m_source_map.get(offset); source_record.has_value())
+                source_map.set(buffer.size(), *source_record);
+            m_last_instruction_start_offset = buffer.size();
+            buffer.append(reinterpret_cast<u8 const*>(&instruction), length);
+        }
+        offset += length;
+    }
+
+    m_buffer = move(buffer);
+    m_source_map = move(source_map);
+}
+
+void BasicBlock::replace_terminator(Instruction const& terminator)
+{
+    VERIFY(m_terminated);
+
+    auto& old_terminator = *reinterpret_cast<Instruction*>(m_buffer.data() + m_last_instruction_start_offset);
+    Instruction::destroy(old_terminator);
+
+    m_buffer.resize_and_keep_capacity(m_last_instruction_start_offset);
+    m_buffer.append(reinterpret_cast<u8 const*>(&terminator), terminator.length());
+}
+
 }
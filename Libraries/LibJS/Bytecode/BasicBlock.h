@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/Badge.h>
+#include <AK/HashTable.h>
 #include <AK/String.h>
 #include <LibGC/Root.h>
 #include <LibJS/Bytecode/Executable.h>
@@ -15,6 +16,10 @@
 
 namespace JS::Bytecode {
 
+namespace Passes {
+class EliminateDeadBlocks;
+}
+
 struct UnwindInfo {
     GC::Ptr<Executable const> executable;
     GC::Ptr<Environment> lexical_environment;
@@ -30,6 +35,7 @@ public:
     ~BasicBlock();
 
     u32 index() const { return m_index; }
+    void set_index(Badge<Passes::EliminateDeadBlocks>, u32 index) { m_index = index; }
 
     ReadonlyBytes instruction_stream() const { return m_buffer.span(); }
     u8* data() { return m_buffer.data(); }
@@ -44,6 +50,10 @@ public:
 
     void grow(size_t additional_size);
 
+    // For optimization passes, which rewrite blocks after they've been generated.
+    void remove_instructions(HashTable<size_t> const& instruction_offsets);
+    void replace_terminator(Instruction const&);
+
     void terminate(Badge<Generator>) { m_terminated = true; }
     bool is_terminated() const { return m_terminated; }
 
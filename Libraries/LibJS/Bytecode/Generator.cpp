@@ -10,7 +10,9 @@
 #include <LibJS/Bytecode/BasicBlock.h>
 #include <LibJS/Bytecode/Generator.h>
 #include <LibJS/Bytecode/Instruction.h>
+#include <LibJS/Bytecode/Interpreter.h>
 #include <LibJS/Bytecode/Op.h>
+#include <LibJS/Bytecode/Passes.h>
 #include <LibJS/Bytecode/Register.h>
 #include <LibJS/Runtime/ECMAScriptFunctionObject.h>
 #include <LibJS/Runtime/VM.h>
@@ -215,6 +217,16 @@ CodeGenerationErrorOr<void> Generator::emit_function_declaration_instantiation(E
     return {};
 }
 
+static size_t number_of_instructions_in(Vector<NonnullOwnPtr<BasicBlock>> const& basic_blocks)
+{
+    size_t count = 0;
+    for (auto const& block : basic_blocks) {
+        for (InstructionStreamIterator it(block->instruction_stream()); !it.at_end(); ++it)
+            ++count;
+    }
+    return count;
+}
+
 CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode const& node, FunctionKind enclosing_function_kind, GC::Ptr<ECMAScriptFunctionObject const> function, MustPropagateCompletion must_propagate_completion, Vector<LocalVariable> local_variable_names)
 {
     Generator generator(vm, function, must_propagate_completion);
@@ -268,6 +280,20 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
     else if (is<FunctionDeclaration>(node))
         is_strict_mode = static_cast<FunctionDeclaration const&>(node).is_strict_mode();
 
+    auto number_of_instructions_before_optimization = g_dump_bytecode_instruction_counts ? number_of_instructions_in(generator.m_root_basic_blocks) : 0;
+
+    if (g_optimize_bytecode) {
+        PassPipelineExecutable pass_pipeline_executable { generator.m_root_basic_blocks, generator.m_next_register };
+        default_pass_pipeline().perform(pass_pipeline_executable);
+    }
+
+    if (g_dump_bytecode_instruction_counts) {
+        warnln("{}: {} instructions, {} after optimization",
+            function ? function->name() : "(top level)"_fly_string,
+            number_of_instructions_before_optimization,
+            number_of_instructions_in(generator.m_root_basic_blocks));
+    }
+
     size_t size_needed = 0;
     for (auto& block : generator.m_root_basic_blocks) {
         size_needed += block->size();
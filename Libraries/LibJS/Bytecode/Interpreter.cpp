@@ -68,6 +68,8 @@ struct Traits<JS::PropertyKeyAndEnumerableFlag> : public DefaultTraits<JS::Prope
 namespace JS::Bytecode {
 
 bool g_dump_bytecode = false;
+bool g_dump_bytecode_instruction_counts = false;
+bool g_optimize_bytecode = true;
 
 static ByteString format_operand(StringView name, Operand operand, Bytecode::Executable const& executable)
 {
@@ -223,7 +225,11 @@ ThrowCompletionOr<Value> Interpreter::run(Script& script_record, GC::Ptr<Environ
     Completion result = instantiation_result.is_throw_completion() ? instantiation_result.throw_completion() : normal_completion(js_undefined());
 
     GC::Ptr<Executable> executable;
-    if (result.type() == Completion::Type::Normal) {
+    if (result.type() == Completion::Type::Normal)
+        executable = vm.script_cache().find_executable(script);
+
+    if (result.type() == Completion::Type::Normal && !executable) {
+        auto compile_start_time = MonotonicTime::now();
         auto executable_result = JS::Bytecode::Generator::generate_from_ast_node(vm, script, {});
 
         if (executable_result.is_error()) {
@@ -235,6 +241,7 @@ ThrowCompletionOr<Value> Interpreter::run(Script& script_record, GC::Ptr<Environ
                 result = vm.template throw_completion<JS::InternalError>(error_string.release_value());
         } else {
             executable = executable_result.release_value();
+            vm.script_cache().add_executable(script, *executable, MonotonicTime::now() - compile_start_time);
 
             if (g_dump_bytecode)
                 executable->dump();
@@ -557,6 +564,86 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             goto start;
         }
 
+#define HANDLE_INT32_ARITHMETIC_OP(op_TitleCase, checked_operation, numeric_operator)                                            \
+    handle_##op_TitleCase:                                                                                                       \
+    {                                                                                                                            \
+        auto& instruction = *reinterpret_cast<Op::op_TitleCase const*>(&bytecode[program_counter]);                              \
+        auto lhs = get(instruction.lhs());                                                                                       \
+        auto rhs = get(instruction.rhs());                                                                                       \
+        if (lhs.is_int32() && rhs.is_int32() && !Checked<i32>::checked_operation##_would_overflow(lhs.as_i32(), rhs.as_i32())) { \
+            set(instruction.dst(), Value(lhs.as_i32() numeric_operator rhs.as_i32()));                                           \
+            DISPATCH_NEXT(op_TitleCase);                                                                                         \
+        }                                                                                                                        \
+        auto result = instruction.execute_impl(*this);                                                                           \
+        if (result.is_error()) [[unlikely]] {                                                                                    \
+            if (handle_exception(program_counter, result.error_value()) == HandleExceptionResponse::ExitFromExecutable)          \
+                return;                                                                                                          \
+            goto start;                                                                                                          \
+        }                                                                                                                        \
+        DISPATCH_NEXT(op_TitleCase);                                                                                             \
+    }
+
+            // OPTIMIZATION: Int32 arithmetic is handled right here in the dispatch loop, so hot loops
+            //               don't pay for a call and a completion check per instruction on compilers
+            //               where we can't flatten run_bytecode().
+            HANDLE_INT32_ARITHMETIC_OP(Add, addition, +)
+            HANDLE_INT32_ARITHMETIC_OP(Sub, subtraction, -)
+            HANDLE_INT32_ARITHMETIC_OP(Mul, multiplication, *)
+#undef HANDLE_INT32_ARITHMETIC_OP
+
+        handle_Increment: {
+            auto& instruction = *reinterpret_cast<Op::Increment const*>(&bytecode[program_counter]);
+            if (auto value = get(instruction.dst()); value.is_int32() && value.as_i32() != NumericLimits<i32>::max()) [[likely]] {
+                set(instruction.dst(), Value { value.as_i32() + 1 });
+                DISPATCH_NEXT(Increment);
+            }
+            auto result = instruction.execute_impl(*this);
+            if (result.is_error()) [[unlikely]] {
+                if (handle_exception(program_counter, result.error_value()) == HandleExceptionResponse::ExitFromExecutable)
+                    return;
+                goto start;
+            }
+            DISPATCH_NEXT(Increment);
+        }
+
+        handle_Decrement: {
+            auto& instruction = *reinterpret_cast<Op::Decrement const*>(&bytecode[program_counter]);
+            if (auto value = get(instruction.dst()); value.is_int32() && value.as_i32() != NumericLimits<i32>::min()) [[likely]] {
+                set(instruction.dst(), Value { value.as_i32() - 1 });
+                DISPATCH_NEXT(Decrement);
+            }
+            auto result = instruction.execute_impl(*this);
+            if (result.is_error()) [[unlikely]] {
+                if (handle_exception(program_counter, result.error_value()) == HandleExceptionResponse::ExitFromExecutable)
+                    return;
+                goto start;
+            }
+            DISPATCH_NEXT(Decrement);
+        }
+
+        handle_GetById: {
+            auto& instruction = *reinterpret_cast<Op::GetById const*>(&bytecode[program_counter]);
+            // OPTIMIZATION: Check the most recently cached own property shape inline before falling back to get_by_id().
+            if (auto base_value = get(instruction.base()); base_value.is_object()) {
+                auto& object = base_value.as_object();
+                auto& cache_entry = executable.property_lookup_caches[instruction.cache_index()].entries[0];
+                if (!cache_entry.prototype && &object.shape() == cache_entry.shape) {
+                    auto value = object.get_direct(cache_entry.property_offset.value());
+                    if (!value.is_accessor()) {
+                        set(instruction.dst(), value);
+                        DISPATCH_NEXT(GetById);
+                    }
+                }
+            }
+            auto result = instruction.execute_impl(*this);
+            if (result.is_error()) [[unlikely]] {
+                if (handle_exception(program_counter, result.error_value()) == HandleExceptionResponse::ExitFromExecutable)
+                    return;
+                goto start;
+            }
+            DISPATCH_NEXT(GetById);
+        }
+
 #define HANDLE_INSTRUCTION(name)                                                                                            \
     handle_##name:                                                                                                          \
     {                                                                                                                       \
@@ -580,7 +667,6 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
         DISPATCH_NEXT(name);                                                                \
     }
 
-            HANDLE_INSTRUCTION(Add);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(AddPrivateName);
             HANDLE_INSTRUCTION(ArrayAppend);
             HANDLE_INSTRUCTION(AsyncIteratorClose);
@@ -603,7 +689,6 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             HANDLE_INSTRUCTION(CreateVariable);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(CreateRestParams);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(CreateArguments);
-            HANDLE_INSTRUCTION(Decrement);
             HANDLE_INSTRUCTION(DeleteById);
             HANDLE_INSTRUCTION(DeleteByIdWithThis);
             HANDLE_INSTRUCTION(DeleteByValue);
@@ -613,7 +698,6 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(Dump);
             HANDLE_INSTRUCTION(EnterObjectEnvironment);
             HANDLE_INSTRUCTION(Exp);
-            HANDLE_INSTRUCTION(GetById);
             HANDLE_INSTRUCTION(GetByIdWithThis);
             HANDLE_INSTRUCTION(GetByValue);
             HANDLE_INSTRUCTION(GetByValueWithThis);
@@ -637,7 +721,6 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             HANDLE_INSTRUCTION(HasPrivateId);
             HANDLE_INSTRUCTION(ImportCall);
             HANDLE_INSTRUCTION(In);
-            HANDLE_INSTRUCTION(Increment);
             HANDLE_INSTRUCTION(InitializeLexicalBinding);
             HANDLE_INSTRUCTION(InitializeVariableBinding);
             HANDLE_INSTRUCTION(InstanceOf);
@@ -655,7 +738,6 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             HANDLE_INSTRUCTION(LooselyEquals);
             HANDLE_INSTRUCTION(LooselyInequals);
             HANDLE_INSTRUCTION(Mod);
-            HANDLE_INSTRUCTION(Mul);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(NewArray);
             HANDLE_INSTRUCTION(NewClass);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(NewFunction);
@@ -683,7 +765,6 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             HANDLE_INSTRUCTION(SetVariableBinding);
             HANDLE_INSTRUCTION(StrictlyEquals);
             HANDLE_INSTRUCTION(StrictlyInequals);
-            HANDLE_INSTRUCTION(Sub);
             HANDLE_INSTRUCTION(SuperCallWithArgumentArray);
             HANDLE_INSTRUCTION(Throw);
             HANDLE_INSTRUCTION(ThrowIfNotObject);
@@ -1384,13 +1465,20 @@ inline ThrowCompletionOr<void> put_by_value(VM& vm, Value base, Optional<FlyStri
         if (storage
             && storage->is_simple_storage()
             && !object.may_interfere_with_indexed_property_access()) {
-            auto maybe_value = storage->get(index);
+            auto& simple_storage = static_cast<SimpleIndexedPropertyStorage&>(*storage);
+            auto maybe_value = simple_storage.inline_get(index);
             if (maybe_value.has_value()) {
                 auto existing_value = maybe_value->value;
                 if (!existing_value.is_accessor()) {
-                    storage->put(index, value);
+                    simple_storage.inline_set(index, value);
                     return {};
                 }
+            } else if (index == simple_storage.array_like_size()
+                && object.fast_is<Array>()
+                && static_cast<Array const&>(object).can_append_without_side_effects()) {
+                // OPTIMIZATION: Storing just past the end of an array appends to it, which keeps packed arrays packed.
+                simple_storage.put(index, value);
+                return {};
             }
         }
 
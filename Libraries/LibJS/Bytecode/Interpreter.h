@@ -105,6 +105,8 @@ private:
 };
 
 extern bool g_dump_bytecode;
+extern bool g_dump_bytecode_instruction_counts;
+extern bool g_optimize_bytecode;
 
 ThrowCompletionOr<GC::Ref<Bytecode::Executable>> compile(VM&, ASTNode const&, JS::FunctionKind kind, FlyString const& name);
 ThrowCompletionOr<GC::Ref<Bytecode::Executable>> compile(VM&, ECMAScriptFunctionObject const&);
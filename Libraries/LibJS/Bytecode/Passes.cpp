@@ -0,0 +1,433 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashMap.h>
+#include <AK/HashTable.h>
+#include <AK/NumericLimits.h>
+#include <LibJS/Bytecode/Op.h>
+#include <LibJS/Bytecode/Passes.h>
+#include <LibJS/Bytecode/Register.h>
+
+namespace JS::Bytecode {
+
+PassManager const& default_pass_pipeline()
+{
+    static auto const pipeline = [] {
+        PassManager pipeline;
+        pipeline.add<Passes::FoldMoves>();
+        pipeline.add<Passes::ThreadJumps>();
+        pipeline.add<Passes::EliminateDeadBlocks>();
+        pipeline.add<Passes::CompactRegisters>();
+        return pipeline;
+    }();
+    return pipeline;
+}
+
+static Vector<size_t> instruction_offsets_in(BasicBlock const& block)
+{
+    Vector<size_t> offsets;
+    for (InstructionStreamIterator it(block.instruction_stream()); !it.at_end(); ++it)
+        offsets.append(it.offset());
+    return offsets;
+}
+
+static Instruction& instruction_at(BasicBlock& block, size_t offset)
+{
+    return *reinterpret_cast<Instruction*>(block.data() + offset);
+}
+
+static Vector<Operand*, 8> operands_of(Instruction& instruction)
+{
+    Vector<Operand*, 8> operands;
+    instruction.visit_operands([&](Operand& operand) { operands.append(&operand); });
+    return operands;
+}
+
+// The instructions that read all their other operands before writing their first one, and do nothing else with them.
+static bool is_simple_operation(Instruction const& instruction)
+{
+    switch (instruction.type()) {
+#define __BYTECODE_OP(OpTitleCase, op_snake_case) \
+    case Instruction::Type::OpTitleCase:
+        JS_ENUMERATE_COMMON_BINARY_OPS_WITH_FAST_PATH(__BYTECODE_OP)
+        JS_ENUMERATE_COMMON_BINARY_OPS_WITHOUT_FAST_PATH(__BYTECODE_OP)
+        JS_ENUMERATE_COMMON_UNARY_OPS(__BYTECODE_OP)
+#undef __BYTECODE_OP
+    case Instruction::Type::Mov:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static bool reads_operand(Vector<Operand*, 8> const& operands, Operand operand)
+{
+    for (size_t i = 1; i < operands.size(); ++i) {
+        if (*operands[i] == operand)
+            return true;
+    }
+    return false;
+}
+
+namespace Passes {
+
+static void fold_moves_in_block(BasicBlock& block, Function<bool(Operand)> const& is_temporary)
+{
+    auto offsets = instruction_offsets_in(block);
+
+    // For each register, the indices of the instructions that use it, in order.
+    HashMap<u32, Vector<size_t>> uses;
+    for (size_t i = 0; i < offsets.size(); ++i) {
+        instruction_at(block, offsets[i]).visit_operands([&](Operand& operand) {
+            if (!operand.is_register())
+                return;
+            auto& indices = uses.ensure(operand.index());
+            if (indices.is_empty() || indices.last() != i)
+                indices.append(i);
+        });
+    }
+
+    auto forget_use = [&](Operand operand, size_t index) {
+        if (!operand.is_register())
+            return;
+        uses.ensure(operand.index()).remove_first_matching([&](auto i) { return i == index; });
+    };
+    auto remember_use = [&](Operand operand, size_t index) {
+        if (!operand.is_register())
+            return;
+        auto& indices = uses.ensure(operand.index());
+        if (!indices.contains_slow(index))
+            indices.insert_before_matching(index, [&](auto i) { return i > index; });
+    };
+
+    // Whether the value that the pair of instructions at `first` and `second` passes along in a temporary register is
+    // never read again. As the register isn't used outside this block, the next use after the pair (or the first use
+    // in the block, if the block loops back to itself) has to overwrite the register without reading it.
+    auto value_is_dead_after = [&](Operand temporary, size_t first, size_t second) {
+        Optional<size_t> next_use;
+        Optional<size_t> first_use;
+        for (auto index : uses.ensure(temporary.index())) {
+            if (index == first || index == second)
+                continue;
+            if (!first_use.has_value())
+                first_use = index;
+            if (index > second) {
+                next_use = index;
+                break;
+            }
+        }
+        if (!next_use.has_value())
+            next_use = first_use;
+        if (!next_use.has_value())
+            return true;
+
+        auto& instruction = instruction_at(block, offsets[*next_use]);
+        if (!is_simple_operation(instruction))
+            return false;
+        auto operands = operands_of(instruction);
+        return *operands[0] == temporary && !reads_operand(operands, temporary);
+    };
+
+    HashTable<size_t> removed;
+
+    auto next_index = [&](size_t index) -> Optional<size_t> {
+        for (auto i = index + 1; i < offsets.size(); ++i) {
+            if (!removed.contains(i))
+                return i;
+        }
+        return {};
+    };
+
+    enum class Folded {
+        No,
+        RemovedFirst,
+        RemovedSecond,
+    };
+
+    auto try_fold = [&](size_t first_index, size_t second_index) {
+        auto& first = instruction_at(block, offsets[first_index]);
+        auto& second = instruction_at(block, offsets[second_index]);
+        if (!is_simple_operation(first) || !is_simple_operation(second))
+            return Folded::No;
+
+        auto first_operands = operands_of(first);
+        auto second_operands = operands_of(second);
+
+        // `Mov rT, x; Op dst, rT, ...` => `Op dst, x, ...`
+        if (first.type() == Instruction::Type::Mov) {
+            auto temporary = *first_operands[0];
+            auto source = *first_operands[1];
+            if (is_temporary(temporary) && source != temporary && *second_operands[0] != temporary
+                && reads_operand(second_operands, temporary) && value_is_dead_after(temporary, first_index, second_index)) {
+                for (size_t i = 1; i < second_operands.size(); ++i) {
+                    if (*second_operands[i] == temporary)
+                        *second_operands[i] = source;
+                }
+                forget_use(temporary, first_index);
+                forget_use(temporary, second_index);
+                forget_use(source, first_index);
+                remember_use(source, second_index);
+                removed.set(first_index);
+                return Folded::RemovedFirst;
+            }
+        }
+
+        // `Op rT, ...; Mov dst, rT` => `Op dst, ...`
+        if (second.type() == Instruction::Type::Mov) {
+            auto temporary = *second_operands[1];
+            auto destination = *second_operands[0];
+            if (is_temporary(temporary) && *first_operands[0] == temporary && destination != temporary
+                && (destination.is_register() || destination.is_local())
+                && !reads_operand(first_operands, temporary) && value_is_dead_after(temporary, first_index, second_index)) {
+                *first_operands[0] = destination;
+                forget_use(temporary, first_index);
+                forget_use(temporary, second_index);
+                forget_use(destination, second_index);
+                remember_use(destination, first_index);
+                removed.set(second_index);
+                return Folded::RemovedSecond;
+            }
+        }
+
+        return Folded::No;
+    };
+
+    for (size_t index = 0; index < offsets.size(); ++index) {
+        if (removed.contains(index))
+            continue;
+        auto current = index;
+        for (auto next = next_index(current); next.has_value(); next = next_index(current)) {
+            auto folded = try_fold(current, *next);
+            if (folded == Folded::No)
+                break;
+            if (folded == Folded::RemovedFirst)
+                current = *next;
+        }
+    }
+
+    // Folding a chain of moves can leave behind a move of a value onto itself.
+    for (size_t index = 0; index < offsets.size(); ++index) {
+        if (removed.contains(index))
+            continue;
+        auto& instruction = instruction_at(block, offsets[index]);
+        if (instruction.type() == Instruction::Type::Mov) {
+            auto& mov = static_cast<Op::Mov&>(instruction);
+            if (mov.dst() == mov.src())
+                removed.set(index);
+        }
+    }
+
+    if (removed.is_empty())
+        return;
+
+    HashTable<size_t> removed_offsets;
+    for (auto index : removed)
+        removed_offsets.set(offsets[index]);
+    block.remove_instructions(removed_offsets);
+}
+
+void FoldMoves::perform(PassPipelineExecutable& executable) const
+{
+    // NOTE: Only registers that are used in a single block are folded away, since then that block alone tells us
+    //       whether anything still needs the value in them.
+    constexpr u32 unused = NumericLimits<u32>::max();
+    constexpr u32 used_in_multiple_blocks = NumericLimits<u32>::max() - 1;
+
+    Vector<u32> block_using_register;
+    block_using_register.resize_with_default_value(executable.number_of_registers, unused);
+
+    for (auto& block : executable.basic_blocks) {
+        for (auto offset : instruction_offsets_in(*block)) {
+            instruction_at(*block, offset).visit_operands([&](Operand& operand) {
+                if (!operand.is_register())
+                    return;
+                auto& user = block_using_register[operand.index()];
+                if (user == unused)
+                    user = block->index();
+                else if (user != block->index())
+                    user = used_in_multiple_blocks;
+            });
+        }
+    }
+
+    for (auto& block : executable.basic_blocks) {
+        fold_moves_in_block(*block, [&](Operand operand) {
+            return operand.is_register()
+                && operand.index() >= Register::reserved_register_count
+                && block_using_register[operand.index()] == block->index();
+        });
+    }
+}
+
+static Instruction* only_instruction_in(BasicBlock& block)
+{
+    if (!block.is_terminated() || block.size() == 0)
+        return nullptr;
+    auto& instruction = instruction_at(block, 0);
+    if (instruction.length() != block.size())
+        return nullptr;
+    return &instruction;
+}
+
+static bool is_conditional_jump(Instruction const& instruction)
+{
+    switch (instruction.type()) {
+    case Instruction::Type::JumpIf:
+    case Instruction::Type::JumpNullish:
+    case Instruction::Type::JumpUndefined:
+#define __BYTECODE_OP(op_TitleCase, ...) \
+    case Instruction::Type::Jump##op_TitleCase:
+        JS_ENUMERATE_COMPARISON_OPS(__BYTECODE_OP)
+#undef __BYTECODE_OP
+        return true;
+    default:
+        return false;
+    }
+}
+
+void ThreadJumps::perform(PassPipelineExecutable& executable) const
+{
+    auto& blocks = executable.basic_blocks;
+
+    // OPTIMIZATION: A block that ends by jumping to a block that only contains a conditional jump (like the end of a
+    //               loop body jumping to the loop's condition) can make that decision itself.
+    for (auto& block : blocks) {
+        if (!block->is_terminated())
+            continue;
+        auto& terminator = instruction_at(*block, block->last_instruction_start_offset());
+        if (terminator.type() != Instruction::Type::Jump)
+            continue;
+
+        auto& target = *blocks[static_cast<Op::Jump&>(terminator).target().basic_block_index()];
+        if (&target == block.ptr() || target.handler() != block->handler() || target.finalizer() != block->finalizer())
+            continue;
+        auto* target_instruction = only_instruction_in(target);
+        if (!target_instruction || !is_conditional_jump(*target_instruction))
+            continue;
+
+        auto terminator_offset = block->last_instruction_start_offset();
+        block->replace_terminator(*target_instruction);
+        if (auto source_record = target.source_map().get(0); source_record.has_value())
+            block->add_source_map_entry(terminator_offset, *source_record);
+    }
+
+    // OPTIMIZATION: Jumps to a block that only contains a jump can go straight to where that one goes.
+    auto final_target = [&](size_t index) {
+        // NOTE: The hop limit keeps us from going around in circles for `for (;;) {}` and friends.
+        for (size_t hops = 0; hops < blocks.size(); ++hops) {
+            auto* instruction = only_instruction_in(*blocks[index]);
+            if (!instruction || instruction->type() != Instruction::Type::Jump)
+                break;
+            index = static_cast<Op::Jump&>(*instruction).target().basic_block_index();
+        }
+        return index;
+    };
+
+    for (auto& block : blocks) {
+        for (auto offset : instruction_offsets_in(*block)) {
+            instruction_at(*block, offset).visit_labels([&](Label& label) {
+                label = Label { static_cast<u32>(final_target(label.basic_block_index())) };
+            });
+        }
+    }
+}
+
+void EliminateDeadBlocks::perform(PassPipelineExecutable& executable) const
+{
+    auto& blocks = executable.basic_blocks;
+
+    Vector<bool> reachable;
+    reachable.resize_with_default_value(blocks.size(), false);
+    Vector<size_t> worklist;
+
+    auto mark = [&](size_t index) {
+        if (reachable[index])
+            return;
+        reachable[index] = true;
+        worklist.append(index);
+    };
+
+    mark(0);
+    while (!worklist.is_empty()) {
+        auto& block = *blocks[worklist.take_last()];
+        if (auto const* handler = block.handler())
+            mark(handler->index());
+        if (auto const* finalizer = block.finalizer())
+            mark(finalizer->index());
+        for (auto offset : instruction_offsets_in(block)) {
+            instruction_at(block, offset).visit_labels([&](Label& label) {
+                mark(label.basic_block_index());
+            });
+        }
+    }
+
+    if (!reachable.contains_slow(false))
+        return;
+
+    Vector<u32> new_indices;
+    new_indices.resize(blocks.size());
+    Vector<NonnullOwnPtr<BasicBlock>> reachable_blocks;
+    for (size_t index = 0; index < blocks.size(); ++index) {
+        if (!reachable[index])
+            continue;
+        new_indices[index] = reachable_blocks.size();
+        blocks[index]->set_index({}, reachable_blocks.size());
+        reachable_blocks.append(move(blocks[index]));
+    }
+    blocks = move(reachable_blocks);
+
+    for (auto& block : blocks) {
+        for (auto offset : instruction_offsets_in(*block)) {
+            instruction_at(*block, offset).visit_labels([&](Label& label) {
+                label = Label { new_indices[label.basic_block_index()] };
+            });
+        }
+    }
+}
+
+void CompactRegisters::perform(PassPipelineExecutable& executable) const
+{
+    constexpr u32 unassigned = NumericLimits<u32>::max();
+
+    Vector<u32> new_indices;
+    new_indices.resize_with_default_value(executable.number_of_registers, unassigned);
+    for (u32 index = 0; index < Register::reserved_register_count; ++index)
+        new_indices[index] = index;
+
+    // NOTE: Registers keep their relative order, so this is deterministic and easy to follow in bytecode dumps.
+    for (auto& block : executable.basic_blocks) {
+        for (auto offset : instruction_offsets_in(*block)) {
+            instruction_at(*block, offset).visit_operands([&](Operand& operand) {
+                if (operand.is_register() && operand.index() >= Register::reserved_register_count)
+                    new_indices[operand.index()] = 0;
+            });
+        }
+    }
+
+    u32 number_of_registers = Register::reserved_register_count;
+    for (u32 index = Register::reserved_register_count; index < new_indices.size(); ++index) {
+        if (new_indices[index] != unassigned)
+            new_indices[index] = number_of_registers++;
+    }
+
+    if (number_of_registers == executable.number_of_registers)
+        return;
+
+    for (auto& block : executable.basic_blocks) {
+        for (auto offset : instruction_offsets_in(*block)) {
+            instruction_at(*block, offset).visit_operands([&](Operand& operand) {
+                if (operand.is_register())
+                    operand = Operand { Operand::Type::Register, new_indices[operand.index()] };
+            });
+        }
+    }
+
+    executable.number_of_registers = number_of_registers;
+}
+
+}
+
+}
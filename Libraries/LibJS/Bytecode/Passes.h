@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Vector.h>
+#include <LibJS/Bytecode/BasicBlock.h>
+
+namespace JS::Bytecode {
+
+// The basic blocks of an executable that has been generated, but not linked together yet.
+struct PassPipelineExecutable {
+    Vector<NonnullOwnPtr<BasicBlock>>& basic_blocks;
+    u32& number_of_registers;
+};
+
+class Pass {
+public:
+    virtual ~Pass() = default;
+
+    virtual void perform(PassPipelineExecutable&) const = 0;
+};
+
+class PassManager final : public Pass {
+public:
+    template<typename PassType>
+    void add() { m_passes.append(make<PassType>()); }
+
+    virtual void perform(PassPipelineExecutable& executable) const override
+    {
+        for (auto const& pass : m_passes)
+            pass->perform(executable);
+    }
+
+private:
+    Vector<NonnullOwnPtr<Pass>> m_passes;
+};
+
+namespace Passes {
+
+// Folds a Mov into the instruction computing its source, or into the instruction using its destination, if the
+// register in between isn't needed for anything else.
+class FoldMoves final : public Pass {
+public:
+    virtual void perform(PassPipelineExecutable&) const override;
+};
+
+// Points jumps past blocks that do nothing but jump elsewhere, and copies conditional jumps into blocks that only
+// jump to them (like the end of a loop body jumping back to the loop's condition).
+class ThreadJumps final : public Pass {
+public:
+    virtual void perform(PassPipelineExecutable&) const override;
+};
+
+// Removes the blocks that can't be reached from the entry block, neither by jumps nor by exceptions.
+class EliminateDeadBlocks final : public Pass {
+public:
+    virtual void perform(PassPipelineExecutable&) const override;
+};
+
+// Renumbers the registers that are still in use after the other passes, so that each call frame needs fewer of them.
+class CompactRegisters final : public Pass {
+public:
+    virtual void perform(PassPipelineExecutable&) const override;
+};
+
+}
+
+// The passes the generator runs over every executable, unless g_optimize_bytecode is false.
+PassManager const& default_pass_pipeline();
+
+}
@@ -160,6 +160,23 @@ ThrowCompletionOr<bool> Array::set_length(PropertyDescriptor const& property_des
     return true;
 }
 
+bool Array::can_append_without_side_effects() const
+{
+    if (!m_is_extensible || !m_length_writable)
+        return false;
+
+    // NOTE: [[Set]] looks for the new index in the prototype chain first, which could find a setter. Only skip that when
+    //       the prototype chain is the built-in one, and none of its objects have any indexed properties.
+    auto& intrinsics = shape().realm().intrinsics();
+    auto const* array_prototype = prototype();
+    if (array_prototype != intrinsics.array_prototype().ptr() || !array_prototype->indexed_properties().is_empty())
+        return false;
+
+    // NOTE: %Object.prototype% is an immutable prototype exotic object, so its own prototype is always null.
+    auto const* object_prototype = array_prototype->prototype();
+    return object_prototype == intrinsics.object_prototype().ptr() && object_prototype->indexed_properties().is_empty();
+}
+
 // 23.1.3.30.1 SortIndexedProperties ( obj, len, SortCompare, holes ), https://tc39.es/ecma262/#sec-sortindexedproperties
 ThrowCompletionOr<GC::RootVector<Value>> sort_indexed_properties(VM& vm, Object const& object, size_t length, Function<ThrowCompletionOr<double>(Value, Value)> const& sort_compare, Holes holes)
 {
@@ -54,6 +54,10 @@ public:
 
     [[nodiscard]] bool length_is_writable() const { return m_length_writable; }
 
+    // Whether a new element can be stored at index `length` by appending it to the indexed storage directly, without
+    // going through [[Set]], as nothing observable would happen differently.
+    [[nodiscard]] bool can_append_without_side_effects() const;
+
 protected:
     explicit Array(Object& prototype);
 
@@ -719,6 +719,27 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::for_each)
     return js_undefined();
 }
 
+// Returns the storage of an array whose first `length` elements can be read directly, as every one of them is an own data
+// property, which makes [[HasProperty]] and [[Get]] on them unobservable.
+static SimpleIndexedPropertyStorage const* packed_storage_for_direct_access(Object const& object, size_t length)
+{
+    if (!object.fast_is<Array>() || object.may_interfere_with_indexed_property_access())
+        return nullptr;
+    auto const* storage = object.indexed_properties().storage();
+    if (!storage || !storage->is_simple_storage())
+        return nullptr;
+    auto const& simple_storage = static_cast<SimpleIndexedPropertyStorage const&>(*storage);
+    if (!simple_storage.is_packed() || length > simple_storage.array_like_size())
+        return nullptr;
+    return &simple_storage;
+}
+
+// An array that only holds numbers can't have an element that is equal to a value that isn't one.
+static bool can_only_hold_numbers(SimpleIndexedPropertyStorage const& storage)
+{
+    return storage.element_kind() != SimpleIndexedPropertyStorage::ElementKind::Any;
+}
+
 // 23.1.3.16 Array.prototype.includes ( searchElement [ , fromIndex ] ), https://tc39.es/ecma262/#sec-array.prototype.includes
 JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::includes)
 {
@@ -742,6 +763,19 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::includes)
             from_index = from_argument;
     }
     auto value_to_find = vm.argument(0);
+
+    // OPTIMIZATION: Look at the elements of packed arrays directly.
+    if (auto const* storage = packed_storage_for_direct_access(*this_object, length)) {
+        if (can_only_hold_numbers(*storage) && !value_to_find.is_number())
+            return Value(false);
+        auto const& elements = storage->elements();
+        for (u64 i = from_index; i < length; ++i) {
+            if (same_value_zero(elements[i], value_to_find))
+                return Value(true);
+        }
+        return Value(false);
+    }
+
     for (u64 i = from_index; i < length; ++i) {
         auto element = TRY(this_object->get(i));
         if (same_value_zero(element, value_to_find))
@@ -795,6 +829,18 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::index_of)
         k = max(length + n, 0);
     }
 
+    // OPTIMIZATION: Look at the elements of packed arrays directly.
+    if (auto const* storage = packed_storage_for_direct_access(*object, length)) {
+        if (can_only_hold_numbers(*storage) && !search_element.is_number())
+            return Value(-1);
+        auto const& elements = storage->elements();
+        for (; k < length; ++k) {
+            if (is_strictly_equal(search_element, elements[k]))
+                return Value(k);
+        }
+        return Value(-1);
+    }
+
     // 10. Repeat, while k < len,
     for (; k < length; ++k) {
         auto property_key = PropertyKey { k };
@@ -15,6 +15,13 @@ namespace JS {
 
 GC_DEFINE_ALLOCATOR(DeclarativeEnvironment);
 
+u64 DeclarativeEnvironment::next_environment_serial_number()
+{
+    // NOTE: Starts at 1, so that a fresh GlobalVariableCache never matches an environment.
+    static u64 s_next_environment_serial_number = 1;
+    return s_next_environment_serial_number++;
+}
+
 DeclarativeEnvironment* DeclarativeEnvironment::create_for_per_iteration_bindings(Badge<ForStatement>, DeclarativeEnvironment& other, size_t bindings_size)
 {
     auto bindings = other.m_bindings.span().slice(0, bindings_size);
@@ -79,7 +86,7 @@ ThrowCompletionOr<void> DeclarativeEnvironment::create_mutable_binding(VM&, FlyS
         .initialized = false,
     });
 
-    ++m_environment_serial_number;
+    m_environment_serial_number = next_environment_serial_number();
 
     // 3. Return unused.
     return {};
@@ -102,7 +109,7 @@ ThrowCompletionOr<void> DeclarativeEnvironment::create_immutable_binding(VM&, Fl
         .initialized = false,
     });
 
-    ++m_environment_serial_number;
+    m_environment_serial_number = next_environment_serial_number();
 
     // 3. Return unused.
     return {};
@@ -212,7 +219,7 @@ ThrowCompletionOr<bool> DeclarativeEnvironment::delete_binding(VM&, FlyString co
     // NOTE: We keep the entries in m_bindings to avoid disturbing indices.
     binding_and_index->binding() = {};
 
-    ++m_environment_serial_number;
+    m_environment_serial_number = next_environment_serial_number();
 
     // 4. Return true.
     return true;
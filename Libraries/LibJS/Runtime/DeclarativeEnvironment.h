@@ -128,7 +128,10 @@ private:
     HashMap<FlyString, size_t> m_bindings_assoc;
     DisposeCapability m_dispose_capability;
 
-    u64 m_environment_serial_number { 0 };
+    // NOTE: Serial numbers are unique across all environments, not just within one, since bytecode (along with its
+    //       global variable caches) is shared between realms when a script is reused from the ScriptCache.
+    static u64 next_environment_serial_number();
+    u64 m_environment_serial_number { next_environment_serial_number() };
 };
 
 inline ThrowCompletionOr<Value> DeclarativeEnvironment::get_binding_value_direct(VM& vm, size_t index) const
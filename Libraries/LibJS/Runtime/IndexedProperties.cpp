@@ -18,6 +18,12 @@ SimpleIndexedPropertyStorage::SimpleIndexedPropertyStorage(Vector<Value>&& initi
     , m_array_size(initial_values.size())
     , m_packed_elements(move(initial_values))
 {
+    for (auto const& value : m_packed_elements) {
+        if (value.is_special_empty_value())
+            m_is_holey = true;
+        else
+            update_element_kind(value);
+    }
 }
 
 bool SimpleIndexedPropertyStorage::has_index(u32 index) const
@@ -48,9 +54,16 @@ void SimpleIndexedPropertyStorage::put(u32 index, Value value, PropertyAttribute
     VERIFY(attributes == default_attributes);
 
     if (index >= m_array_size) {
+        if (index > m_array_size)
+            m_is_holey = true;
         m_array_size = index + 1;
         grow_storage_if_needed();
     }
+    // NOTE: Array literals with elisions store empty values to make holes.
+    if (value.is_special_empty_value())
+        m_is_holey = true;
+    else
+        update_element_kind(value);
     m_packed_elements[index] = value;
 }
 
@@ -58,6 +71,7 @@ void SimpleIndexedPropertyStorage::remove(u32 index)
 {
     VERIFY(index < m_array_size);
     m_packed_elements[index] = js_special_empty_value();
+    m_is_holey = true;
 }
 
 ValueAndAttributes SimpleIndexedPropertyStorage::take_first()
@@ -76,6 +90,8 @@ ValueAndAttributes SimpleIndexedPropertyStorage::take_last()
 
 bool SimpleIndexedPropertyStorage::set_array_like_size(size_t new_size)
 {
+    if (new_size > m_array_size)
+        m_is_holey = true;
     m_array_size = new_size;
     m_packed_elements.resize_with_default_value_and_keep_capacity(new_size, js_special_empty_value());
     return true;
@@ -267,7 +283,10 @@ size_t IndexedProperties::real_size() const
     if (!m_storage)
         return 0;
     if (m_storage->is_simple_storage()) {
-        auto& packed_elements = static_cast<SimpleIndexedPropertyStorage const&>(*m_storage).elements();
+        auto const& storage = static_cast<SimpleIndexedPropertyStorage const&>(*m_storage);
+        if (storage.is_packed())
+            return storage.array_like_size();
+        auto& packed_elements = storage.elements();
         size_t size = 0;
         for (auto& element : packed_elements) {
             if (!element.is_special_empty_value())
@@ -287,6 +306,11 @@ Vector<u32> IndexedProperties::indices() const
         auto const& elements = storage.elements();
         Vector<u32> indices;
         indices.ensure_capacity(storage.array_like_size());
+        if (storage.is_packed()) {
+            for (size_t i = 0; i < storage.array_like_size(); ++i)
+                indices.unchecked_append(i);
+            return indices;
+        }
         for (size_t i = 0; i < elements.size(); ++i) {
             if (!elements.at(i).is_special_empty_value())
                 indices.unchecked_append(i);
@@ -58,6 +58,14 @@ private:
 
 class SimpleIndexedPropertyStorage final : public IndexedPropertyStorage {
 public:
+    // The most specific kind of value that every element is known to be. This only ever becomes more general as
+    // elements are stored, and doesn't go back when they are removed again.
+    enum class ElementKind : u8 {
+        Int32,
+        Number,
+        Any,
+    };
+
     SimpleIndexedPropertyStorage()
         : IndexedPropertyStorage(IsSimpleStorage::Yes)
     {
@@ -78,9 +86,17 @@ public:
 
     Vector<Value> const& elements() const { return m_packed_elements; }
 
+    ElementKind element_kind() const { return m_element_kind; }
+
+    // Packed storage has a value at every index below array_like_size(). Once a hole has been made, the storage stays
+    // holey, even if the hole is filled in later.
+    bool is_packed() const { return !m_is_holey; }
+
     [[nodiscard]] bool inline_has_index(u32 index) const
     {
-        return index < m_array_size && !m_packed_elements.data()[index].is_special_empty_value();
+        if (index >= m_array_size)
+            return false;
+        return !m_is_holey || !m_packed_elements.data()[index].is_special_empty_value();
     }
 
     [[nodiscard]] Optional<ValueAndAttributes> inline_get(u32 index) const
@@ -90,13 +106,30 @@ public:
         return ValueAndAttributes { m_packed_elements.data()[index], default_attributes };
     }
 
+    // Overwrites the value at an index that already has one.
+    void inline_set(u32 index, Value value)
+    {
+        VERIFY(inline_has_index(index));
+        update_element_kind(value);
+        m_packed_elements.data()[index] = value;
+    }
+
 private:
     friend GenericIndexedPropertyStorage;
 
     void grow_storage_if_needed();
 
+    ALWAYS_INLINE void update_element_kind(Value value)
+    {
+        if (m_element_kind == ElementKind::Any || value.is_int32())
+            return;
+        m_element_kind = value.is_number() ? ElementKind::Number : ElementKind::Any;
+    }
+
     size_t m_array_size { 0 };
     Vector<Value> m_packed_elements;
+    ElementKind m_element_kind { ElementKind::Int32 };
+    bool m_is_holey { false };
 };
 
 class GenericIndexedPropertyStorage final : public IndexedPropertyStorage {
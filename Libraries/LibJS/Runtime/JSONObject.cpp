@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <AK/Function.h>
 #include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
@@ -20,6 +21,7 @@
 #include <LibJS/Runtime/FunctionObject.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/JSONObject.h>
+#include <LibJS/Runtime/JSONParser.h>
 #include <LibJS/Runtime/NumberObject.h>
 #include <LibJS/Runtime/Object.h>
 #include <LibJS/Runtime/RawJSONObject.h>
@@ -233,6 +235,12 @@ ThrowCompletionOr<Optional<String>> JSONObject::serialize_json_property(VM& vm,
 // 25.5.2.4 SerializeJSONObject ( state, value ), https://tc39.es/ecma262/#sec-serializejsonobject
 ThrowCompletionOr<String> JSONObject::serialize_json_object(VM& vm, StringifyState& state, Object& object)
 {
+    if (auto const* serializable_shape = serializable_shape_for(vm, state, object)) {
+        StringBuilder builder;
+        TRY(serialize_json_object_directly(vm, state, object, *serializable_shape, builder));
+        return builder.to_string_without_validation();
+    }
+
     if (state.seen_objects.contains(&object))
         return vm.throw_completion<TypeError>(ErrorType::JsonCircular);
 
@@ -301,6 +309,12 @@ ThrowCompletionOr<String> JSONObject::serialize_json_object(VM& vm, StringifySta
 // 25.5.2.5 SerializeJSONArray ( state, value ), https://tc39.es/ecma262/#sec-serializejsonarray
 ThrowCompletionOr<String> JSONObject::serialize_json_array(VM& vm, StringifyState& state, Object& object)
 {
+    if (can_serialize_array_directly(vm, state, object)) {
+        StringBuilder builder;
+        TRY(serialize_json_array_directly(vm, state, static_cast<Array&>(object), builder));
+        return builder.to_string_without_validation();
+    }
+
     if (state.seen_objects.contains(&object))
         return vm.throw_completion<TypeError>(ErrorType::JsonCircular);
 
@@ -359,13 +373,224 @@ ThrowCompletionOr<String> JSONObject::serialize_json_array(VM& vm, StringifyStat
     return builder.to_string_without_validation();
 }
 
+// OPTIMIZATION: Serializing plain objects and arrays doesn't have to go through the generic property lookups of
+//               SerializeJSONProperty, as long as nothing along the way could run user code. Everything below writes
+//               its output straight into a single StringBuilder, and hands anything it can't handle off to the regular
+//               path above.
+bool JSONObject::can_serialize_directly(StringifyState const& state)
+{
+    // NOTE: A replacer function gets to see every value, and a property list or gap is rare enough to not bother.
+    return !state.replacer_function && !state.property_list.has_value() && state.gap.is_empty();
+}
+
+JSONObject::SerializableShape const* JSONObject::serializable_shape_for(VM& vm, StringifyState& state, Object& object)
+{
+    if (!can_serialize_directly(state))
+        return nullptr;
+
+    if (object.may_interfere_with_indexed_property_access() || object.is_global_object() || object.has_intrinsic_accessors())
+        return nullptr;
+
+    // NOTE: These are all treated differently by SerializeJSONProperty, even if someone gave them %Object.prototype%.
+    if (object.is_function() || object.fast_is<Array>() || object.is_number_object() || object.is_boolean_object() || object.is_bigint_object() || object.is_raw_json_object())
+        return nullptr;
+
+    // NOTE: Integer keys come before all other keys, so we'd have to merge those in. Dictionary shapes are changed in
+    //       place, so they can't be cached.
+    auto& shape = object.shape();
+    if (!object.indexed_properties().is_empty() || shape.is_dictionary())
+        return nullptr;
+
+    // GetV(value, "toJSON") has to come up empty without looking at anything but the object and %Object.prototype%.
+    auto& realm = *vm.current_realm();
+    auto object_prototype = realm.intrinsics().object_prototype();
+    if (shape.prototype() != object_prototype.ptr() || object_prototype->storage_has(vm.names.toJSON))
+        return nullptr;
+
+    auto& serializable_shape = *state.serializable_shapes.ensure(&shape, [&] {
+        auto serializable_shape = make<SerializableShape>();
+        serializable_shape->shape = GC::make_root(shape);
+        serializable_shape->is_serializable = true;
+
+        // NOTE: The property table of a shape that isn't a dictionary is in insertion order, which is the order
+        //       EnumerableOwnProperties returns string keys in.
+        for (auto const& [key, metadata] : shape.property_table()) {
+            if (key.is_symbol())
+                continue;
+            if (key.as_string() == vm.names.toJSON.as_string()) {
+                serializable_shape->is_serializable = false;
+                break;
+            }
+            if (!metadata.attributes.is_enumerable())
+                continue;
+
+            StringBuilder quoted_key;
+            quote_json_string(quoted_key, key.as_string());
+            quoted_key.append(':');
+            serializable_shape->properties.append({ key.as_string(), quoted_key.to_string_without_validation(), metadata.offset });
+        }
+        return serializable_shape;
+    });
+
+    if (!serializable_shape.is_serializable)
+        return nullptr;
+    return &serializable_shape;
+}
+
+bool JSONObject::can_serialize_array_directly(VM& vm, StringifyState const& state, Object& object)
+{
+    if (!can_serialize_directly(state) || !object.fast_is<Array>() || object.may_interfere_with_indexed_property_access())
+        return false;
+
+    auto const* storage = object.indexed_properties().storage();
+    if (storage && !storage->is_simple_storage())
+        return false;
+
+    // NOTE: Arrays look for toJSON like any other object, so the whole prototype chain has to be the one we know.
+    auto& realm = *vm.current_realm();
+    auto array_prototype = realm.intrinsics().array_prototype();
+    auto object_prototype = realm.intrinsics().object_prototype();
+    return object.shape().prototype() == array_prototype.ptr()
+        && array_prototype->shape().prototype() == object_prototype.ptr()
+        && !object.storage_has(vm.names.toJSON)
+        && !array_prototype->storage_has(vm.names.toJSON)
+        && !object_prototype->storage_has(vm.names.toJSON);
+}
+
+// Serializes a property like SerializeJSONProperty, but into the given builder. If the value has been read from the
+// holder's storage already, it's passed in, so we know whether it can be serialized without any side effects.
+// Returns false if the property serialized to undefined.
+ThrowCompletionOr<bool> JSONObject::serialize_json_property_directly(VM& vm, StringifyState& state, PropertyKey const& key, Object& holder, Optional<Value> value, StringBuilder& builder)
+{
+    if (value.has_value()) {
+        if (value->is_null()) {
+            builder.append("null"sv);
+            return true;
+        }
+        if (value->is_boolean()) {
+            builder.append(value->as_bool() ? "true"sv : "false"sv);
+            return true;
+        }
+        if (value->is_string()) {
+            quote_json_string(builder, value->as_string().utf8_string_view());
+            return true;
+        }
+        if (value->is_int32()) {
+            builder.appendff("{}", value->as_i32());
+            return true;
+        }
+        if (value->is_number()) {
+            if (!value->is_finite_number()) {
+                builder.append("null"sv);
+                return true;
+            }
+            auto number = number_to_string(value->as_double());
+            builder.append(number);
+            return true;
+        }
+        if (value->is_undefined() || value->is_symbol())
+            return false;
+
+        if (value->is_object()) {
+            auto& object = value->as_object();
+            if (auto const* serializable_shape = serializable_shape_for(vm, state, object)) {
+                TRY(serialize_json_object_directly(vm, state, object, *serializable_shape, builder));
+                return true;
+            }
+            if (can_serialize_array_directly(vm, state, object)) {
+                TRY(serialize_json_array_directly(vm, state, static_cast<Array&>(object), builder));
+                return true;
+            }
+        }
+    }
+
+    // Everything else (accessors, toJSON methods, wrapper objects, BigInts, ...) goes through the regular path.
+    auto serialized_property = TRY(serialize_json_property(vm, state, key, &holder));
+    if (!serialized_property.has_value())
+        return false;
+    builder.append(*serialized_property);
+    return true;
+}
+
+ThrowCompletionOr<void> JSONObject::serialize_json_object_directly(VM& vm, StringifyState& state, Object& object, SerializableShape const& serializable_shape, StringBuilder& builder)
+{
+    if (state.seen_objects.contains(&object))
+        return vm.throw_completion<TypeError>(ErrorType::JsonCircular);
+
+    state.seen_objects.set(&object);
+
+    builder.append('{');
+    bool first = true;
+    for (auto const& property : serializable_shape.properties) {
+        auto start_of_property = builder.length();
+        if (!first)
+            builder.append(',');
+        builder.append(property.quoted_key);
+
+        // NOTE: If user code that ran for an earlier property changed the shape of this object, we can't use the offsets
+        //       we have anymore. The keys we visit stay the same, as the spec collects them all up front as well.
+        Optional<Value> value;
+        if (&object.shape() == serializable_shape.shape.ptr())
+            value = object.get_direct(property.offset);
+
+        if (TRY(serialize_json_property_directly(vm, state, property.key, object, value, builder)))
+            first = false;
+        else
+            builder.trim(builder.length() - start_of_property);
+    }
+    builder.append('}');
+
+    state.seen_objects.remove(&object);
+    return {};
+}
+
+ThrowCompletionOr<void> JSONObject::serialize_json_array_directly(VM& vm, StringifyState& state, Array& array, StringBuilder& builder)
+{
+    if (state.seen_objects.contains(&array))
+        return vm.throw_completion<TypeError>(ErrorType::JsonCircular);
+
+    state.seen_objects.set(&array);
+
+    auto length = array.indexed_properties().array_like_size();
+
+    builder.append('[');
+    for (size_t i = 0; i < length; ++i) {
+        if (i != 0)
+            builder.append(',');
+
+        // NOTE: Holes are looked up in the prototype chain, and user code may have changed the array in the meantime,
+        //       so only elements that are still right there are read directly.
+        Optional<Value> value;
+        if (auto const* storage = array.indexed_properties().storage(); storage && storage->is_simple_storage()) {
+            auto const& elements = static_cast<SimpleIndexedPropertyStorage const&>(*storage).elements();
+            if (i < elements.size() && !elements[i].is_special_empty_value())
+                value = elements[i];
+        }
+
+        if (!TRY(serialize_json_property_directly(vm, state, i, array, value, builder)))
+            builder.append("null"sv);
+    }
+    builder.append(']');
+
+    state.seen_objects.remove(&array);
+    return {};
+}
+
 // 25.5.2.2 QuoteJSONString ( value ), https://tc39.es/ecma262/#sec-quotejsonstring
-String JSONObject::quote_json_string(String string)
+void JSONObject::quote_json_string(StringBuilder& builder, StringView string)
 {
     // 1. Let product be the String value consisting solely of the code unit 0x0022 (QUOTATION MARK).
-    StringBuilder builder;
     builder.append('"');
 
+    // OPTIMIZATION: Most strings don't contain anything that has to be escaped, so they can be appended as they are.
+    //               Surrogates are encoded as 0xED followed by a byte >= 0xA0, so looking for 0xED finds all of them.
+    auto needs_escaping = [](u8 byte) { return byte < 0x20 || byte == '"' || byte == '\\' || byte == 0xED; };
+    if (!any_of(string.bytes(), needs_escaping)) {
+        builder.append(string);
+        builder.append('"');
+        return;
+    }
+
     // 2. For each code point C of StringToCodePoints(value), do
     auto utf_view = Utf8View(string);
     for (auto code_point : utf_view) {
@@ -411,6 +636,12 @@ String JSONObject::quote_json_string(String string)
     builder.append('"');
 
     // 4. Return product.
+}
+
+String JSONObject::quote_json_string(String string)
+{
+    StringBuilder builder;
+    quote_json_string(builder, string);
     return builder.to_string_without_validation();
 }
 
@@ -450,18 +681,14 @@ JS_DEFINE_NATIVE_FUNCTION(JSONObject::parse)
 // 25.5.1.1 ParseJSON ( text ), https://tc39.es/ecma262/#sec-ParseJSON
 ThrowCompletionOr<Value> JSONObject::parse_json(VM& vm, StringView text)
 {
-    auto json = JsonValue::from_string(text);
-
     // 1. If StringToCodePoints(text) is not a valid JSON text as specified in ECMA-404, throw a SyntaxError exception.
-    if (json.is_error())
-        return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
-
     // 2. Let scriptString be the string-concatenation of "(", text, and ");".
     // 3. Let script be ParseText(scriptString, Script).
     // 4. NOTE: The early error rules defined in 13.2.5.1 have special handling for the above invocation of ParseText.
     // 5. Assert: script is a Parse Node.
     // 6. Let result be ! Evaluation of script.
-    auto result = JSONObject::parse_json_value(vm, json.value());
+    // NOTE: The JSON parser validates the text and evaluates it into JS values in a single pass.
+    auto result = TRY(JSONParser::parse(vm, text));
 
     // 7. NOTE: The PropertyDefinitionEvaluation semantics defined in 13.2.5.5 have special handling for the above evaluation.
     // 8. Assert: result is either a String, a Number, a Boolean, an Object that is defined by either an ArrayLiteral or an ObjectLiteral, or null.
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
+#include <LibGC/Root.h>
 #include <LibJS/Runtime/Object.h>
 
 namespace JS {
@@ -28,12 +30,28 @@ public:
 private:
     explicit JSONObject(Realm&);
 
+    // The properties SerializeJSONObject visits for every object with a given shape, if it can read them straight
+    // from the object's storage. This is the case for data properties of ordinary objects that inherit from
+    // %Object.prototype%, as long as there's no toJSON method to be found.
+    struct SerializableShape {
+        struct Property {
+            PropertyKey key;
+            String quoted_key;
+            u32 offset { 0 };
+        };
+
+        GC::Root<Shape> shape;
+        Vector<Property> properties;
+        bool is_serializable { false };
+    };
+
     struct StringifyState {
         GC::Ptr<FunctionObject> replacer_function;
         HashTable<GC::Ptr<Object>> seen_objects;
         String indent;
         String gap;
         Optional<Vector<String>> property_list;
+        HashMap<GC::Ptr<Shape>, NonnullOwnPtr<SerializableShape>> serializable_shapes;
     };
 
     // Stringify helpers
@@ -41,6 +59,15 @@ private:
     static ThrowCompletionOr<String> serialize_json_object(VM&, StringifyState&, Object&);
     static ThrowCompletionOr<String> serialize_json_array(VM&, StringifyState&, Object&);
     static String quote_json_string(String);
+    static void quote_json_string(StringBuilder&, StringView);
+
+    // Stringify fast paths, which write everything into a single StringBuilder
+    static bool can_serialize_directly(StringifyState const&);
+    static SerializableShape const* serializable_shape_for(VM&, StringifyState&, Object&);
+    static bool can_serialize_array_directly(VM&, StringifyState const&, Object&);
+    static ThrowCompletionOr<bool> serialize_json_property_directly(VM&, StringifyState&, PropertyKey const& key, Object& holder, Optional<Value> value, StringBuilder&);
+    static ThrowCompletionOr<void> serialize_json_object_directly(VM&, StringifyState&, Object&, SerializableShape const&, StringBuilder&);
+    static ThrowCompletionOr<void> serialize_json_array_directly(VM&, StringifyState&, Array&, StringBuilder&);
 
     // Parse helpers
     static Object* parse_json_object(VM&, JsonObject const&);
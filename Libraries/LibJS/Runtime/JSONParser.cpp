@@ -0,0 +1,376 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/BitCast.h>
+#include <AK/CharacterTypes.h>
+#include <AK/FloatingPointStringConversions.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
+#include <AK/StringBuilder.h>
+#include <LibGC/DeferGC.h>
+#include <LibJS/Runtime/Array.h>
+#include <LibJS/Runtime/Error.h>
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/JSONParser.h>
+#include <LibJS/Runtime/Object.h>
+#include <LibJS/Runtime/PrimitiveString.h>
+#include <LibJS/Runtime/Shape.h>
+#include <LibJS/Runtime/VM.h>
+
+namespace JS {
+
+ThrowCompletionOr<Value> JSONParser::parse(VM& vm, StringView text)
+{
+    // NOTE: Almost everything allocated while parsing ends up in the result, so there's little point in collecting
+    //       garbage before we're done. Deferring GC also keeps the values we're holding on to in the meantime alive.
+    GC::DeferGC defer_gc(vm.heap());
+
+    JSONParser parser(vm, text);
+    auto value = TRY(parser.parse_value(0));
+
+    parser.skip_whitespace();
+    if (!parser.is_eof())
+        return parser.syntax_error();
+    return value;
+}
+
+JSONParser::JSONParser(VM& vm, StringView text)
+    : GenericLexer(text)
+    , m_vm(vm)
+{
+}
+
+Completion JSONParser::syntax_error() const
+{
+    return m_vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+}
+
+void JSONParser::skip_whitespace()
+{
+    ignore_while([](char ch) { return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r'; });
+}
+
+ThrowCompletionOr<void> JSONParser::consume_or_throw(char ch)
+{
+    if (!consume_specific(ch))
+        return syntax_error();
+    return {};
+}
+
+ThrowCompletionOr<Value> JSONParser::parse_value(size_t depth)
+{
+    skip_whitespace();
+    switch (peek()) {
+    case '{':
+        return parse_object(depth);
+    case '[':
+        return parse_array(depth);
+    case '"':
+        return parse_string();
+    case '-':
+    case '0':
+    case '1':
+    case '2':
+    case '3':
+    case '4':
+    case '5':
+    case '6':
+    case '7':
+    case '8':
+    case '9':
+        return parse_number();
+    case 't':
+        return parse_literal("true"sv, Value(true));
+    case 'f':
+        return parse_literal("false"sv, Value(false));
+    case 'n':
+        return parse_literal("null"sv, js_null());
+    default:
+        return syntax_error();
+    }
+}
+
+ThrowCompletionOr<Value> JSONParser::parse_literal(StringView literal, Value value)
+{
+    if (!consume_specific(literal))
+        return syntax_error();
+    return value;
+}
+
+JSONParser::ShapeHint* JSONParser::shape_hint_for_depth(size_t depth)
+{
+    if (depth >= m_shape_hints.size())
+        m_shape_hints.resize(depth + 1);
+    return &m_shape_hints[depth];
+}
+
+ThrowCompletionOr<Value> JSONParser::parse_object(size_t depth)
+{
+    if (m_vm.did_reach_stack_space_limit())
+        return m_vm.throw_completion<InternalError>(ErrorType::CallStackSizeExceeded);
+
+    TRY(consume_or_throw('{'));
+
+    Vector<ParsedString, 16> keys;
+    Vector<Value, 16> values;
+
+    skip_whitespace();
+    if (!consume_specific('}')) {
+        for (;;) {
+            skip_whitespace();
+            if (peek() != '"')
+                return syntax_error();
+            keys.append(TRY(consume_string()));
+
+            skip_whitespace();
+            TRY(consume_or_throw(':'));
+            values.append(TRY(parse_value(depth + 1)));
+
+            skip_whitespace();
+            if (consume_specific('}'))
+                break;
+            TRY(consume_or_throw(','));
+        }
+    }
+
+    auto& realm = *m_vm.current_realm();
+    auto& shape_hint = *shape_hint_for_depth(depth);
+
+    auto matches_shape_hint = [&] {
+        if (!shape_hint.shape || shape_hint.keys.size() != keys.size())
+            return false;
+        for (size_t i = 0; i < keys.size(); ++i) {
+            if (keys[i].view() != shape_hint.keys[i].bytes_as_string_view())
+                return false;
+        }
+        return true;
+    };
+
+    if (matches_shape_hint()) {
+        // NOTE: The hint's shape was made by adding each of these keys in order, so their values go in that order too.
+        auto object = Object::create_with_premade_shape(*shape_hint.shape);
+        for (size_t i = 0; i < values.size(); ++i)
+            object->put_direct(i, values[i]);
+        return object;
+    }
+
+    auto object = Object::create(realm, realm.intrinsics().object_prototype());
+    Vector<FlyString> property_names;
+    property_names.ensure_capacity(keys.size());
+
+    for (size_t i = 0; i < keys.size(); ++i) {
+        auto property_name = keys[i].unescaped.has_value()
+            ? FlyString { *keys[i].unescaped }
+            : FlyString::from_utf8_without_validation(keys[i].raw.bytes());
+        // NOTE: If a key appears more than once, the last value wins, but the property keeps its original position.
+        object->define_direct_property(property_name, values[i], default_attributes);
+        property_names.unchecked_append(move(property_name));
+    }
+
+    // NOTE: Duplicate keys and array indices don't end up in the shape, so this only holds if there were none of those.
+    auto& shape = object->shape();
+    if (!shape.is_dictionary() && shape.property_count() == keys.size())
+        shape_hint = { shape, move(property_names) };
+
+    return object;
+}
+
+ThrowCompletionOr<Value> JSONParser::parse_array(size_t depth)
+{
+    if (m_vm.did_reach_stack_space_limit())
+        return m_vm.throw_completion<InternalError>(ErrorType::CallStackSizeExceeded);
+
+    TRY(consume_or_throw('['));
+
+    Vector<Value> elements;
+
+    skip_whitespace();
+    if (!consume_specific(']')) {
+        for (;;) {
+            elements.append(TRY(parse_value(depth + 1)));
+
+            skip_whitespace();
+            if (consume_specific(']'))
+                break;
+            TRY(consume_or_throw(','));
+        }
+    }
+
+    auto& realm = *m_vm.current_realm();
+    auto array = MUST(Array::create(realm, 0));
+    array->set_indexed_property_elements(move(elements));
+    return array;
+}
+
+ThrowCompletionOr<Value> JSONParser::parse_number()
+{
+    auto start = tell();
+
+    bool is_negative = consume_specific('-');
+
+    // NOTE: A leading zero can't be followed by more digits, which the caller catches, as they won't expect a digit.
+    if (!consume_specific('0')) {
+        if (!is_ascii_digit(peek()))
+            return syntax_error();
+        ignore_while(is_ascii_digit);
+    }
+
+    bool is_integer = true;
+
+    if (consume_specific('.')) {
+        if (!is_ascii_digit(peek()))
+            return syntax_error();
+        ignore_while(is_ascii_digit);
+        is_integer = false;
+    }
+
+    if (consume_specific('e') || consume_specific('E')) {
+        if (!consume_specific('+'))
+            consume_specific('-');
+        if (!is_ascii_digit(peek()))
+            return syntax_error();
+        ignore_while(is_ascii_digit);
+        is_integer = false;
+    }
+
+    auto text = m_input.substring_view(start, tell() - start);
+
+    // OPTIMIZATION: Integers with up to 15 digits are always exactly representable as a double, so we can add up
+    //               their digits directly.
+    if (auto digits = text.substring_view(is_negative ? 1 : 0); is_integer && digits.length() <= 15) {
+        i64 value = 0;
+        for (auto digit : digits)
+            value = (value * 10) + (digit - '0');
+        if (is_negative)
+            return Value(value == 0 ? -0.0 : static_cast<double>(-value));
+        return Value(static_cast<double>(value));
+    }
+
+    auto const* characters = text.characters_without_null_termination();
+    auto result = parse_first_floating_point<double>(characters, characters + text.length());
+    if (!result.parsed_value() || result.end_ptr != characters + text.length())
+        return syntax_error();
+    return Value(result.value);
+}
+
+ThrowCompletionOr<Value> JSONParser::parse_string()
+{
+    auto string = TRY(consume_string());
+    if (string.unescaped.has_value())
+        return PrimitiveString::create(m_vm, string.unescaped.release_value());
+    return PrimitiveString::create(m_vm, String::from_utf8_without_validation(string.raw.bytes()));
+}
+
+static constexpr AK::SIMD::u8x16 splat(u8 value)
+{
+    return AK::SIMD::u8x16 { value, value, value, value, value, value, value, value, value, value, value, value, value, value, value, value };
+}
+
+static constexpr bool needs_special_handling_in_string(u8 byte)
+{
+    // All code points may be placed within the quotation marks except for the code points that must be escaped:
+    // quotation mark (U+0022), reverse solidus (U+005C), and the control characters U+0000 to U+001F.
+    return byte == '"' || byte == '\\' || byte < 0x20;
+}
+
+// Returns how many bytes at the start of the given span can be taken into a string as they are.
+static size_t count_plain_string_bytes(ReadonlyBytes bytes)
+{
+    using namespace AK::SIMD;
+
+    // OPTIMIZATION: Look at 16 bytes at a time, as strings are usually long stretches of plain characters. The bytes
+    //               of UTF-8 sequences are all >= 0x80, so they can be taken as they are as well.
+    size_t offset = 0;
+    for (; offset + sizeof(u8x16) <= bytes.size(); offset += sizeof(u8x16)) {
+        auto chunk = load_unaligned<u8x16>(bytes.offset_pointer(offset));
+        auto special = (chunk == splat('"')) | (chunk == splat('\\')) | (chunk < splat(0x20));
+        auto special_halves = bit_cast<u64x2>(special);
+        if ((special_halves[0] | special_halves[1]) != 0)
+            break;
+    }
+
+    for (; offset < bytes.size(); ++offset) {
+        if (needs_special_handling_in_string(bytes[offset]))
+            break;
+    }
+    return offset;
+}
+
+ThrowCompletionOr<JSONParser::ParsedString> JSONParser::consume_string()
+{
+    TRY(consume_or_throw('"'));
+
+    auto start = tell();
+    auto plain_length = count_plain_string_bytes(m_input.bytes().slice(start));
+    m_index += plain_length;
+
+    if (is_eof())
+        return syntax_error();
+    if (consume_specific('"'))
+        return ParsedString { m_input.substring_view(start, plain_length), {} };
+
+    StringBuilder builder;
+    builder.append(m_input.substring_view(start, plain_length));
+
+    for (;;) {
+        if (is_eof())
+            return syntax_error();
+        if (consume_specific('"'))
+            break;
+
+        // Everything else that needed special handling was a control character, which must have been escaped.
+        if (!consume_specific('\\'))
+            return syntax_error();
+
+        switch (peek()) {
+        case '"':
+        case '\\':
+        case '/':
+            builder.append(consume());
+            break;
+        case 'b':
+            ignore();
+            builder.append('\b');
+            break;
+        case 'f':
+            ignore();
+            builder.append('\f');
+            break;
+        case 'n':
+            ignore();
+            builder.append('\n');
+            break;
+        case 'r':
+            ignore();
+            builder.append('\r');
+            break;
+        case 't':
+            ignore();
+            builder.append('\t');
+            break;
+        case 'u': {
+            ignore();
+            // NOTE: Surrogate pairs are combined into a single code point, while lone surrogates are kept as they are,
+            //       just like they would be in a JS string literal.
+            auto code_point = decode_single_or_paired_surrogate();
+            if (code_point.is_error())
+                return syntax_error();
+            builder.append_code_point(code_point.value());
+            break;
+        }
+        default:
+            return syntax_error();
+        }
+
+        auto length = count_plain_string_bytes(m_input.bytes().slice(tell()));
+        builder.append(m_input.substring_view(tell(), length));
+        m_index += length;
+    }
+
+    return ParsedString { {}, builder.to_string_without_validation() };
+}
+
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/FlyString.h>
+#include <AK/GenericLexer.h>
+#include <AK/Vector.h>
+#include <LibGC/Ptr.h>
+#include <LibJS/Forward.h>
+#include <LibJS/Runtime/Completion.h>
+#include <LibJS/Runtime/Value.h>
+
+namespace JS {
+
+// Parses a JSON text as specified in ECMA-404 straight into JS values, without building an AK::JsonValue first.
+class JSONParser : private GenericLexer {
+public:
+    static ThrowCompletionOr<Value> parse(VM&, StringView text);
+
+private:
+    JSONParser(VM&, StringView text);
+
+    struct ParsedString {
+        // Strings without escape sequences are referenced straight from the JSON text.
+        StringView raw;
+        Optional<String> unescaped;
+
+        StringView view() const { return unescaped.has_value() ? unescaped->bytes_as_string_view() : raw; }
+    };
+
+    ThrowCompletionOr<Value> parse_value(size_t depth);
+    ThrowCompletionOr<Value> parse_object(size_t depth);
+    ThrowCompletionOr<Value> parse_array(size_t depth);
+    ThrowCompletionOr<Value> parse_number();
+    ThrowCompletionOr<Value> parse_string();
+    ThrowCompletionOr<Value> parse_literal(StringView, Value);
+    ThrowCompletionOr<ParsedString> consume_string();
+
+    void skip_whitespace();
+    ThrowCompletionOr<void> consume_or_throw(char);
+    Completion syntax_error() const;
+
+    // The shape of the last object that was parsed at each nesting depth, if it only had unique keys that aren't
+    // array indices. Objects in JSON texts tend to come in runs with the same keys in the same order (e.g. the rows of
+    // a table), which can then reuse that shape as is, instead of transitioning to it one property at a time.
+    struct ShapeHint {
+        GC::Ptr<Shape> shape;
+        Vector<FlyString> keys;
+    };
+    ShapeHint* shape_hint_for_depth(size_t depth);
+
+    VM& m_vm;
+    Vector<ShapeHint> m_shape_hints;
+};
+
+}
@@ -155,6 +155,9 @@ public:
     //       might not hold when property access behaves differently.
     bool may_interfere_with_indexed_property_access() const { return m_may_interfere_with_indexed_property_access; }
 
+    // NOTE: Intrinsic accessors are materialized on first access, so storage can't be read directly while any are left.
+    bool has_intrinsic_accessors() const { return m_has_intrinsic_accessors; }
+
     ThrowCompletionOr<bool> ordinary_set_with_own_descriptor(PropertyKey const&, Value, Value, Optional<PropertyDescriptor>, CacheablePropertyMetadata* = nullptr, PropertyLookupPhase = PropertyLookupPhase::OwnProperty);
 
     // 10.4.7 Immutable Prototype Exotic Objects, https://tc39.es/ecma262/#sec-immutable-prototype-exotic-objects
@@ -21,6 +21,7 @@
 #include <LibGC/RootVector.h>
 #include <LibJS/CyclicModule.h>
 #include <LibJS/ModuleLoading.h>
+#include <LibJS/ScriptCache.h>
 #include <LibJS/Runtime/Agent.h>
 #include <LibJS/Runtime/CommonPropertyNames.h>
 #include <LibJS/Runtime/Completion.h>
@@ -256,6 +257,8 @@ public:
     Function<void(Promise&)> on_promise_rejection_handled;
     Function<void(Object const&, PropertyKey const&)> on_unimplemented_property_access;
 
+    ScriptCache& script_cache() { return m_script_cache; }
+
     void set_agent(OwnPtr<Agent> agent) { m_agent = move(agent); }
     Agent* agent() { return m_agent; }
     Agent const* agent() const { return m_agent; }
@@ -354,6 +357,9 @@ private:
 
     OwnPtr<Bytecode::Interpreter> m_bytecode_interpreter;
 
+    // NOTE: This holds roots into m_heap, so it must be destroyed before it.
+    ScriptCache m_script_cache;
+
     bool m_dynamic_imports_allowed { false };
 };
 
@@ -369,4 +375,27 @@ template<typename GlobalObjectType, typename... Args>
     return root_execution_context;
 }
 
+// Keeps a realm's root execution context alive for as long as it's in scope, for code that sets up a realm of its own
+// to run something in, like the js REPL and benchmarks.
+class RootExecutionContextScope {
+    AK_MAKE_NONCOPYABLE(RootExecutionContextScope);
+    AK_MAKE_NONMOVABLE(RootExecutionContextScope);
+
+public:
+    RootExecutionContextScope(VM& vm, NonnullOwnPtr<ExecutionContext> root_execution_context)
+        : m_vm(vm)
+        , m_root_execution_context(move(root_execution_context))
+    {
+    }
+
+    // NOTE: Realm initialization leaves the root execution context on the stack; take it back off once we're done.
+    ~RootExecutionContextScope() { m_vm.pop_execution_context(); }
+
+    Realm& realm() const { return *m_root_execution_context->realm; }
+
+private:
+    VM& m_vm;
+    NonnullOwnPtr<ExecutionContext> m_root_execution_context;
+};
+
 }
@@ -9,14 +9,25 @@
 #include <LibJS/Parser.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibJS/Script.h>
+#include <LibJS/ScriptCache.h>
 
 namespace JS {
 
 GC_DEFINE_ALLOCATOR(Script);
 
 // 16.1.5 ParseScript ( sourceText, realm, hostDefined ), https://tc39.es/ecma262/#sec-parse-script
-Result<GC::Ref<Script>, Vector<ParserError>> Script::parse(StringView source_text, Realm& realm, StringView filename, HostDefined* host_defined, size_t line_number_offset)
+Result<GC::Ref<Script>, Vector<ParserError>> Script::parse(StringView source_text, Realm& realm, StringView filename, HostDefined* host_defined, size_t line_number_offset, Optional<StringView> cache_partition_key)
 {
+    auto& script_cache = realm.vm().script_cache();
+
+    // OPTIMIZATION: If we have parsed this exact script before, reuse its AST (and the bytecode hanging off of it).
+    if (cache_partition_key.has_value()) {
+        if (auto cached_script = script_cache.find(*cache_partition_key, filename, line_number_offset, source_text))
+            return realm.heap().allocate<Script>(realm, filename, cached_script.release_nonnull(), host_defined);
+    }
+
+    auto parse_start_time = MonotonicTime::now();
+
     // 1. Let script be ParseText(sourceText, Script).
     auto parser = Parser(Lexer(source_text, filename, line_number_offset));
     auto script = parser.parse_program();
@@ -25,6 +36,9 @@ Result<GC::Ref<Script>, Vector<ParserError>> Script::parse(StringView source_tex
     if (parser.has_errors())
         return parser.errors();
 
+    if (cache_partition_key.has_value())
+        script_cache.add(*cache_partition_key, filename, line_number_offset, script, MonotonicTime::now() - parse_start_time);
+
     // 3. Return Script Record { [[Realm]]: realm, [[ECMAScriptCode]]: script, [[HostDefined]]: hostDefined }.
     return realm.heap().allocate<Script>(realm, filename, move(script), host_defined);
 }
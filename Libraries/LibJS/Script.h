@@ -35,7 +35,8 @@ public:
     };
 
     virtual ~Script() override;
-    static Result<GC::Ref<Script>, Vector<ParserError>> parse(StringView source_text, Realm&, StringView filename = {}, HostDefined* = nullptr, size_t line_number_offset = 1);
+    // Scripts are only looked up in and added to the VM's ScriptCache if a cache partition key is given.
+    static Result<GC::Ref<Script>, Vector<ParserError>> parse(StringView source_text, Realm&, StringView filename = {}, HostDefined* = nullptr, size_t line_number_offset = 1, Optional<StringView> cache_partition_key = {});
 
     Realm& realm() { return *m_realm; }
     Program const& parse_node() const { return *m_parse_node; }
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/AST.h>
+#include <LibJS/Bytecode/Executable.h>
+#include <LibJS/ScriptCache.h>
+
+namespace JS {
+
+ScriptCache::Entry::Entry(ByteString key, NonnullRefPtr<Program> program, size_t source_size, AK::Duration parse_time)
+    : key(move(key))
+    , program(move(program))
+    , source_size(source_size)
+    , parse_time(parse_time)
+{
+}
+
+ScriptCache::~ScriptCache() = default;
+
+ByteString ScriptCache::key_for(StringView partition_key, StringView filename, size_t line_number_offset)
+{
+    // NOTE: Neither partition keys nor URLs contain newlines, so this can't mistake one partition for another.
+    return ByteString::formatted("{}\n{}:{}", partition_key, filename, line_number_offset);
+}
+
+RefPtr<Program> ScriptCache::find(StringView partition_key, StringView filename, size_t line_number_offset, StringView source_text)
+{
+    auto it = m_entries.find(key_for(partition_key, filename, line_number_offset));
+    if (it == m_entries.end()) {
+        ++m_statistics.misses;
+        return nullptr;
+    }
+
+    auto& entry = *it->value;
+
+    // NOTE: The script behind a URL may have changed since we last saw it.
+    if (entry.program->source_code().code().bytes_as_string_view() != source_text) {
+        remove(entry);
+        ++m_statistics.misses;
+        return nullptr;
+    }
+
+    m_lru_list.remove(entry);
+    m_lru_list.append(entry);
+
+    ++m_statistics.hits;
+    m_statistics.time_saved += entry.parse_time;
+    return entry.program;
+}
+
+void ScriptCache::add(StringView partition_key, StringView filename, size_t line_number_offset, NonnullRefPtr<Program> program, AK::Duration parse_time)
+{
+    auto source_size = program->source_code().code().bytes().size();
+    if (source_size > maximum_total_source_size)
+        return;
+
+    auto key = key_for(partition_key, filename, line_number_offset);
+    if (auto it = m_entries.find(key); it != m_entries.end())
+        remove(*it->value);
+
+    while (m_total_source_size + source_size > maximum_total_source_size) {
+        remove(*m_lru_list.first());
+        ++m_statistics.evictions;
+    }
+
+    auto entry = make<Entry>(key, program, source_size, parse_time);
+    m_lru_list.append(*entry);
+    m_entries_by_program.set(program.ptr(), entry.ptr());
+    m_entries.set(move(key), move(entry));
+    m_total_source_size += source_size;
+}
+
+GC::Ptr<Bytecode::Executable> ScriptCache::find_executable(Program const& program)
+{
+    auto entry = m_entries_by_program.get(&program);
+    if (!entry.has_value() || !(*entry)->executable)
+        return nullptr;
+
+    m_statistics.time_saved += (*entry)->compile_time;
+    return (*entry)->executable.ptr();
+}
+
+void ScriptCache::add_executable(Program const& program, Bytecode::Executable& executable, AK::Duration compile_time)
+{
+    auto entry = m_entries_by_program.get(&program);
+    if (!entry.has_value())
+        return;
+
+    (*entry)->executable = make_root(executable);
+    (*entry)->compile_time = compile_time;
+}
+
+void ScriptCache::remove(Entry& entry)
+{
+    m_lru_list.remove(entry);
+    m_total_source_size -= entry.source_size;
+    m_entries_by_program.remove(entry.program.ptr());
+
+    auto key = entry.key;
+    m_entries.remove(key);
+}
+
+void ScriptCache::clear()
+{
+    m_lru_list.clear();
+    m_entries_by_program.clear();
+    m_entries.clear();
+    m_total_source_size = 0;
+}
+
+}
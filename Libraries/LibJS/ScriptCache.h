@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/HashMap.h>
+#include <AK/IntrusiveList.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Noncopyable.h>
+#include <AK/Time.h>
+#include <LibGC/Root.h>
+#include <LibJS/Forward.h>
+
+namespace JS {
+
+// Keeps the parsed form of recently loaded classic scripts around, keyed by a partition key chosen by the embedder,
+// their filename (URL) and line number offset, and validated against their source text. Loading the same script again
+// (on reload, or in another frame of the same partition) then skips both the parser and bytecode generation for the
+// top-level code. Functions keep their lazily generated bytecode on their AST nodes, so they are not recompiled either.
+//
+// NOTE: The cache lives on the VM, which is shared by everything running in the process. Whether a script was found in
+//       the cache shows in how long it takes to load, so embedders must partition entries at least as finely as they
+//       partition their HTTP caches.
+class ScriptCache {
+    AK_MAKE_NONCOPYABLE(ScriptCache);
+    AK_MAKE_NONMOVABLE(ScriptCache);
+
+public:
+    // The cache is bounded by the total size of the cached source text, as a proxy for the size of the ASTs.
+    static constexpr size_t maximum_total_source_size = 8 * MiB;
+
+    ScriptCache() = default;
+    ~ScriptCache();
+
+    RefPtr<Program> find(StringView partition_key, StringView filename, size_t line_number_offset, StringView source_text);
+    void add(StringView partition_key, StringView filename, size_t line_number_offset, NonnullRefPtr<Program>, AK::Duration parse_time);
+
+    // The bytecode for the top-level code of a cached script.
+    GC::Ptr<Bytecode::Executable> find_executable(Program const&);
+    void add_executable(Program const&, Bytecode::Executable&, AK::Duration compile_time);
+
+    struct Statistics {
+        u64 hits { 0 };
+        u64 misses { 0 };
+        u64 evictions { 0 };
+        AK::Duration time_saved;
+    };
+    Statistics const& statistics() const { return m_statistics; }
+
+    void clear();
+
+private:
+    struct Entry {
+        Entry(ByteString key, NonnullRefPtr<Program>, size_t source_size, AK::Duration parse_time);
+
+        ByteString key;
+        NonnullRefPtr<Program> program;
+        GC::Root<Bytecode::Executable> executable;
+        size_t source_size { 0 };
+        AK::Duration parse_time;
+        AK::Duration compile_time;
+
+        IntrusiveListNode<Entry> list_node;
+        using List = IntrusiveList<&Entry::list_node>;
+    };
+
+    static ByteString key_for(StringView partition_key, StringView filename, size_t line_number_offset);
+    void remove(Entry&);
+
+    HashMap<ByteString, NonnullOwnPtr<Entry>> m_entries;
+    HashMap<Program const*, Entry*> m_entries_by_program;
+
+    // Least recently used entries first.
+    Entry::List m_lru_list;
+    size_t m_total_source_size { 0 };
+
+    Statistics m_statistics;
+};
+
+}
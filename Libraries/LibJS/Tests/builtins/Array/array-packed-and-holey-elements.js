@@ -0,0 +1,159 @@
+describe("appending by storing past the end", () => {
+    test("grows the array", () => {
+        const array = [];
+        for (let i = 0; i < 100; ++i) array[i] = i;
+        expect(array).toHaveLength(100);
+        expect(array[0]).toBe(0);
+        expect(array[99]).toBe(99);
+        expect(Object.keys(array)).toHaveLength(100);
+    });
+
+    test("calls setters on Array.prototype", () => {
+        const array = [1, 2];
+        let setterValue;
+        Object.defineProperty(Array.prototype, 2, {
+            set(value) {
+                setterValue = value;
+            },
+            configurable: true,
+        });
+        try {
+            array[2] = 3;
+        } finally {
+            delete Array.prototype[2];
+        }
+        expect(setterValue).toBe(3);
+        expect(array).toHaveLength(2);
+    });
+
+    test("calls setters on Object.prototype", () => {
+        const array = [1, 2];
+        let setterValue;
+        Object.defineProperty(Object.prototype, 2, {
+            set(value) {
+                setterValue = value;
+            },
+            configurable: true,
+        });
+        try {
+            array[2] = 3;
+        } finally {
+            delete Object.prototype[2];
+        }
+        expect(setterValue).toBe(3);
+        expect(array).toHaveLength(2);
+    });
+
+    test("calls setters on a custom prototype", () => {
+        const prototype = Object.create(Array.prototype, {
+            1: {
+                set(value) {
+                    this.seen = value;
+                },
+            },
+        });
+        const array = [1];
+        Object.setPrototypeOf(array, prototype);
+        array[1] = 2;
+        expect(array.seen).toBe(2);
+        expect(array).toHaveLength(1);
+    });
+
+    test("does not extend non-extensible arrays", () => {
+        const array = Object.preventExtensions([1, 2]);
+        array[2] = 3;
+        expect(array).toHaveLength(2);
+        expect(array[2]).toBeUndefined();
+    });
+
+    test("does not extend arrays with a non-writable length", () => {
+        const array = [1, 2];
+        Object.defineProperty(array, "length", { writable: false });
+        array[2] = 3;
+        expect(array).toHaveLength(2);
+        expect(array[2]).toBeUndefined();
+    });
+});
+
+describe("holes", () => {
+    test("from elisions", () => {
+        const array = [1, , 3];
+        expect(1 in array).toBeFalse();
+        expect(array.indexOf(undefined)).toBe(-1);
+        expect(array.includes(undefined)).toBeTrue();
+    });
+
+    test("from deleting elements", () => {
+        const array = [1, 2, 3];
+        delete array[1];
+        expect(1 in array).toBeFalse();
+        expect(Object.keys(array)).toEqual(["0", "2"]);
+        expect(array.indexOf(undefined)).toBe(-1);
+        expect(array.includes(undefined)).toBeTrue();
+    });
+
+    test("from growing the length", () => {
+        const array = [1, 2, 3];
+        array.length = 5;
+        expect(3 in array).toBeFalse();
+        expect(Object.keys(array)).toEqual(["0", "1", "2"]);
+        expect(array.indexOf(undefined)).toBe(-1);
+    });
+
+    test("from storing beyond the end", () => {
+        const array = [1];
+        array[3] = 4;
+        expect(array).toHaveLength(4);
+        expect(Object.keys(array)).toEqual(["0", "3"]);
+    });
+
+    test("are looked up in the prototype chain", () => {
+        const array = [1, , 3];
+        Array.prototype[1] = 2;
+        try {
+            expect(array[1]).toBe(2);
+            expect(array.indexOf(2)).toBe(1);
+            expect(array.includes(2)).toBeTrue();
+        } finally {
+            delete Array.prototype[1];
+        }
+    });
+});
+
+describe("element kinds", () => {
+    test("numeric arrays can hold other values after all", () => {
+        const array = [1, 2, 3];
+        expect(array.indexOf("2")).toBe(-1);
+        expect(array.includes("2")).toBeFalse();
+        array[1] = "2";
+        expect(array.indexOf("2")).toBe(1);
+        expect(array.includes("2")).toBeTrue();
+        array.push(null);
+        expect(array.indexOf(null)).toBe(3);
+    });
+
+    test("integer arrays can hold doubles after all", () => {
+        const array = [1, 2, 3];
+        array[0] = 0.5;
+        expect(array.indexOf(0.5)).toBe(0);
+        expect(array.includes(NaN)).toBeFalse();
+        array[2] = NaN;
+        expect(array.indexOf(NaN)).toBe(-1);
+        expect(array.includes(NaN)).toBeTrue();
+    });
+
+    test("fromIndex is converted before looking at the elements", () => {
+        const shrinkingFromIndex = array => ({
+            valueOf() {
+                array.length = 1;
+                return 0;
+            },
+        });
+
+        const array = [1, 2, 3];
+        expect(array.indexOf(3, shrinkingFromIndex(array))).toBe(-1);
+
+        const otherArray = [1, 2, 3];
+        expect(otherArray.includes(undefined, shrinkingFromIndex(otherArray))).toBeTrue();
+    });
+});
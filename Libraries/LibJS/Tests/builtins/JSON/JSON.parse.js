@@ -74,3 +74,75 @@ test("does not truncate large integers", () => {
     expect(JSON.parse("18446744073709551616")).toEqual(18446744073709551616);
     expect(JSON.parse("18446744073709551617")).toEqual(18446744073709551617);
 });
+
+test("strings", () => {
+    expect(JSON.parse('""')).toBe("");
+    expect(JSON.parse('"a string that is longer than sixteen bytes"')).toBe(
+        "a string that is longer than sixteen bytes"
+    );
+    expect(JSON.parse('"\\"\\\\\\/\\b\\f\\n\\r\\t"')).toBe('"\\/\b\f\n\r\t');
+    expect(JSON.parse('"escapes \\n in the middle of a long string \\t and at the end\\n"')).toBe(
+        "escapes \n in the middle of a long string \t and at the end\n"
+    );
+    expect(JSON.parse('"\\u0041\\u00e9\\u20AC"')).toBe("Aé€");
+    expect(JSON.parse('"\\ud83d\\ude04"')).toBe("😄");
+    expect(JSON.parse('"\\ud83d"')).toBe("\ud83d");
+    expect(JSON.parse('"héllo wörld, ünïcödé text longer than sixteen bytes 😄"')).toBe(
+        "héllo wörld, ünïcödé text longer than sixteen bytes 😄"
+    );
+
+    ['"unterminated', '"unterminated string that is longer than sixteen bytes', '"\\x"', '"\\u12"', '"\t"', '"\n"'].forEach(
+        text => {
+            expect(() => JSON.parse(text)).toThrow(SyntaxError);
+        }
+    );
+});
+
+test("numbers", () => {
+    expect(JSON.parse("0")).toBe(0);
+    expect(JSON.parse("-1")).toBe(-1);
+    expect(JSON.parse("1.5")).toBe(1.5);
+    expect(JSON.parse("1e3")).toBe(1000);
+    expect(JSON.parse("1E+3")).toBe(1000);
+    expect(JSON.parse("25e-1")).toBe(2.5);
+    expect(JSON.parse("-999999999999999")).toBe(-999999999999999);
+
+    ["01", "-", "1.", ".5", "1e", "1e+", "+1", "--1", "0x10"].forEach(text => {
+        expect(() => JSON.parse(text)).toThrow(SyntaxError);
+    });
+});
+
+test("objects with the same keys", () => {
+    const rows = JSON.parse('[{"a":1,"b":"x"},{"a":2,"b":"y"},{"a":3,"b":"z"},{"b":4,"a":5},{"a":6}]');
+    expect(rows).toEqual([{ a: 1, b: "x" }, { a: 2, b: "y" }, { a: 3, b: "z" }, { b: 4, a: 5 }, { a: 6 }]);
+    expect(Object.keys(rows[2])).toEqual(["a", "b"]);
+    expect(Object.keys(rows[3])).toEqual(["b", "a"]);
+
+    rows[1].c = true;
+    expect(rows[1].c).toBeTrue();
+    expect(rows[2].c).toBeUndefined();
+});
+
+test("objects with duplicate keys", () => {
+    const objects = JSON.parse('[{"a":1,"b":2},{"a":1,"a":2},{"a":1,"b":2,"a":3}]');
+    expect(objects[1]).toEqual({ a: 2 });
+    expect(objects[2]).toEqual({ a: 3, b: 2 });
+    expect(Object.keys(objects[2])).toEqual(["a", "b"]);
+});
+
+test("objects with array index keys", () => {
+    const objects = JSON.parse('[{"0":"a","b":1},{"0":"c","b":2}]');
+    expect(objects[0][0]).toBe("a");
+    expect(objects[1][0]).toBe("c");
+    expect(objects[1].b).toBe(2);
+});
+
+test("__proto__ is an ordinary key", () => {
+    const object = JSON.parse('{"__proto__":{"a":1}}');
+    expect(Object.getPrototypeOf(object)).toBe(Object.prototype);
+    expect(Object.getOwnPropertyNames(object)).toEqual(["__proto__"]);
+});
+
+test("deeply nested input", () => {
+    expect(() => JSON.parse("[".repeat(1000000))).toThrow();
+});
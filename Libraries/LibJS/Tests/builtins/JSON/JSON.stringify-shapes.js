@@ -0,0 +1,135 @@
+describe("objects with the same shape", () => {
+    test("are serialized with their own values", () => {
+        const records = [];
+        for (let i = 0; i < 5; ++i) records.push({ id: i, name: `record ${i}`, active: i % 2 === 0 });
+        expect(JSON.stringify(records)).toBe(
+            '[{"id":0,"name":"record 0","active":true},{"id":1,"name":"record 1","active":false},' +
+                '{"id":2,"name":"record 2","active":true},{"id":3,"name":"record 3","active":false},' +
+                '{"id":4,"name":"record 4","active":true}]'
+        );
+    });
+
+    test("skip properties that serialize to undefined", () => {
+        const records = [
+            { a: 1, b: undefined, c: 3 },
+            { a: undefined, b: () => {}, c: Symbol() },
+            { a: 1, b: 2, c: undefined },
+        ];
+        expect(JSON.stringify(records)).toBe('[{"a":1,"c":3},{},{"a":1,"b":2}]');
+    });
+
+    test("can have accessors where other objects have data properties", () => {
+        const plain = { a: 1, b: 2 };
+        const withGetter = { a: 1, b: 2 };
+        Object.defineProperty(withGetter, "b", {
+            get() {
+                return "from getter";
+            },
+        });
+        expect(JSON.stringify([plain, withGetter, plain])).toBe(
+            '[{"a":1,"b":2},{"a":1,"b":"from getter"},{"a":1,"b":2}]'
+        );
+    });
+
+    test("keep the original keys when a getter changes the object", () => {
+        const object = {
+            get first() {
+                delete this.second;
+                this.third = "changed";
+                this.fourth = "added";
+                return 1;
+            },
+            second: 2,
+            third: 3,
+        };
+        expect(JSON.stringify(object)).toBe('{"first":1,"third":"changed"}');
+    });
+
+    test("escape their keys", () => {
+        expect(JSON.stringify([{ 'a"b': 1, "c\nd": 2 }, { 'a"b': 3, "c\nd": 4 }])).toBe(
+            '[{"a\\"b":1,"c\\nd":2},{"a\\"b":3,"c\\nd":4}]'
+        );
+    });
+
+    test("use toJSON methods that show up along the way", () => {
+        const records = [{ a: 1 }, { a: 2 }, { a: 3 }];
+        const object = {
+            toJSON() {
+                Object.prototype.toJSON = function () {
+                    return "from prototype";
+                };
+                return "from object";
+            },
+        };
+        try {
+            expect(JSON.stringify([records[0], object, records[1]])).toBe(
+                '[{"a":1},"from object","from prototype"]'
+            );
+        } finally {
+            delete Object.prototype.toJSON;
+        }
+    });
+});
+
+describe("objects that aren't plain", () => {
+    test("wrapper objects with %Object.prototype%", () => {
+        const number = Object.setPrototypeOf(new Number(42), Object.prototype);
+        const boolean = Object.setPrototypeOf(new Boolean(true), Object.prototype);
+        // NOTE: ToNumber() ends up with "[object Number]" from Object.prototype.toString.
+        expect(JSON.stringify({ number })).toBe('{"number":null}');
+        expect(JSON.stringify({ boolean })).toBe('{"boolean":true}');
+    });
+
+    test("arrays with %Object.prototype%", () => {
+        const array = Object.setPrototypeOf([1, 2], Object.prototype);
+        expect(JSON.stringify({ array })).toBe('{"array":[1,2]}');
+    });
+
+    test("functions with %Object.prototype%", () => {
+        const func = Object.setPrototypeOf(() => {}, Object.prototype);
+        expect(JSON.stringify({ func, a: 1 })).toBe('{"a":1}');
+    });
+
+    test("objects with integer keys", () => {
+        expect(JSON.stringify({ b: 1, 1: 2, a: 3, 0: 4 })).toBe('{"0":4,"1":2,"b":1,"a":3}');
+    });
+});
+
+describe("arrays", () => {
+    test("holes are looked up in the prototype chain", () => {
+        const array = [1, , 3];
+        Array.prototype[1] = "from prototype";
+        try {
+            expect(JSON.stringify(array)).toBe('[1,"from prototype",3]');
+        } finally {
+            delete Array.prototype[1];
+        }
+        expect(JSON.stringify(array)).toBe("[1,null,3]");
+    });
+
+    test("keep their original length when shrunk along the way", () => {
+        const array = [
+            1,
+            {
+                toJSON() {
+                    array.length = 1;
+                    return 2;
+                },
+            },
+            3,
+        ];
+        expect(JSON.stringify(array)).toBe("[1,2,null]");
+    });
+
+    test("with a toJSON method of their own", () => {
+        const array = [1, 2];
+        array.toJSON = () => "from array";
+        expect(JSON.stringify({ array })).toBe('{"array":"from array"}');
+    });
+
+    test("numbers", () => {
+        expect(JSON.stringify([0, -0, 1.5, -2, NaN, Infinity, 1e21, 2 ** 31])).toBe(
+            "[0,0,1.5,-2,null,null,1e+21,2147483648]"
+        );
+    });
+});
@@ -0,0 +1,119 @@
+// NOTE: Bytecode goes through optimization passes before it runs, so these check that the patterns they rewrite
+//       (moves into and out of temporaries, jumps to jumps, loops) still behave the same.
+
+test("values passed through temporaries", () => {
+    let a = 1;
+    expect(a + (a = 5)).toBe(6);
+    expect(a).toBe(5);
+
+    let b = 2;
+    b = b * b + (b = 3) - b;
+    expect(b).toBe(4);
+
+    let c = "x";
+    let d = c;
+    c = c + d;
+    d = c + d;
+    expect([c, d]).toEqual(["xx", "xxx"]);
+});
+
+test("swapping values", () => {
+    let a = 1;
+    let b = 2;
+    [a, b] = [b, a];
+    expect([a, b]).toEqual([2, 1]);
+
+    let t = a;
+    a = b;
+    b = t;
+    expect([a, b]).toEqual([1, 2]);
+});
+
+test("loops with conditions of every kind", () => {
+    let sum = 0;
+    for (let i = 0; i < 10; ++i) sum += i;
+    expect(sum).toBe(45);
+
+    let count = 0;
+    for (let i = 10; i !== 0; i--) count++;
+    expect(count).toBe(10);
+
+    let value = { next: { next: { next: null } } };
+    let depth = 0;
+    while (value != null) {
+        value = value.next;
+        depth++;
+    }
+    expect(depth).toBe(3);
+
+    let n = 0;
+    do {
+        n += 2;
+    } while (n < 7);
+    expect(n).toBe(8);
+});
+
+test("nested loops with break and continue", () => {
+    const pairs = [];
+    outer: for (let i = 0; i < 4; ++i) {
+        for (let j = 0; j < 4; ++j) {
+            if (j > i) continue outer;
+            if (i === 3) break outer;
+            pairs.push(i * 10 + j);
+        }
+    }
+    expect(pairs).toEqual([0, 10, 11, 20, 21, 22]);
+});
+
+test("loop conditions that throw inside try", () => {
+    let calls = 0;
+    const limit = {
+        valueOf() {
+            if (++calls > 3) throw new Error("too many");
+            return 10;
+        },
+    };
+    let i = 0;
+    try {
+        for (; i < limit; ++i) {}
+        expect().fail();
+    } catch (e) {
+        expect(e.message).toBe("too many");
+    }
+    expect(i).toBe(3);
+});
+
+test("jumps out of finally blocks", () => {
+    const log = [];
+    for (let i = 0; i < 3; ++i) {
+        try {
+            if (i === 1) continue;
+            log.push(`try ${i}`);
+        } finally {
+            log.push(`finally ${i}`);
+        }
+    }
+    expect(log).toEqual(["try 0", "finally 0", "finally 1", "try 2", "finally 2"]);
+});
+
+test("unreachable code after return", () => {
+    function f(x) {
+        if (x) return "yes";
+        else return "no";
+        return "unreachable";
+    }
+    expect(f(true)).toBe("yes");
+    expect(f(false)).toBe("no");
+});
+
+test("generators keep their values across yields", () => {
+    function* g() {
+        let a = 1;
+        for (let i = 0; i < 3; ++i) {
+            let b = a + i;
+            yield b;
+            a = b * 2;
+        }
+    }
+    expect([...g()]).toEqual([1, 3, 8]);
+});
@@ -16,3 +16,16 @@ test("Inline cache invalidated by deleting property from unique shape", () => {
     expect(first).toBe(2);
     expect(second).toBeUndefined();
 });
+
+test("Inline cache hit on own property turned into accessor", () => {
+    function ic(o) {
+        return o.x;
+    }
+
+    let o = { x: 1 };
+    expect(ic(o)).toBe(1);
+    expect(ic(o)).toBe(1);
+
+    Object.defineProperty(o, "x", { get: () => 2 });
+    expect(ic(o)).toBe(2);
+});
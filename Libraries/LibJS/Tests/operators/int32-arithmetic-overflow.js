@@ -0,0 +1,40 @@
+test("int32 addition, subtraction and multiplication overflow into doubles", () => {
+    const max = 2147483647;
+    const min = -2147483648;
+
+    expect(max + 1).toBe(2147483648);
+    expect(min - 1).toBe(-2147483649);
+    expect(max * 2).toBe(4294967294);
+    expect(min * -1).toBe(2147483648);
+});
+
+test("int32 increment and decrement overflow into doubles", () => {
+    let a = 2147483647;
+    a++;
+    expect(a).toBe(2147483648);
+
+    let b = -2147483648;
+    b--;
+    expect(b).toBe(-2147483649);
+});
+
+test("int32 arithmetic in hot loops", () => {
+    let sum = 0;
+    for (let i = 0; i < 100000; ++i) sum = sum + i * 2 - 1;
+    expect(sum).toBe(9999800000);
+
+    let count = 100000;
+    while (count > 0) --count;
+    expect(count).toBe(0);
+});
+
+test("int32 fast paths fall back for non-int32 operands", () => {
+    expect(1 + "1").toBe("11");
+    expect(1.5 + 1).toBe(2.5);
+    expect(3 - { valueOf: () => 1 }).toBe(2);
+    expect(2n * 3n).toBe(6n);
+
+    let s = "5";
+    s++;
+    expect(s).toBe(6);
+});
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/CharacterTypes.h>
+#include <AK/HashTable.h>
+#include <AK/QuickSort.h>
+#include <LibRegex/RegexByteCode.h>
+#include <LibRegex/RegexDFA.h>
+
+namespace regex {
+
+// Marks the key of a state whose positions include the end of the bytecode.
+static constexpr size_t accepting_marker = NumericLimits<size_t>::max();
+
+unsigned LazyDFA::PositionsTraits::hash(Vector<size_t> const& positions)
+{
+    unsigned hash = 0;
+    for (auto position : positions)
+        hash = pair_int_hash(hash, u64_hash(position));
+    return hash;
+}
+
+LazyDFA::Result LazyDFA::find(ByteCode const& bytecode, MatchInput const& input, size_t position)
+{
+    // NOTE: The options decide what the Compare ops accept (e.g. case insensitivity), so the states built for some
+    //       options don't apply to others.
+    if (!m_options.has_value() || m_options->value() != input.regex_options.value())
+        reset(bytecode, input.regex_options);
+
+    if (m_gave_up)
+        return Result::MayMatch;
+
+    auto length = input.view.length();
+    auto current = m_start_state;
+    for (;; ++position) {
+        auto const& state = m_states[current];
+        if (state.is_accepting)
+            return Result::MayMatch;
+        if (state.compare_positions.is_empty() || position >= length)
+            return Result::NoMatch;
+
+        auto next = transition(bytecode, input, current, position);
+        if (!next.has_value())
+            return Result::MayMatch;
+        current = *next;
+    }
+}
+
+void LazyDFA::reset(ByteCode const& bytecode, AllOptions options)
+{
+    m_options = options;
+    m_gave_up = false;
+    m_states.clear();
+    m_state_indices.clear();
+
+    if (auto start_state = state_for(bytecode, { 0 }); start_state.has_value())
+        m_start_state = *start_state;
+}
+
+Optional<LazyDFA::StateIndex> LazyDFA::state_for(ByteCode const& bytecode, Vector<size_t> seed_positions)
+{
+    // Follow everything that doesn't consume input, to find all the Compare ops that the bytecode could continue with.
+    auto state = MatchState::only_for_enumeration();
+    Vector<size_t> compare_positions;
+    bool is_accepting = false;
+    HashTable<size_t> seen_positions;
+
+    auto& positions_to_visit = seed_positions;
+    while (!positions_to_visit.is_empty()) {
+        auto position = positions_to_visit.take_last();
+        if (seen_positions.set(position) != HashSetResult::InsertedNewEntry)
+            continue;
+
+        state.instruction_position = position;
+        auto& opcode = bytecode.get_opcode(state);
+        auto next_position = position + opcode.size();
+
+        switch (opcode.opcode_id()) {
+        case OpCodeId::Compare:
+            compare_positions.append(position);
+            break;
+        case OpCodeId::Exit:
+            // NOTE: Exit only succeeds once the bytecode has run out.
+            if (position >= bytecode.size())
+                is_accepting = true;
+            break;
+        case OpCodeId::Jump:
+            positions_to_visit.append(next_position + static_cast<OpCode_Jump const&>(opcode).offset());
+            break;
+        case OpCodeId::ForkJump:
+        case OpCodeId::ForkReplaceJump:
+            positions_to_visit.append(next_position);
+            positions_to_visit.append(next_position + static_cast<OpCode_ForkJump const&>(opcode).offset());
+            break;
+        case OpCodeId::ForkStay:
+        case OpCodeId::ForkReplaceStay:
+            positions_to_visit.append(next_position);
+            positions_to_visit.append(next_position + static_cast<OpCode_ForkStay const&>(opcode).offset());
+            break;
+        case OpCodeId::JumpNonEmpty:
+            // NOTE: Whether this jumps depends on what the loop consumed, so assume it can go either way.
+            positions_to_visit.append(next_position);
+            positions_to_visit.append(next_position + static_cast<OpCode_JumpNonEmpty const&>(opcode).offset());
+            break;
+        case OpCodeId::Repeat:
+            // NOTE: Without the repetition count, this can go back for another round or move on at any time.
+            positions_to_visit.append(next_position);
+            positions_to_visit.append(position - static_cast<OpCode_Repeat const&>(opcode).offset());
+            break;
+        case OpCodeId::ResetRepeat:
+        case OpCodeId::Checkpoint:
+        case OpCodeId::SaveLeftCaptureGroup:
+        case OpCodeId::SaveRightCaptureGroup:
+        case OpCodeId::SaveRightNamedCaptureGroup:
+        case OpCodeId::ClearCaptureGroup:
+        case OpCodeId::CheckBegin:
+        case OpCodeId::CheckEnd:
+        case OpCodeId::CheckBoundary:
+            positions_to_visit.append(next_position);
+            break;
+        default:
+            // Lookaround moves back and forth in the input, which a DFA can't follow.
+            m_gave_up = true;
+            return {};
+        }
+    }
+
+    quick_sort(compare_positions);
+
+    auto key = compare_positions;
+    if (is_accepting)
+        key.append(accepting_marker);
+    if (auto index = m_state_indices.get(key); index.has_value())
+        return *index;
+
+    if (m_states.size() >= max_state_count) {
+        m_gave_up = true;
+        return {};
+    }
+
+    StateIndex index = m_states.size();
+    m_states.append({ .compare_positions = move(compare_positions), .is_accepting = is_accepting, .transitions = {}, .other_transitions = {} });
+    m_states.last().transitions.fill(unknown_state);
+    m_state_indices.set(move(key), index);
+    return index;
+}
+
+Optional<LazyDFA::StateIndex> LazyDFA::transition(ByteCode const& bytecode, MatchInput const& input, StateIndex state_index, size_t position)
+{
+    auto code_unit = input.view.code_unit_at(position);
+
+    // NOTE: Some compares look at the whole code point at a position, so what they do with a surrogate depends on
+    //       the code unit next to it; these can't be cached.
+    auto is_cacheable = !is_unicode_surrogate(code_unit);
+
+    if (code_unit < cached_code_unit_count) {
+        if (auto next = m_states[state_index].transitions[code_unit]; next != unknown_state)
+            return next;
+    } else if (is_cacheable) {
+        if (auto next = m_states[state_index].other_transitions.get(code_unit); next.has_value())
+            return *next;
+    }
+
+    // NOTE: Creating the next state may grow m_states, so hold on to a copy of the positions.
+    auto compare_positions = m_states[state_index].compare_positions;
+
+    auto state = MatchState::only_for_enumeration();
+    Vector<size_t> next_positions;
+    for (auto compare_position : compare_positions) {
+        state.instruction_position = compare_position;
+        state.string_position = position;
+        state.string_position_in_code_units = position;
+
+        auto& opcode = bytecode.get_opcode(state);
+        if (opcode.execute(input, state) != ExecutionResult::Continue)
+            continue;
+
+        if (state.string_position != position + 1) {
+            m_gave_up = true;
+            return {};
+        }
+        next_positions.append(compare_position + opcode.size());
+    }
+
+    if (m_anchoring == Anchoring::Unanchored)
+        next_positions.append(0);
+
+    auto next = state_for(bytecode, move(next_positions));
+    if (!next.has_value())
+        return {};
+
+    if (code_unit < cached_code_unit_count)
+        m_states[state_index].transitions[code_unit] = *next;
+    else if (is_cacheable)
+        m_states[state_index].other_transitions.set(code_unit, *next);
+    return next;
+}
+
+}
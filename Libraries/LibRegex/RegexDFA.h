@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include "Forward.h"
+#include "RegexMatch.h"
+#include "RegexOptions.h"
+
+#include <AK/Array.h>
+#include <AK/HashMap.h>
+#include <AK/NumericLimits.h>
+#include <AK/Optional.h>
+#include <AK/Vector.h>
+
+namespace regex {
+
+// A DFA over the bytecode of a pattern that the optimizer has found to be regular, whose states are only built once
+// the input reaches them. It ignores assertions and lets counted repetitions repeat any number of times, so it accepts
+// a superset of what the bytecode matches: it can tell for certain where a match *can't* be found, which lets the
+// matcher skip running the backtracking bytecode there.
+class LazyDFA {
+public:
+    enum class Anchoring {
+        // Whether a match can start at the given position.
+        Anchored,
+        // Whether a match can start anywhere at or after the given position.
+        Unanchored,
+    };
+
+    enum class Result {
+        NoMatch,
+        MayMatch,
+    };
+
+    explicit LazyDFA(Anchoring anchoring)
+        : m_anchoring(anchoring)
+    {
+    }
+
+    // NOTE: This only supports input in which every character is a single code unit (i.e. not in unicode mode).
+    Result find(ByteCode const&, MatchInput const&, size_t position);
+
+private:
+    using StateIndex = u32;
+    static constexpr StateIndex unknown_state = NumericLimits<StateIndex>::max();
+    static constexpr size_t max_state_count = 1024;
+    static constexpr size_t cached_code_unit_count = 256;
+
+    struct State {
+        // The positions of the Compare ops that the bytecode could be at, in order.
+        Vector<size_t> compare_positions;
+        bool is_accepting { false };
+        Array<StateIndex, cached_code_unit_count> transitions;
+        HashMap<u32, StateIndex> other_transitions;
+    };
+
+    struct PositionsTraits : DefaultTraits<Vector<size_t>> {
+        static unsigned hash(Vector<size_t> const&);
+    };
+
+    void reset(ByteCode const&, AllOptions);
+    Optional<StateIndex> state_for(ByteCode const&, Vector<size_t> seed_positions);
+    Optional<StateIndex> transition(ByteCode const&, MatchInput const&, StateIndex, size_t position);
+
+    Anchoring m_anchoring;
+    bool m_gave_up { false };
+    Optional<AllOptions> m_options;
+    Vector<State> m_states;
+    HashMap<Vector<size_t>, StateIndex, PositionsTraits> m_state_indices;
+    StateIndex m_start_state { 0 };
+};
+
+}
@@ -8,6 +8,8 @@
 #include <AK/BumpAllocator.h>
 #include <AK/ByteString.h>
 #include <AK/Debug.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
 #include <AK/StringBuilder.h>
 #include <LibRegex/RegexMatcher.h>
 #include <LibRegex/RegexParser.h>
@@ -155,6 +157,56 @@ RegexResult Matcher<Parser>::match(RegexStringView view, Optional<typename Parse
     return match(views, regex_options);
 }
 
+template<typename VectorType>
+static VectorType splat(AK::SIMD::ElementOf<VectorType> value)
+{
+    VectorType result {};
+    for (size_t i = 0; i < AK::SIMD::vector_length<VectorType>; ++i)
+        result[i] = value;
+    return result;
+}
+
+// Finds the first offset at or after `start` where `needle` occurs in `haystack`.
+template<typename VectorType, typename CodeUnit>
+static Optional<size_t> find_literal(ReadonlySpan<CodeUnit> haystack, ReadonlySpan<CodeUnit> needle, size_t start)
+{
+    using namespace AK::SIMD;
+
+    VERIFY(!needle.is_empty());
+    if (haystack.size() < needle.size())
+        return {};
+
+    auto last_start = haystack.size() - needle.size();
+    auto occurs_at = [&](size_t offset) {
+        return __builtin_memcmp(haystack.data() + offset, needle.data(), needle.size() * sizeof(CodeUnit)) == 0;
+    };
+
+    // OPTIMIZATION: Look at a whole vector of offsets at a time, and only compare the entire needle at the offsets where
+    //               both its first and its last code unit line up.
+    constexpr auto lanes = vector_length<VectorType>;
+    auto first = splat<VectorType>(needle.first());
+    auto last = splat<VectorType>(needle.last());
+
+    auto offset = start;
+    for (; offset + lanes <= last_start + 1; offset += lanes) {
+        auto candidates = (load_unaligned<VectorType>(haystack.data() + offset) == first)
+            & (load_unaligned<VectorType>(haystack.data() + offset + needle.size() - 1) == last);
+        auto candidate_halves = bit_cast<u64x2>(candidates);
+        if ((candidate_halves[0] | candidate_halves[1]) == 0)
+            continue;
+        for (size_t lane = 0; lane < lanes; ++lane) {
+            if (candidates[lane] && occurs_at(offset + lane))
+                return offset + lane;
+        }
+    }
+
+    for (; offset <= last_start; ++offset) {
+        if (occurs_at(offset))
+            return offset;
+    }
+    return {};
+}
+
 template<typename Parser>
 RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optional<typename ParserTraits<Parser>::OptionsType> regex_options) const
 {
@@ -209,6 +261,42 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
     auto single_match_only = input.regex_options.has_flag_set(AllFlags::SingleMatch);
     auto only_start_of_line = m_pattern->parser_result.optimization_data.only_start_of_line && !input.regex_options.has_flag_set(AllFlags::Multiline);
 
+    // If every match starts with the same characters, we can skip ahead to wherever those occur next.
+    auto const& literal_prefix = m_pattern->parser_result.optimization_data.literal_prefix;
+    auto can_search_for_literal_prefix = !literal_prefix.is_empty() && !views.is_empty() && !unicode && !input.regex_options.has_flag_set(AllFlags::Insensitive);
+    Vector<u8, 16> literal_prefix_bytes;
+    Vector<u16, 16> literal_prefix_code_units;
+    if (can_search_for_literal_prefix) {
+        auto is_u16_view = views.first().is_u16_view();
+        for (auto ch : literal_prefix) {
+            if (ch > (is_u16_view ? 0xffffu : 0xffu)) {
+                can_search_for_literal_prefix = false;
+                break;
+            }
+            if (is_u16_view)
+                literal_prefix_code_units.append(ch);
+            else
+                literal_prefix_bytes.append(ch);
+        }
+    }
+
+    auto find_literal_prefix = [&](RegexStringView const& view, size_t start) -> Optional<size_t> {
+        if (view.is_u16_view()) {
+            auto const& u16_view = view.u16_view();
+            return find_literal<AK::SIMD::u16x8, u16>({ u16_view.data(), u16_view.length_in_code_units() }, literal_prefix_code_units.span(), start);
+        }
+        return find_literal<AK::SIMD::u8x16, u8>(view.u8_view().bytes(), literal_prefix_bytes.span(), start);
+    };
+
+    // For patterns without backreferences or lookaround, a DFA can rule out where there's no match much quicker than
+    // the backtracking bytecode can.
+    auto const& bytecode = m_pattern->parser_result.bytecode;
+    auto use_dfa = m_pattern->parser_result.optimization_data.is_regular && !unicode;
+    if (use_dfa && !m_anchored_dfa) {
+        m_anchored_dfa = make<LazyDFA>(LazyDFA::Anchoring::Anchored);
+        m_unanchored_dfa = make<LazyDFA>(LazyDFA::Anchoring::Unanchored);
+    }
+
     auto compare_range = [insensitive = input.regex_options & AllFlags::Insensitive](auto needle, CharRange range) {
         auto upper_case_needle = needle;
         auto lower_case_needle = needle;
@@ -270,7 +358,12 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
             }
         }
 
-        for (; view_index <= view_length; ++view_index) {
+        // OPTIMIZATION: If the DFA can't find a match anywhere in the rest of this view, neither can the bytecode.
+        auto may_match_in_view = true;
+        if (use_dfa && continue_search && !only_start_of_line)
+            may_match_in_view = m_unanchored_dfa->find(bytecode, input, view_index) == LazyDFA::Result::MayMatch;
+
+        for (; may_match_in_view && view_index <= view_length; ++view_index) {
             if (view_index == view_length) {
                 if (input.regex_options.has_flag_set(AllFlags::Multiline))
                     break;
@@ -286,11 +379,25 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
             if (match_length_minimum && match_length_minimum > view_length - view_index)
                 break;
 
+            if (can_search_for_literal_prefix) {
+                auto next_occurrence = find_literal_prefix(input.view, view_index);
+                if (!next_occurrence.has_value())
+                    break;
+                if (*next_occurrence != view_index) {
+                    if (!continue_search || only_start_of_line)
+                        goto done_matching;
+                    view_index = *next_occurrence;
+                }
+            }
+
             if (auto& starting_ranges = m_pattern->parser_result.optimization_data.starting_ranges; !starting_ranges.is_empty()) {
                 if (!binary_search(starting_ranges, input.view.code_unit_at(view_index), nullptr, compare_range))
                     goto done_matching;
             }
 
+            if (use_dfa && m_anchored_dfa->find(bytecode, input, view_index) == LazyDFA::Result::NoMatch)
+                goto done_matching;
+
             input.column = match_count;
             input.match_index = match_count;
 
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "RegexByteCode.h"
+#include "RegexDFA.h"
 #include "RegexMatch.h"
 #include "RegexOptions.h"
 #include "RegexParser.h"
@@ -75,6 +76,10 @@ private:
 
     Regex<Parser> const* m_pattern;
     typename ParserTraits<Parser>::OptionsType const m_regex_options;
+
+    // Only used for patterns that the optimizer has found to be regular.
+    mutable OwnPtr<LazyDFA> m_anchored_dfa;
+    mutable OwnPtr<LazyDFA> m_unanchored_dfa;
 };
 
 template<class Parser>
@@ -232,6 +237,8 @@ private:
     void attempt_rewrite_loops_as_atomic_groups(BasicBlockList const&);
     bool attempt_rewrite_entire_match_as_substring_search(BasicBlockList const&);
     void fill_optimization_data(BasicBlockList const&);
+    void fill_literal_prefix();
+    void check_if_pattern_is_regular();
 };
 
 // free standing functions for match, search and has_match
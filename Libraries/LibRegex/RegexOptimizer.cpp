@@ -31,16 +31,18 @@ void Regex<Parser>::run_optimization_passes()
     rewrite_with_useless_jumps_removed();
 
     auto blocks = split_basic_blocks(parser_result.bytecode);
-    if (attempt_rewrite_entire_match_as_substring_search(blocks))
-        return;
+    if (!attempt_rewrite_entire_match_as_substring_search(blocks)) {
+        // Rewrite fork loops as atomic groups
+        // e.g. a*b -> (ATOMIC a*)b
+        attempt_rewrite_loops_as_atomic_groups(blocks);
 
-    // Rewrite fork loops as atomic groups
-    // e.g. a*b -> (ATOMIC a*)b
-    attempt_rewrite_loops_as_atomic_groups(blocks);
+        fill_optimization_data(split_basic_blocks(parser_result.bytecode));
 
-    fill_optimization_data(split_basic_blocks(parser_result.bytecode));
+        parser_result.bytecode.flatten();
+    }
 
-    parser_result.bytecode.flatten();
+    fill_literal_prefix();
+    check_if_pattern_is_regular();
 }
 
 struct StaticallyInterpretedCompares {
@@ -769,6 +771,69 @@ static AtomicRewritePreconditionResult block_satisfies_atomic_rewrite_preconditi
     return AtomicRewritePreconditionResult::SatisfiedWithEmptyHeader;
 }
 
+template<class Parser>
+void Regex<Parser>::fill_literal_prefix()
+{
+    auto& bytecode = parser_result.bytecode;
+    auto& literal_prefix = parser_result.optimization_data.literal_prefix;
+
+    auto state = MatchState::only_for_enumeration();
+    while (state.instruction_position < bytecode.size()) {
+        auto& opcode = bytecode.get_opcode(state);
+        switch (opcode.opcode_id()) {
+        case OpCodeId::Compare: {
+            auto flat_compares = static_cast<OpCode_Compare const&>(opcode).flat_compares();
+            if (flat_compares.size() != 1 || flat_compares.first().type != CharacterCompareType::Char)
+                return;
+            literal_prefix.append(flat_compares.first().value);
+            break;
+        }
+        case OpCodeId::Checkpoint:
+        case OpCodeId::SaveLeftCaptureGroup:
+        case OpCodeId::SaveRightCaptureGroup:
+        case OpCodeId::SaveRightNamedCaptureGroup:
+        case OpCodeId::ClearCaptureGroup:
+            // These do not 'match' anything, so look through them.
+            break;
+        default:
+            return;
+        }
+        state.instruction_position += opcode.size();
+    }
+}
+
+template<class Parser>
+void Regex<Parser>::check_if_pattern_is_regular()
+{
+    auto& bytecode = parser_result.bytecode;
+
+    auto state = MatchState::only_for_enumeration();
+    while (state.instruction_position < bytecode.size()) {
+        auto& opcode = bytecode.get_opcode(state);
+        switch (opcode.opcode_id()) {
+        case OpCodeId::Compare:
+            // Each compare has to consume exactly one character, no matter what came before it.
+            for (auto const& compare : static_cast<OpCode_Compare const&>(opcode).flat_compares()) {
+                if (compare.type == CharacterCompareType::String || compare.type == CharacterCompareType::Reference)
+                    return;
+            }
+            break;
+        case OpCodeId::Save:
+        case OpCodeId::Restore:
+        case OpCodeId::GoBack:
+        case OpCodeId::FailForks:
+        case OpCodeId::PopSaved:
+            // Lookaround.
+            return;
+        default:
+            break;
+        }
+        state.instruction_position += opcode.size();
+    }
+
+    parser_result.optimization_data.is_regular = true;
+}
+
 template<typename Parser>
 bool Regex<Parser>::attempt_rewrite_entire_match_as_substring_search(BasicBlockList const& basic_blocks)
 {
@@ -67,6 +67,10 @@ public:
             // If populated, the pattern only accepts strings that start with a character in these ranges.
             Vector<CharRange> starting_ranges;
             bool only_start_of_line = false;
+            // If populated, every match starts with these characters.
+            Vector<u32> literal_prefix;
+            // If set, the pattern has no backreferences or lookaround, so a DFA can tell where it can't match.
+            bool is_regular = false;
         } optimization_data {};
     };
 
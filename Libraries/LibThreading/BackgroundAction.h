@@ -17,6 +17,7 @@
 #include <LibCore/EventReceiver.h>
 #include <LibCore/Promise.h>
 #include <LibThreading/Thread.h>
+#include <LibThreading/ThreadPool.h>
 
 namespace Threading {
 
@@ -50,7 +51,16 @@ public:
     Optional<Result> const& result() const { return m_result; }
     Optional<Result>& result() { return m_result; }
 
-    void cancel() { m_canceled = true; }
+    void cancel()
+    {
+        m_canceled = true;
+
+        // If we are still waiting for our turn on a thread pool, give up our place in the queue and finish right away.
+        if (m_thread_pool) {
+            if (auto work = m_thread_pool->take_queued_job(m_thread_pool_job_id); work.has_value())
+                (*work)();
+        }
+    }
     // If your action is long-running, you should periodically check the cancel state and possibly return early.
     bool is_canceled() const { return m_canceled; }
 
@@ -58,6 +68,26 @@ private:
     BackgroundAction(ESCAPING Function<ErrorOr<Result>(BackgroundAction&)> action, ESCAPING Function<ErrorOr<void>(Result)> on_complete, ESCAPING Optional<Function<void(Error)>> on_error = {})
         : m_action(move(action))
         , m_on_complete(move(on_complete))
+    {
+        if (on_error.has_value())
+            m_on_error = on_error.release_value();
+
+        enqueue_work(make_work());
+    }
+
+    // Runs the action on a thread pool rather than on the shared background thread.
+    BackgroundAction(ThreadPool& thread_pool, ThreadPool::ClientID client_id, ThreadPool::Priority priority, ESCAPING Function<ErrorOr<Result>(BackgroundAction&)> action, ESCAPING Function<ErrorOr<void>(Result)> on_complete, ESCAPING Optional<Function<void(Error)>> on_error = {})
+        : m_action(move(action))
+        , m_on_complete(move(on_complete))
+        , m_thread_pool(&thread_pool)
+    {
+        if (on_error.has_value())
+            m_on_error = on_error.release_value();
+
+        m_thread_pool_job_id = thread_pool.submit(client_id, priority, make_work());
+    }
+
+    Function<void()> make_work()
     {
         auto promise = Promise::construct();
 
@@ -73,11 +103,9 @@ private:
             Core::EventLoop::current().add_job(promise);
         }
 
-        if (on_error.has_value())
-            m_on_error = on_error.release_value();
-
-        enqueue_work([self = NonnullRefPtr(*this), promise = move(promise), origin_event_loop = &Core::EventLoop::current()]() mutable {
-            auto result = self->m_action(*self);
+        return [self = NonnullRefPtr(*this), promise = move(promise), origin_event_loop = &Core::EventLoop::current()]() mutable {
+            // NOTE: There is no point in running the action if we were cancelled before getting to it.
+            auto result = self->m_canceled ? ErrorOr<Result> { Error::from_errno(ECANCELED) } : self->m_action(*self);
 
             // The event loop cancels the promise when it exits.
             self->m_canceled |= promise->is_rejected();
@@ -111,7 +139,7 @@ private:
                     self->m_on_error(move(error));
                 }
             }
-        });
+        };
     }
 
     Function<ErrorOr<Result>(BackgroundAction&)> m_action;
@@ -121,6 +149,9 @@ private:
     };
     Optional<Result> m_result;
     bool m_canceled { false };
+
+    ThreadPool* m_thread_pool { nullptr };
+    ThreadPool::JobID m_thread_pool_job_id { 0 };
 };
 
 void quit_background_thread();
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibThreading/ThreadPool.h>
+
+namespace Threading {
+
+ThreadPool::ThreadPool(size_t thread_count, StringView name)
+{
+    VERIFY(thread_count > 0);
+
+    m_threads.ensure_capacity(thread_count);
+    for (size_t i = 0; i < thread_count; ++i) {
+        auto thread = Thread::construct([this] { return run_worker(); }, name);
+        thread->start();
+        m_threads.unchecked_append(move(thread));
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        MutexLocker locker(m_mutex);
+        m_should_exit = true;
+        m_condition.broadcast();
+    }
+
+    for (auto& thread : m_threads)
+        MUST(thread->join());
+}
+
+ThreadPool::JobID ThreadPool::submit(ClientID client_id, Priority priority, Function<void()> work)
+{
+    MutexLocker locker(m_mutex);
+
+    auto job_id = m_next_job_id++;
+    auto& lane = m_lanes[to_underlying(priority)];
+
+    auto& queue = lane.queues.ensure(client_id);
+    if (queue.is_empty())
+        lane.client_rotation.append(client_id);
+    queue.append({ job_id, move(work) });
+
+    m_job_locations.set(job_id, { client_id, priority });
+    m_condition.signal();
+    return job_id;
+}
+
+Optional<Function<void()>> ThreadPool::take_queued_job(JobID job_id)
+{
+    MutexLocker locker(m_mutex);
+
+    auto location = m_job_locations.take(job_id);
+    if (!location.has_value())
+        return {};
+
+    auto& lane = m_lanes[to_underlying(location->priority)];
+    auto& queue = lane.queues.find(location->client_id)->value;
+
+    auto index = queue.find_first_index_if([&](auto const& job) { return job.id == job_id; });
+    VERIFY(index.has_value());
+    auto job = queue.take(*index);
+
+    remove_from_rotation_if_empty(lane, location->client_id);
+    return move(job.work);
+}
+
+size_t ThreadPool::queued_job_count() const
+{
+    MutexLocker locker(m_mutex);
+    return m_job_locations.size();
+}
+
+size_t ThreadPool::running_job_count() const
+{
+    MutexLocker locker(m_mutex);
+    return m_running_job_count;
+}
+
+intptr_t ThreadPool::run_worker()
+{
+    MutexLocker locker(m_mutex);
+
+    while (true) {
+        m_condition.wait_while([this] { return m_job_locations.is_empty() && !m_should_exit; });
+        if (m_should_exit)
+            return 0;
+
+        auto job = dequeue_next_job();
+        VERIFY(job.has_value());
+        ++m_running_job_count;
+
+        locker.unlock();
+        job->work();
+        job.clear();
+        locker.lock();
+
+        --m_running_job_count;
+    }
+}
+
+// NOTE: Must be called with m_mutex held.
+Optional<ThreadPool::Job> ThreadPool::dequeue_next_job()
+{
+    for (auto& lane : m_lanes) {
+        if (lane.client_rotation.is_empty())
+            continue;
+
+        // Serve the client at the front of the rotation, then move it to the back if it still has work queued.
+        auto client_id = lane.client_rotation.take_first();
+        auto& queue = lane.queues.find(client_id)->value;
+        auto job = queue.take_first();
+        m_job_locations.remove(job.id);
+
+        if (queue.is_empty())
+            lane.queues.remove(client_id);
+        else
+            lane.client_rotation.append(client_id);
+        return job;
+    }
+    return {};
+}
+
+// NOTE: Must be called with m_mutex held.
+void ThreadPool::remove_from_rotation_if_empty(Lane& lane, ClientID client_id)
+{
+    auto it = lane.queues.find(client_id);
+    if (it == lane.queues.end() || !it->value.is_empty())
+        return;
+
+    lane.queues.remove(it);
+    lane.client_rotation.remove_first_matching([&](auto id) { return id == client_id; });
+}
+
+}
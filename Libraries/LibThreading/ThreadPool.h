@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/ByteString.h>
+#include <AK/Function.h>
+#include <AK/HashMap.h>
+#include <AK/Noncopyable.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Optional.h>
+#include <AK/Vector.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
+#include <LibThreading/Thread.h>
+
+namespace Threading {
+
+// A fixed set of worker threads running jobs submitted from any thread.
+//
+// Jobs are queued per client, and the workers take turns between clients, so that a client submitting hundreds of jobs
+// does not hold up everyone else. Jobs in a higher priority lane are always started before those in a lower one.
+class ThreadPool {
+    AK_MAKE_NONCOPYABLE(ThreadPool);
+    AK_MAKE_NONMOVABLE(ThreadPool);
+
+public:
+    enum class Priority : u8 {
+        High,
+        Normal,
+        __Count,
+    };
+
+    using ClientID = u64;
+    using JobID = u64;
+
+    ThreadPool(size_t thread_count, StringView name);
+    ~ThreadPool();
+
+    JobID submit(ClientID, Priority, Function<void()>);
+
+    // Removes a job that has not been started yet from its queue, and hands it back to the caller.
+    Optional<Function<void()>> take_queued_job(JobID);
+
+    size_t thread_count() const { return m_threads.size(); }
+    size_t queued_job_count() const;
+    size_t running_job_count() const;
+
+private:
+    struct Job {
+        JobID id { 0 };
+        Function<void()> work;
+    };
+
+    struct Lane {
+        HashMap<ClientID, Vector<Job>> queues;
+
+        // Clients with queued jobs in this lane, in the order they will be served.
+        Vector<ClientID> client_rotation;
+    };
+
+    struct JobLocation {
+        ClientID client_id { 0 };
+        Priority priority { Priority::Normal };
+    };
+
+    intptr_t run_worker();
+    Optional<Job> dequeue_next_job();
+    void remove_from_rotation_if_empty(Lane&, ClientID);
+
+    Vector<NonnullRefPtr<Thread>> m_threads;
+
+    mutable Mutex m_mutex;
+    ConditionVariable m_condition { m_mutex };
+    Array<Lane, to_underlying(Priority::__Count)> m_lanes;
+    HashMap<JobID, JobLocation> m_job_locations;
+    JobID m_next_job_id { 1 };
+    size_t m_running_job_count { 0 };
+    bool m_should_exit { false };
+};
+
+}
@@ -14,14 +14,14 @@
 
 namespace Wasm {
 
-Optional<FunctionAddress> Store::allocate(ModuleInstance& instance, Module const& module, CodeSection::Code const& code, TypeIndex type_index)
+Optional<FunctionAddress> Store::allocate(ModuleInstance& instance, Module const& module, CodeSection::Code const& code, TypeIndex type_index, RefPtr<CompiledFunction const> compiled_function)
 {
     FunctionAddress address { m_functions.size() };
     if (type_index.value() >= instance.types().size())
         return {};
 
     auto& type = instance.types()[type_index.value()];
-    m_functions.empend(WasmFunction { type, instance, module, code });
+    m_functions.empend(WasmFunction { type, instance, module, code, move(compiled_function) });
     return address;
 }
 
@@ -228,10 +228,19 @@ InstantiationResult AbstractMachine::instantiate(Module const& module, Vector<Ex
     Vector<FunctionAddress> module_functions;
     module_functions.ensure_capacity(module.function_section().types().size());
 
+    // NOTE: Compiling only depends on the validated module, so we do it once and share the result with every instance.
+    Vector<RefPtr<CompiledFunction const>> const* compiled_functions = nullptr;
+    if (m_should_compile_functions) {
+        if (!module.compiled_functions().has_value())
+            const_cast<Module&>(module).set_compiled_functions(CompiledFunction::compile_all(module), {});
+        compiled_functions = &*module.compiled_functions();
+    }
+
     size_t i = 0;
     for (auto& code : module.code_section().functions()) {
         auto type_index = module.function_section().types()[i];
-        auto address = m_store.allocate(main_module_instance, module, code, type_index);
+        auto compiled_function = compiled_functions && i < compiled_functions->size() ? (*compiled_functions)[i] : RefPtr<CompiledFunction const> {};
+        auto address = m_store.allocate(main_module_instance, module, code, type_index, move(compiled_function));
         VERIFY(address.has_value());
         auxiliary_instance.functions().append(*address);
         module_functions.append(*address);
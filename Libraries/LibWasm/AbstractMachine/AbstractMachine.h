@@ -13,6 +13,7 @@
 #include <AK/NonnullOwnPtr.h>
 #include <AK/StackInfo.h>
 #include <AK/UFixedBigInt.h>
+#include <LibWasm/AbstractMachine/CompiledFunction.h>
 #include <LibWasm/Types.h>
 
 namespace Wasm {
@@ -332,17 +333,19 @@ private:
 
 class WasmFunction {
 public:
-    explicit WasmFunction(FunctionType const& type, ModuleInstance const& instance, Module const& module, CodeSection::Code const& code)
+    explicit WasmFunction(FunctionType const& type, ModuleInstance const& instance, Module const& module, CodeSection::Code const& code, RefPtr<CompiledFunction const> compiled_function = {})
         : m_type(type)
         , m_module(module.make_weak_ptr())
         , m_module_instance(instance)
         , m_code(code)
+        , m_compiled_function(move(compiled_function))
     {
     }
 
     auto& type() const { return m_type; }
     auto& module() const { return m_module_instance; }
     auto& code() const { return m_code; }
+    CompiledFunction const* compiled_function() const { return m_compiled_function.ptr(); }
     RefPtr<Module const> module_ref() const { return m_module.strong_ref(); }
 
 private:
@@ -350,6 +353,7 @@ private:
     WeakPtr<Module const> m_module;
     ModuleInstance const& m_module_instance;
     CodeSection::Code const& m_code;
+    RefPtr<CompiledFunction const> m_compiled_function;
 };
 
 class HostFunction {
@@ -446,13 +450,27 @@ public:
             return true;
         u64 new_size = m_data.size() + size_to_grow;
         // Can't grow past 2^16 pages.
-        if (new_size >= Constants::page_size * 65536)
+        if (new_size >= Constants::page_size * max_page_count)
             return false;
         if (auto max = m_type.limits().max(); max.has_value()) {
             if (max.value() * Constants::page_size < new_size)
                 return false;
         }
         auto previous_size = m_size;
+
+        // OPTIMIZATION: Double the buffer's capacity whenever it runs out (up to the memory's maximum), so that a memory
+        //               growing a page at a time only gets moved (and copied) a logarithmic number of times.
+        //               We don't reserve the maximum up front, as that would be charged in full wherever the allocator
+        //               commits memory eagerly (e.g. on Windows, or on Linux with overcommit disabled).
+        if (new_size > m_data.capacity()) {
+            u64 new_capacity = max(new_size, static_cast<u64>(m_data.capacity()) * 2);
+            if (auto maximum = m_type.limits().max(); maximum.has_value())
+                new_capacity = min(new_capacity, static_cast<u64>(*maximum) * Constants::page_size);
+            new_capacity = min(new_capacity, (max_page_count - 1) * Constants::page_size);
+            if (m_data.try_ensure_capacity(max(new_capacity, new_size)).is_error() && m_data.try_ensure_capacity(new_size).is_error())
+                return false;
+        }
+
         if (m_data.try_resize(new_size).is_error())
             return false;
         m_size = new_size;
@@ -478,6 +496,8 @@ public:
     Function<void()> successful_grow_hook;
 
 private:
+    static constexpr u64 max_page_count = 65536;
+
     explicit MemoryInstance(MemoryType const& type)
         : m_type(type)
     {
@@ -548,7 +568,7 @@ class Store {
 public:
     Store() = default;
 
-    Optional<FunctionAddress> allocate(ModuleInstance&, Module const&, CodeSection::Code const&, TypeIndex);
+    Optional<FunctionAddress> allocate(ModuleInstance&, Module const&, CodeSection::Code const&, TypeIndex, RefPtr<CompiledFunction const> = {});
     Optional<FunctionAddress> allocate(HostFunction&&);
     Optional<TableAddress> allocate(TableType const&);
     Optional<MemoryAddress> allocate(MemoryType const&);
@@ -594,11 +614,12 @@ private:
 
 class Frame {
 public:
-    explicit Frame(ModuleInstance const& module, Vector<Value> locals, Expression const& expression, size_t arity)
+    explicit Frame(ModuleInstance const& module, Vector<Value> locals, Expression const& expression, size_t arity, CompiledFunction const* compiled_function = nullptr)
         : m_module(module)
         , m_locals(move(locals))
         , m_expression(expression)
         , m_arity(arity)
+        , m_compiled_function(compiled_function)
     {
     }
 
@@ -607,6 +628,7 @@ public:
     auto& locals() { return m_locals; }
     auto& expression() const { return m_expression; }
     auto arity() const { return m_arity; }
+    auto compiled_function() const { return m_compiled_function; }
     auto label_index() const { return m_label_index; }
     auto& label_index() { return m_label_index; }
 
@@ -615,6 +637,7 @@ private:
     Vector<Value> m_locals;
     Expression const& m_expression;
     size_t m_arity { 0 };
+    CompiledFunction const* m_compiled_function { nullptr };
     size_t m_label_index { 0 };
 };
 
@@ -639,6 +662,8 @@ public:
     auto& store() { return m_store; }
 
     void enable_instruction_count_limit() { m_should_limit_instruction_count = true; }
+    // Run functions in the bytecode interpreter, instead of compiling them when they're instantiated.
+    void disable_function_compilation() { m_should_compile_functions = false; }
 
     void visit_external_resources(HostVisitOps const&);
 
@@ -673,6 +698,7 @@ private:
     StackInfo m_stack_info;
     HashTable<Interpreter*> m_active_interpreters;
     bool m_should_limit_instruction_count { false };
+    bool m_should_compile_functions { true };
 };
 
 class Linker {
@@ -33,6 +33,11 @@ namespace Wasm {
 void BytecodeInterpreter::interpret(Configuration& configuration)
 {
     m_trap = Empty {};
+    if (auto const* compiled_function = configuration.frame().compiled_function(); compiled_function) {
+        interpret_compiled_function(configuration, *compiled_function);
+        return;
+    }
+
     auto& instructions = configuration.frame().expression().instructions();
     auto max_ip_value = InstructionPointer { instructions.size() };
     auto& current_ip_value = configuration.ip();
@@ -56,6 +61,252 @@ void BytecodeInterpreter::interpret(Configuration& configuration)
     }
 }
 
+template<typename T>
+ALWAYS_INLINE static T from_slot(u64 slot)
+{
+    if constexpr (IsSame<T, float>)
+        return bit_cast<float>(static_cast<u32>(slot));
+    else if constexpr (IsSame<T, double>)
+        return bit_cast<double>(slot);
+    else
+        return static_cast<T>(slot);
+}
+
+// NOTE: This keeps values narrower than 64 bits sign-extended, the same way Value stores them.
+template<typename T>
+ALWAYS_INLINE static u64 to_slot(T value)
+{
+    if constexpr (sizeof(T) == sizeof(u64))
+        return bit_cast<u64>(value);
+    else
+        return static_cast<u64>(static_cast<i64>(bit_cast<i32>(value)));
+}
+
+template<typename T>
+ALWAYS_INLINE static T read_from_memory(u8 const* data)
+{
+    if constexpr (IsSame<T, float>) {
+        return bit_cast<float>(read_from_memory<u32>(data));
+    } else if constexpr (IsSame<T, double>) {
+        return bit_cast<double>(read_from_memory<u64>(data));
+    } else {
+        T value;
+        memcpy(&value, data, sizeof(T));
+        return AK::convert_between_host_and_little_endian(value);
+    }
+}
+
+template<typename T>
+ALWAYS_INLINE static void write_to_memory(u8* data, T value)
+{
+    if constexpr (IsSame<T, float>) {
+        write_to_memory(data, bit_cast<u32>(value));
+    } else if constexpr (IsSame<T, double>) {
+        write_to_memory(data, bit_cast<u64>(value));
+    } else {
+        value = AK::convert_between_host_and_little_endian(value);
+        memcpy(data, &value, sizeof(T));
+    }
+}
+
+template<typename PushType, typename T>
+ALWAYS_INLINE static Optional<StringView> store_operation_result(u64& slot, T call_result)
+{
+    PushType result;
+    if constexpr (IsSpecializationOf<T, AK::ErrorOr>) {
+        if (call_result.is_error())
+            return call_result.error();
+        result = call_result.release_value();
+    } else {
+        result = call_result;
+    }
+    slot = to_slot(result);
+    return {};
+}
+
+void BytecodeInterpreter::interpret_compiled_function(Configuration& configuration, CompiledFunction const& function)
+{
+    auto& module = configuration.frame().module();
+    auto& store = configuration.store();
+
+    Vector<u64, 64> frame_slots;
+    frame_slots.resize(function.slot_count());
+    auto* slots = frame_slots.data();
+    auto& locals = configuration.frame().locals();
+    for (size_t i = 0; i < locals.size(); ++i)
+        slots[i] = locals[i].value().low();
+    for (size_t i = 0; i < function.constants().size(); ++i)
+        slots[function.constants_base() + i] = function.constants()[i];
+
+    // NOTE: Calls can end up allocating memories, which can move the store's memory instances around.
+    MemoryInstance* default_memory = nullptr;
+    auto refresh_default_memory = [&] {
+        default_memory = module.memories().is_empty() ? nullptr : store.get(module.memories().first());
+    };
+    refresh_default_memory();
+    auto memory_at = [&](u32 index) {
+        return index == 0 ? default_memory : store.get(module.memories()[index]);
+    };
+
+    auto const* instructions = function.instructions().data();
+    auto const* branch_table = function.branch_table().data();
+    size_t ip = 0;
+    auto const should_limit_instruction_count = configuration.should_limit_instruction_count();
+    u64 executed_instructions = 0;
+
+    for (;;) {
+        if (should_limit_instruction_count) {
+            if (executed_instructions++ >= Constants::max_allowed_executed_instructions_per_call) [[unlikely]] {
+                m_trap = Trap::from_string("Exceeded maximum allowed number of instructions");
+                return;
+            }
+        }
+        auto const& instruction = instructions[ip++];
+        switch (instruction.opcode) {
+        case CompiledOpcode::copy:
+            slots[instruction.destination] = slots[instruction.lhs];
+            continue;
+        case CompiledOpcode::select:
+            if (static_cast<i32>(slots[instruction.rhs]) == 0)
+                slots[instruction.destination] = slots[instruction.lhs];
+            continue;
+        case CompiledOpcode::jump:
+            ip = instruction.immediate;
+            continue;
+        case CompiledOpcode::jump_if_zero:
+            if (static_cast<i32>(slots[instruction.lhs]) == 0)
+                ip = instruction.immediate;
+            continue;
+        case CompiledOpcode::jump_if_not_zero:
+            if (static_cast<i32>(slots[instruction.lhs]) != 0)
+                ip = instruction.immediate;
+            continue;
+        case CompiledOpcode::branch_table:
+            ip = branch_table[instruction.immediate + min(static_cast<u32>(slots[instruction.lhs]), instruction.rhs)];
+            continue;
+        case CompiledOpcode::call: {
+            TRAP_IF_NOT(m_stack_info.size_free() >= Constants::minimum_stack_space_to_keep_free);
+
+            auto address = module.functions()[instruction.immediate];
+            Vector<Value> arguments;
+            arguments.ensure_capacity(instruction.destination);
+            for (u32 i = 0; i < instruction.destination; ++i)
+                arguments.unchecked_append(Value(slots[instruction.lhs + i]));
+
+            Result result { Trap::from_string("") };
+            if (store.get(address)->has<WasmFunction>()) {
+                CallFrameHandle handle { *this, configuration };
+                result = configuration.call(*this, address, move(arguments));
+            } else {
+                result = configuration.call(*this, address, move(arguments));
+            }
+
+            if (result.is_trap()) {
+                m_trap = move(result.trap());
+                return;
+            }
+
+            // NOTE: The results come back in reverse order.
+            auto& values = result.values();
+            for (size_t i = 0; i < values.size(); ++i)
+                slots[instruction.lhs + i] = values[values.size() - 1 - i].value().low();
+            refresh_default_memory();
+            continue;
+        }
+        case CompiledOpcode::return_: {
+            auto& value_stack = configuration.value_stack();
+            value_stack.ensure_capacity(value_stack.size() + instruction.rhs);
+            for (u32 i = 0; i < instruction.rhs; ++i)
+                value_stack.unchecked_append(Value(slots[instruction.lhs + i]));
+            return;
+        }
+        case CompiledOpcode::unreachable:
+            m_trap = Trap::from_string("Unreachable");
+            return;
+        case CompiledOpcode::global_get:
+            slots[instruction.destination] = store.get(module.globals()[instruction.immediate])->value().value().low();
+            continue;
+        case CompiledOpcode::global_set:
+            store.get(module.globals()[instruction.immediate])->set_value(Value(slots[instruction.lhs]));
+            continue;
+        case CompiledOpcode::memory_size: {
+            auto* memory = memory_at(instruction.immediate);
+            slots[instruction.destination] = to_slot(static_cast<i32>(memory->size() / Constants::page_size));
+            continue;
+        }
+        case CompiledOpcode::memory_grow: {
+            auto* memory = memory_at(instruction.immediate);
+            i32 old_pages = memory->size() / Constants::page_size;
+            auto new_pages = from_slot<i32>(slots[instruction.lhs]);
+            slots[instruction.destination] = to_slot(memory->grow(new_pages * Constants::page_size) ? old_pages : -1);
+            continue;
+        }
+
+#define __ENUMERATE_BINARY_OPERATION(name, PopType, PushType, Operator)                                                          \
+    case CompiledOpcode::name: {                                                                                                  \
+        auto result = Operator {}(from_slot<PopType>(slots[instruction.lhs]), from_slot<PopType>(slots[instruction.rhs]));       \
+        if (auto error = store_operation_result<PushType>(slots[instruction.destination], move(result)); error.has_value()) [[unlikely]] { \
+            trap_if_not(false, *error);                                                                                           \
+            return;                                                                                                               \
+        }                                                                                                                         \
+        continue;                                                                                                                 \
+    }
+            ENUMERATE_WASM_COMPILED_BINARY_OPERATIONS(__ENUMERATE_BINARY_OPERATION)
+#undef __ENUMERATE_BINARY_OPERATION
+
+#define __ENUMERATE_UNARY_OPERATION(name, PopType, PushType, Operator)                                                            \
+    case CompiledOpcode::name: {                                                                                                  \
+        auto result = Operator {}(from_slot<PopType>(slots[instruction.lhs]));                                                    \
+        if (auto error = store_operation_result<PushType>(slots[instruction.destination], move(result)); error.has_value()) [[unlikely]] { \
+            trap_if_not(false, *error);                                                                                           \
+            return;                                                                                                               \
+        }                                                                                                                         \
+        continue;                                                                                                                 \
+    }
+            ENUMERATE_WASM_COMPILED_UNARY_OPERATIONS(__ENUMERATE_UNARY_OPERATION)
+#undef __ENUMERATE_UNARY_OPERATION
+
+#define __ENUMERATE_LOAD(name, ReadType, PushType)                                                              \
+    case CompiledOpcode::name: {                                                                                \
+        auto* memory = memory_at(instruction.rhs);                                                              \
+        u64 address = static_cast<u64>(static_cast<u32>(slots[instruction.lhs])) + instruction.immediate;       \
+        if (address + sizeof(ReadType) > memory->size()) [[unlikely]] {                                         \
+            m_trap = Trap::from_string("Memory access out of bounds");                                          \
+            return;                                                                                             \
+        }                                                                                                       \
+        auto value = read_from_memory<ReadType>(memory->data().data() + address);                              \
+        slots[instruction.destination] = to_slot(static_cast<PushType>(value));                                 \
+        continue;                                                                                               \
+    }
+            ENUMERATE_WASM_COMPILED_LOADS(__ENUMERATE_LOAD)
+#undef __ENUMERATE_LOAD
+
+#define __ENUMERATE_STORE(name, PopType, StoreType)                                                             \
+    case CompiledOpcode::name: {                                                                                \
+        auto* memory = memory_at(instruction.destination);                                                      \
+        u64 address = static_cast<u64>(static_cast<u32>(slots[instruction.lhs])) + instruction.immediate;       \
+        if (address + sizeof(StoreType) > memory->size()) [[unlikely]] {                                        \
+            m_trap = Trap::from_string("Memory access out of bounds");                                          \
+            return;                                                                                             \
+        }                                                                                                       \
+        write_to_memory(memory->data().data() + address, static_cast<StoreType>(from_slot<PopType>(slots[instruction.rhs]))); \
+        continue;                                                                                               \
+    }
+            ENUMERATE_WASM_COMPILED_STORES(__ENUMERATE_STORE)
+#undef __ENUMERATE_STORE
+
+#define __ENUMERATE_FUSED_COMPARISON(name, negated_name, PopType, Operator)                                      \
+    case CompiledOpcode::jump_if_##name:                                                                        \
+        if (Operator {}(from_slot<PopType>(slots[instruction.lhs]), from_slot<PopType>(slots[instruction.rhs]))) \
+            ip = instruction.immediate;                                                                         \
+        continue;
+            ENUMERATE_WASM_COMPILED_FUSED_COMPARISONS(__ENUMERATE_FUSED_COMPARISON)
+#undef __ENUMERATE_FUSED_COMPARISON
+        }
+        VERIFY_NOT_REACHED();
+    }
+}
+
 void BytecodeInterpreter::branch_to_label(Configuration& configuration, LabelIndex index)
 {
     dbgln_if(WASM_TRACE_DEBUG, "Branch to label with index {}...", index.value());
@@ -217,12 +468,6 @@ void BytecodeInterpreter::pop_and_push_m_splat(Wasm::Configuration& configuratio
     set_top_m_splat<M, NativeType>(configuration, value);
 }
 
-template<typename M, template<typename> typename SetSign, typename VectorType>
-VectorType BytecodeInterpreter::pop_vector(Configuration& configuration)
-{
-    return bit_cast<VectorType>(configuration.value_stack().take_last().to<u128>());
-}
-
 void BytecodeInterpreter::call_address(Configuration& configuration, FunctionAddress address)
 {
     TRAP_IF_NOT(m_stack_info.size_free() >= Constants::minimum_stack_space_to_keep_free);
@@ -1189,20 +1434,8 @@ ALWAYS_INLINE void BytecodeInterpreter::interpret_instruction(Configuration& con
         return pop_and_push_m_splat<32, NativeFloatingType>(configuration, instruction);
     case Instructions::f64x2_splat.value():
         return pop_and_push_m_splat<64, NativeFloatingType>(configuration, instruction);
-    case Instructions::i8x16_shuffle.value(): {
-        auto& arg = instruction.arguments().get<Instruction::ShuffleArgument>();
-        auto b = pop_vector<u8, MakeUnsigned>(configuration);
-        auto a = pop_vector<u8, MakeUnsigned>(configuration);
-        using VectorType = Native128ByteVectorOf<u8, MakeUnsigned>;
-        VectorType result;
-        for (size_t i = 0; i < 16; ++i)
-            if (arg.lanes[i] < 16)
-                result[i] = a[arg.lanes[i]];
-            else
-                result[i] = b[arg.lanes[i] - 16];
-        configuration.value_stack().append(Value(bit_cast<u128>(result)));
-        return;
-    }
+    case Instructions::i8x16_shuffle.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorShuffle>(configuration, instruction.arguments().get<Instruction::ShuffleArgument>().lanes);
     case Instructions::v128_store.value():
         return pop_and_store<u128, u128>(configuration, instruction);
     case Instructions::i8x16_shl.value():
@@ -49,6 +49,7 @@ struct BytecodeInterpreter : public Interpreter {
 
 protected:
     void interpret_instruction(Configuration&, InstructionPointer&, Instruction const&);
+    void interpret_compiled_function(Configuration&, CompiledFunction const&);
     void branch_to_label(Configuration&, LabelIndex);
     template<typename ReadT, typename PushT>
     void load_and_push(Configuration&, Instruction const&);
@@ -68,8 +69,6 @@ protected:
     void set_top_m_splat(Configuration&, NativeType<M>);
     template<size_t M, template<size_t> typename NativeType>
     void pop_and_push_m_splat(Configuration&, Instruction const&);
-    template<typename M, template<typename> typename SetSign, typename VectorType = Native128ByteVectorOf<M, SetSign>>
-    VectorType pop_vector(Configuration&);
     void store_to_memory(Configuration&, Instruction::MemoryArgument const&, ReadonlyBytes data, u32 base);
     void call_address(Configuration&, FunctionAddress);
 
@@ -0,0 +1,721 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/AllOf.h>
+#include <AK/Checked.h>
+#include <AK/HashMap.h>
+#include <LibWasm/AbstractMachine/CompiledFunction.h>
+#include <LibWasm/Opcode.h>
+#include <LibWasm/Parallel.h>
+
+namespace Wasm {
+
+// Constants are numbered before we know how many slots the locals and the operand stack take up, so they're tagged
+// with this bit until the end of compilation.
+static constexpr u32 constant_slot_tag = 1u << 31;
+static constexpr u32 max_slot_count = 64 * KiB;
+
+struct ModuleContext {
+    Module const& module;
+    Vector<FunctionType const*> function_types;
+    Vector<ValueType> global_types;
+};
+
+static bool is_numeric(Vector<ValueType> const& types)
+{
+    return all_of(types, [](auto& type) { return type.is_numeric(); });
+}
+
+class FunctionCompiler {
+public:
+    FunctionCompiler(ModuleContext const& context, FunctionType const& type, CodeSection::Code const& code)
+        : m_context(context)
+        , m_type(type)
+        , m_code(code)
+    {
+    }
+
+    RefPtr<CompiledFunction const> compile();
+
+private:
+    struct BlockSignature {
+        u32 parameter_count { 0 };
+        u32 result_count { 0 };
+    };
+
+    struct ControlFrame {
+        enum class Kind {
+            Block,
+            Loop,
+            If,
+        };
+
+        Kind kind;
+        BlockSignature signature;
+        // The stack height below the block's parameters.
+        u32 base { 0 };
+        size_t loop_start { 0 };
+        Optional<size_t> jump_to_else;
+        Vector<size_t> jumps_to_end;
+        Vector<size_t> branch_table_entries_to_end;
+        bool is_end_reachable_by_branch { false };
+
+        u32 branch_arity() const { return kind == Kind::Loop ? signature.parameter_count : signature.result_count; }
+    };
+
+    bool compile_instruction(Instruction const&);
+    bool compile_unreachable_instruction(Instruction const&);
+
+    Optional<BlockSignature> signature_of(BlockType const&) const;
+    void begin_block(ControlFrame::Kind, BlockSignature);
+    void begin_if(BlockSignature);
+    void begin_else();
+    void end_block();
+
+    ControlFrame& frame_for_label(LabelIndex label) { return m_control_stack[m_control_stack.size() - 1 - label.value()]; }
+    bool is_function_frame(ControlFrame const& frame) const { return &frame == &m_control_stack.first(); }
+    bool branch_needs_copies(ControlFrame const&) const;
+    void emit_branch(ControlFrame&);
+    void emit_return();
+    Optional<CompiledInstruction> take_fusable_comparison(u32 condition);
+    size_t emit_conditional_jump(u32 condition, Optional<CompiledInstruction> comparison, bool jump_if_true);
+    void patch_jump_to_here(size_t instruction_index) { m_instructions[instruction_index].immediate = m_instructions.size(); }
+
+    size_t emit(CompiledOpcode opcode, u32 destination = 0, u32 lhs = 0, u32 rhs = 0, u64 immediate = 0)
+    {
+        m_last_value_producer.clear();
+        m_instructions.append({ opcode, destination, lhs, rhs, immediate });
+        return m_instructions.size() - 1;
+    }
+    void emit_value_producer(CompiledOpcode opcode, u32 lhs = 0, u32 rhs = 0, u64 immediate = 0)
+    {
+        auto destination = push_own_slot();
+        m_last_value_producer = emit(opcode, destination, lhs, rhs, immediate);
+    }
+    void emit_binary_operation(CompiledOpcode opcode)
+    {
+        auto rhs = m_stack.take_last();
+        auto lhs = m_stack.take_last();
+        emit_value_producer(opcode, lhs, rhs);
+    }
+    void emit_unary_operation(CompiledOpcode opcode)
+    {
+        auto value = m_stack.take_last();
+        emit_value_producer(opcode, value);
+    }
+
+    u32 stack_slot(size_t position) const { return m_local_count + position; }
+    u32 push_own_slot()
+    {
+        auto slot = stack_slot(m_stack.size());
+        m_stack.append(slot);
+        m_max_stack_height = max(m_max_stack_height, m_stack.size());
+        return slot;
+    }
+    void push_alias(u32 slot)
+    {
+        m_stack.append(slot);
+        m_max_stack_height = max(m_max_stack_height, m_stack.size());
+    }
+    void push_constant(u64 bits);
+    void materialize(size_t position);
+    void materialize_all();
+    void materialize_top(size_t count);
+    void materialize_aliases_of(u32 local, size_t below_position);
+    bool has_alias_of(u32 local, size_t below_position) const;
+
+    ModuleContext const& m_context;
+    FunctionType const& m_type;
+    CodeSection::Code const& m_code;
+
+    u32 m_local_count { 0 };
+    // For each value on the operand stack, the slot it can be read from: its own slot while it's materialized, or the
+    // slot of the local or constant it's a copy of.
+    Vector<u32> m_stack;
+    size_t m_max_stack_height { 0 };
+    Vector<ControlFrame> m_control_stack;
+    bool m_is_reachable { true };
+    size_t m_unreachable_block_depth { 0 };
+    Optional<size_t> m_last_value_producer;
+
+    Vector<CompiledInstruction> m_instructions;
+    Vector<u32> m_branch_table;
+    Vector<u64> m_constants;
+    HashMap<u64, u32> m_constant_indices;
+};
+
+void FunctionCompiler::push_constant(u64 bits)
+{
+    auto index = m_constant_indices.ensure(bits, [&] {
+        m_constants.append(bits);
+        return static_cast<u32>(m_constants.size() - 1);
+    });
+    push_alias(constant_slot_tag | index);
+}
+
+void FunctionCompiler::materialize(size_t position)
+{
+    auto own_slot = stack_slot(position);
+    if (m_stack[position] == own_slot)
+        return;
+    emit(CompiledOpcode::copy, own_slot, m_stack[position]);
+    m_stack[position] = own_slot;
+}
+
+void FunctionCompiler::materialize_all()
+{
+    for (size_t i = 0; i < m_stack.size(); ++i)
+        materialize(i);
+}
+
+void FunctionCompiler::materialize_top(size_t count)
+{
+    for (size_t i = m_stack.size() - count; i < m_stack.size(); ++i)
+        materialize(i);
+}
+
+void FunctionCompiler::materialize_aliases_of(u32 local, size_t below_position)
+{
+    for (size_t i = 0; i < below_position; ++i) {
+        if (m_stack[i] == local)
+            materialize(i);
+    }
+}
+
+bool FunctionCompiler::has_alias_of(u32 local, size_t below_position) const
+{
+    for (size_t i = 0; i < below_position; ++i) {
+        if (m_stack[i] == local)
+            return true;
+    }
+    return false;
+}
+
+Optional<FunctionCompiler::BlockSignature> FunctionCompiler::signature_of(BlockType const& type) const
+{
+    switch (type.kind()) {
+    case BlockType::Empty:
+        return BlockSignature {};
+    case BlockType::Type:
+        if (!type.value_type().is_numeric())
+            return {};
+        return BlockSignature { 0, 1 };
+    case BlockType::Index: {
+        auto& function_type = m_context.module.type_section().types()[type.type_index().value()];
+        if (!is_numeric(function_type.parameters()) || !is_numeric(function_type.results()))
+            return {};
+        return BlockSignature { static_cast<u32>(function_type.parameters().size()), static_cast<u32>(function_type.results().size()) };
+    }
+    }
+    VERIFY_NOT_REACHED();
+}
+
+void FunctionCompiler::begin_block(ControlFrame::Kind kind, BlockSignature signature)
+{
+    // NOTE: Control flow can merge at the end of the block (or at its start, for loops), so every value has to be in
+    //       its own slot by then. Doing it up front also keeps locals that get set inside the block from changing
+    //       values outside of it.
+    materialize_all();
+    m_last_value_producer.clear();
+    m_control_stack.append({
+        .kind = kind,
+        .signature = signature,
+        .base = static_cast<u32>(m_stack.size() - signature.parameter_count),
+        .loop_start = m_instructions.size(),
+        .jump_to_else = {},
+        .jumps_to_end = {},
+        .branch_table_entries_to_end = {},
+        .is_end_reachable_by_branch = false,
+    });
+}
+
+void FunctionCompiler::begin_if(BlockSignature signature)
+{
+    auto condition = m_stack.take_last();
+    auto comparison = take_fusable_comparison(condition);
+    begin_block(ControlFrame::Kind::If, signature);
+    m_control_stack.last().jump_to_else = emit_conditional_jump(condition, move(comparison), false);
+}
+
+void FunctionCompiler::begin_else()
+{
+    auto& frame = m_control_stack.last();
+    if (m_is_reachable) {
+        materialize_top(frame.signature.result_count);
+        frame.jumps_to_end.append(emit(CompiledOpcode::jump));
+        frame.is_end_reachable_by_branch = true;
+    }
+
+    patch_jump_to_here(frame.jump_to_else.release_value());
+    m_last_value_producer.clear();
+
+    // The else arm starts out with the same parameters as the then arm, which are still where the if put them.
+    m_stack.shrink(frame.base);
+    for (size_t i = 0; i < frame.signature.parameter_count; ++i)
+        push_own_slot();
+    m_is_reachable = true;
+}
+
+void FunctionCompiler::end_block()
+{
+    auto frame = m_control_stack.take_last();
+    auto is_reachable = frame.is_end_reachable_by_branch;
+    if (m_is_reachable) {
+        materialize_top(frame.signature.result_count);
+        is_reachable = true;
+    }
+    if (frame.jump_to_else.has_value()) {
+        patch_jump_to_here(*frame.jump_to_else);
+        is_reachable = true;
+    }
+    for (auto index : frame.jumps_to_end)
+        patch_jump_to_here(index);
+    for (auto entry : frame.branch_table_entries_to_end)
+        m_branch_table[entry] = m_instructions.size();
+    m_last_value_producer.clear();
+
+    m_stack.shrink(frame.base);
+    for (size_t i = 0; i < frame.signature.result_count; ++i)
+        push_own_slot();
+    m_is_reachable = is_reachable;
+
+    if (m_control_stack.is_empty() && m_is_reachable)
+        emit_return();
+}
+
+bool FunctionCompiler::branch_needs_copies(ControlFrame const& frame) const
+{
+    auto arity = frame.branch_arity();
+    for (size_t i = 0; i < arity; ++i) {
+        if (m_stack[m_stack.size() - arity + i] != stack_slot(frame.base + i))
+            return true;
+    }
+    return false;
+}
+
+// NOTE: This doesn't change the compile-time stack, since a conditional branch continues with it when not taken.
+void FunctionCompiler::emit_branch(ControlFrame& frame)
+{
+    if (is_function_frame(frame)) {
+        emit_return();
+        return;
+    }
+
+    auto arity = frame.branch_arity();
+    for (size_t i = 0; i < arity; ++i) {
+        auto source = m_stack[m_stack.size() - arity + i];
+        if (source != stack_slot(frame.base + i))
+            emit(CompiledOpcode::copy, stack_slot(frame.base + i), source);
+    }
+
+    if (frame.kind == ControlFrame::Kind::Loop) {
+        emit(CompiledOpcode::jump, 0, 0, 0, frame.loop_start);
+        return;
+    }
+    frame.jumps_to_end.append(emit(CompiledOpcode::jump));
+    frame.is_end_reachable_by_branch = true;
+}
+
+void FunctionCompiler::emit_return()
+{
+    auto count = static_cast<u32>(m_type.results().size());
+    if (count == 0) {
+        emit(CompiledOpcode::return_);
+        return;
+    }
+    if (count == 1) {
+        emit(CompiledOpcode::return_, 0, m_stack.last(), 1);
+        return;
+    }
+
+    // NOTE: Copying into a value's own slot is harmless even if this return isn't taken; nothing else reads that slot.
+    auto first_position = m_stack.size() - count;
+    for (size_t i = first_position; i < m_stack.size(); ++i) {
+        if (m_stack[i] != stack_slot(i))
+            emit(CompiledOpcode::copy, stack_slot(i), m_stack[i]);
+    }
+    emit(CompiledOpcode::return_, 0, stack_slot(first_position), count);
+}
+
+Optional<CompiledInstruction> FunctionCompiler::take_fusable_comparison(u32 condition)
+{
+    // NOTE: The comparison may have been computed straight into a local by a local.tee, which has to stay.
+    if (condition != stack_slot(m_stack.size()))
+        return {};
+    if (m_last_value_producer != m_instructions.size() - 1 || m_instructions.last().destination != condition)
+        return {};
+
+    switch (m_instructions.last().opcode) {
+    case CompiledOpcode::i32_eqz:
+#define __ENUMERATE_FUSABLE_COMPARISON(name, ...) case CompiledOpcode::name:
+        ENUMERATE_WASM_COMPILED_FUSED_COMPARISONS(__ENUMERATE_FUSABLE_COMPARISON)
+#undef __ENUMERATE_FUSABLE_COMPARISON
+        m_last_value_producer.clear();
+        return m_instructions.take_last();
+    default:
+        return {};
+    }
+}
+
+size_t FunctionCompiler::emit_conditional_jump(u32 condition, Optional<CompiledInstruction> comparison, bool jump_if_true)
+{
+    if (!comparison.has_value())
+        return emit(jump_if_true ? CompiledOpcode::jump_if_not_zero : CompiledOpcode::jump_if_zero, 0, condition);
+
+    switch (comparison->opcode) {
+    case CompiledOpcode::i32_eqz:
+        return emit(jump_if_true ? CompiledOpcode::jump_if_zero : CompiledOpcode::jump_if_not_zero, 0, comparison->lhs);
+#define __ENUMERATE_FUSABLE_COMPARISON(name, negated_name, ...)                                                       \
+    case CompiledOpcode::name:                                                                                         \
+        return emit(jump_if_true ? CompiledOpcode::jump_if_##name : CompiledOpcode::jump_if_##negated_name, 0, comparison->lhs, comparison->rhs);
+        ENUMERATE_WASM_COMPILED_FUSED_COMPARISONS(__ENUMERATE_FUSABLE_COMPARISON)
+#undef __ENUMERATE_FUSABLE_COMPARISON
+    default:
+        VERIFY_NOT_REACHED();
+    }
+}
+
+bool FunctionCompiler::compile_unreachable_instruction(Instruction const& instruction)
+{
+    switch (instruction.opcode().value()) {
+    case Instructions::block.value():
+    case Instructions::loop.value():
+    case Instructions::if_.value():
+        ++m_unreachable_block_depth;
+        return true;
+    case Instructions::structured_else.value():
+        if (m_unreachable_block_depth == 0)
+            begin_else();
+        return true;
+    case Instructions::structured_end.value():
+        if (m_unreachable_block_depth > 0) {
+            --m_unreachable_block_depth;
+            return true;
+        }
+        end_block();
+        return true;
+    default:
+        return true;
+    }
+}
+
+bool FunctionCompiler::compile_instruction(Instruction const& instruction)
+{
+    if (!m_is_reachable)
+        return compile_unreachable_instruction(instruction);
+
+    switch (instruction.opcode().value()) {
+    case Instructions::unreachable.value():
+        emit(CompiledOpcode::unreachable);
+        m_is_reachable = false;
+        return true;
+    case Instructions::nop.value():
+        return true;
+    case Instructions::block.value():
+    case Instructions::loop.value():
+    case Instructions::if_.value(): {
+        auto& args = instruction.arguments().get<Instruction::StructuredInstructionArgs>();
+        auto signature = signature_of(args.block_type);
+        if (!signature.has_value())
+            return false;
+        if (instruction.opcode() == Instructions::if_)
+            begin_if(*signature);
+        else
+            begin_block(instruction.opcode() == Instructions::loop ? ControlFrame::Kind::Loop : ControlFrame::Kind::Block, *signature);
+        return true;
+    }
+    case Instructions::structured_else.value():
+        begin_else();
+        return true;
+    case Instructions::structured_end.value():
+        end_block();
+        return true;
+    case Instructions::br.value():
+        emit_branch(frame_for_label(instruction.arguments().get<LabelIndex>()));
+        m_is_reachable = false;
+        return true;
+    case Instructions::br_if.value(): {
+        auto condition = m_stack.take_last();
+        auto comparison = take_fusable_comparison(condition);
+        auto& frame = frame_for_label(instruction.arguments().get<LabelIndex>());
+        if (is_function_frame(frame) || branch_needs_copies(frame)) {
+            auto skip = emit_conditional_jump(condition, move(comparison), false);
+            emit_branch(frame);
+            patch_jump_to_here(skip);
+            return true;
+        }
+
+        auto jump = emit_conditional_jump(condition, move(comparison), true);
+        if (frame.kind == ControlFrame::Kind::Loop) {
+            m_instructions[jump].immediate = frame.loop_start;
+        } else {
+            frame.jumps_to_end.append(jump);
+            frame.is_end_reachable_by_branch = true;
+        }
+        return true;
+    }
+    case Instructions::br_table.value(): {
+        auto& args = instruction.arguments().get<Instruction::TableBranchArgs>();
+        auto index = m_stack.take_last();
+        auto table_offset = m_branch_table.size();
+        emit(CompiledOpcode::branch_table, 0, index, args.labels.size(), table_offset);
+        m_branch_table.resize(table_offset + args.labels.size() + 1);
+
+        // Branches that have to move values around get a little stub after the table; labels that are used more than
+        // once share theirs.
+        HashMap<u32, u32> targets_for_labels;
+        auto add_entry = [&](size_t entry, LabelIndex label) {
+            if (auto target = targets_for_labels.get(label.value()); target.has_value()) {
+                m_branch_table[entry] = *target;
+                return;
+            }
+            auto& frame = frame_for_label(label);
+            if (!is_function_frame(frame) && !branch_needs_copies(frame)) {
+                if (frame.kind == ControlFrame::Kind::Loop) {
+                    m_branch_table[entry] = frame.loop_start;
+                } else {
+                    frame.branch_table_entries_to_end.append(entry);
+                    frame.is_end_reachable_by_branch = true;
+                }
+                return;
+            }
+            m_branch_table[entry] = m_instructions.size();
+            targets_for_labels.set(label.value(), m_instructions.size());
+            emit_branch(frame);
+        };
+        for (size_t i = 0; i < args.labels.size(); ++i)
+            add_entry(table_offset + i, args.labels[i]);
+        add_entry(table_offset + args.labels.size(), args.default_);
+        m_is_reachable = false;
+        return true;
+    }
+    case Instructions::return_.value():
+        emit_return();
+        m_is_reachable = false;
+        return true;
+    case Instructions::call.value(): {
+        auto index = instruction.arguments().get<FunctionIndex>();
+        auto& type = *m_context.function_types[index.value()];
+        if (!is_numeric(type.parameters()) || !is_numeric(type.results()))
+            return false;
+        auto parameter_count = type.parameters().size();
+        materialize_top(parameter_count);
+        auto first_position = m_stack.size() - parameter_count;
+        emit(CompiledOpcode::call, parameter_count, stack_slot(first_position), type.results().size(), index.value());
+        m_stack.shrink(first_position);
+        for (size_t i = 0; i < type.results().size(); ++i)
+            push_own_slot();
+        return true;
+    }
+    case Instructions::drop.value():
+        m_stack.take_last();
+        return true;
+    case Instructions::select.value():
+    case Instructions::select_typed.value(): {
+        if (auto types = instruction.arguments().get_pointer<Vector<ValueType>>(); types && !is_numeric(*types))
+            return false;
+        auto condition = m_stack.take_last();
+        auto false_value = m_stack.take_last();
+        materialize(m_stack.size() - 1);
+        emit(CompiledOpcode::select, m_stack.last(), false_value, condition);
+        return true;
+    }
+    case Instructions::local_get.value():
+        push_alias(instruction.arguments().get<LocalIndex>().value());
+        return true;
+    case Instructions::local_set.value():
+    case Instructions::local_tee.value(): {
+        auto local = instruction.arguments().get<LocalIndex>().value();
+        auto is_tee = instruction.opcode() == Instructions::local_tee;
+        auto top_position = m_stack.size() - 1;
+        auto source = m_stack[top_position];
+        if (source != local) {
+            // OPTIMIZATION: If the value was just computed into its own slot, compute it straight into the local instead.
+            if (m_last_value_producer == m_instructions.size() - 1 && m_instructions.last().destination == source && source == stack_slot(top_position) && !has_alias_of(local, top_position)) {
+                m_instructions.last().destination = local;
+                m_stack[top_position] = local;
+            } else {
+                materialize_aliases_of(local, top_position);
+                emit(CompiledOpcode::copy, local, source);
+            }
+        }
+        m_last_value_producer.clear();
+        if (!is_tee)
+            m_stack.take_last();
+        return true;
+    }
+    case Instructions::global_get.value(): {
+        auto index = instruction.arguments().get<GlobalIndex>().value();
+        if (!m_context.global_types[index].is_numeric())
+            return false;
+        emit_value_producer(CompiledOpcode::global_get, 0, 0, index);
+        return true;
+    }
+    case Instructions::global_set.value(): {
+        auto index = instruction.arguments().get<GlobalIndex>().value();
+        if (!m_context.global_types[index].is_numeric())
+            return false;
+        emit(CompiledOpcode::global_set, 0, m_stack.take_last(), 0, index);
+        return true;
+    }
+    case Instructions::memory_size.value():
+        emit_value_producer(CompiledOpcode::memory_size, 0, 0, instruction.arguments().get<Instruction::MemoryIndexArgument>().memory_index.value());
+        return true;
+    case Instructions::memory_grow.value(): {
+        auto delta = m_stack.take_last();
+        emit_value_producer(CompiledOpcode::memory_grow, delta, 0, instruction.arguments().get<Instruction::MemoryIndexArgument>().memory_index.value());
+        return true;
+    }
+    case Instructions::i32_const.value():
+        push_constant(static_cast<u64>(static_cast<i64>(instruction.arguments().get<i32>())));
+        return true;
+    case Instructions::i64_const.value():
+        push_constant(bit_cast<u64>(instruction.arguments().get<i64>()));
+        return true;
+    case Instructions::f32_const.value():
+        push_constant(static_cast<u64>(static_cast<i64>(bit_cast<i32>(instruction.arguments().get<float>()))));
+        return true;
+    case Instructions::f64_const.value():
+        push_constant(bit_cast<u64>(instruction.arguments().get<double>()));
+        return true;
+
+#define __ENUMERATE_BINARY_OPERATION(name, ...) \
+    case Instructions::name.value():            \
+        emit_binary_operation(CompiledOpcode::name); \
+        return true;
+        ENUMERATE_WASM_COMPILED_BINARY_OPERATIONS(__ENUMERATE_BINARY_OPERATION)
+#undef __ENUMERATE_BINARY_OPERATION
+
+#define __ENUMERATE_UNARY_OPERATION(name, ...) \
+    case Instructions::name.value():           \
+        emit_unary_operation(CompiledOpcode::name); \
+        return true;
+        ENUMERATE_WASM_COMPILED_UNARY_OPERATIONS(__ENUMERATE_UNARY_OPERATION)
+#undef __ENUMERATE_UNARY_OPERATION
+
+#define __ENUMERATE_LOAD(name, ...)                                                         \
+    case Instructions::name.value(): {                                                      \
+        auto& memory_argument = instruction.arguments().get<Instruction::MemoryArgument>(); \
+        auto address = m_stack.take_last();                                                 \
+        emit_value_producer(CompiledOpcode::name, address, memory_argument.memory_index.value(), memory_argument.offset); \
+        return true;                                                                        \
+    }
+        ENUMERATE_WASM_COMPILED_LOADS(__ENUMERATE_LOAD)
+#undef __ENUMERATE_LOAD
+
+#define __ENUMERATE_STORE(name, ...)                                                        \
+    case Instructions::name.value(): {                                                      \
+        auto& memory_argument = instruction.arguments().get<Instruction::MemoryArgument>(); \
+        auto value = m_stack.take_last();                                                   \
+        auto address = m_stack.take_last();                                                \
+        emit(CompiledOpcode::name, memory_argument.memory_index.value(), address, value, memory_argument.offset); \
+        return true;                                                                        \
+    }
+        ENUMERATE_WASM_COMPILED_STORES(__ENUMERATE_STORE)
+#undef __ENUMERATE_STORE
+
+    default:
+        return false;
+    }
+}
+
+RefPtr<CompiledFunction const> FunctionCompiler::compile()
+{
+    if (!is_numeric(m_type.parameters()) || !is_numeric(m_type.results()))
+        return nullptr;
+
+    Checked<u32> local_count = static_cast<u32>(m_type.parameters().size());
+    for (auto& locals : m_code.func().locals()) {
+        if (!locals.type().is_numeric())
+            return nullptr;
+        local_count += locals.n();
+        if (local_count.has_overflow() || local_count.value() > max_slot_count)
+            return nullptr;
+    }
+    m_local_count = local_count.value();
+
+    m_control_stack.append({
+        .kind = ControlFrame::Kind::Block,
+        .signature = { 0, static_cast<u32>(m_type.results().size()) },
+        .base = 0,
+        .loop_start = 0,
+        .jump_to_else = {},
+        .jumps_to_end = {},
+        .branch_table_entries_to_end = {},
+        .is_end_reachable_by_branch = false,
+    });
+
+    for (auto& instruction : m_code.func().body().instructions()) {
+        if (!compile_instruction(instruction))
+            return nullptr;
+    }
+
+    // The function body's own end isn't part of its instructions.
+    end_block();
+
+    auto constants_base = m_local_count + m_max_stack_height;
+    if (constants_base + m_constants.size() > max_slot_count)
+        return nullptr;
+
+    auto resolve_slot = [&](u32& operand) {
+        if (operand & constant_slot_tag)
+            operand = constants_base + (operand & ~constant_slot_tag);
+    };
+    for (auto& instruction : m_instructions) {
+        resolve_slot(instruction.lhs);
+        resolve_slot(instruction.rhs);
+    }
+
+    auto function = adopt_ref(*new CompiledFunction);
+    function->m_instructions = move(m_instructions);
+    function->m_branch_table = move(m_branch_table);
+    function->m_constants = move(m_constants);
+    function->m_constants_base = constants_base;
+    return function;
+}
+
+Vector<RefPtr<CompiledFunction const>> CompiledFunction::compile_all(Module const& module)
+{
+    ModuleContext context { module, {}, {} };
+    for (auto& import_ : module.import_section().imports()) {
+        import_.description().visit(
+            [&](TypeIndex const& index) { context.function_types.append(&module.type_section().types()[index.value()]); },
+            [&](FunctionType const& type) { context.function_types.append(&type); },
+            [&](GlobalType const& type) { context.global_types.append(type.type()); },
+            [](auto const&) {});
+    }
+    for (auto& index : module.function_section().types())
+        context.function_types.append(&module.type_section().types()[index.value()]);
+    for (auto& global : module.global_section().entries())
+        context.global_types.append(global.type().type());
+
+    auto& code = module.code_section().functions();
+    auto compile = [&](size_t index) {
+        auto& type = module.type_section().types()[module.function_section().types()[index].value()];
+        return FunctionCompiler { context, type, code[index] }.compile();
+    };
+
+    size_t code_size = 0;
+    for (auto& entry : code)
+        code_size += entry.size();
+
+    Vector<RefPtr<CompiledFunction const>> functions;
+    if (!should_process_functions_in_parallel(code_size)) {
+        functions.ensure_capacity(code.size());
+        for (size_t i = 0; i < code.size(); ++i)
+            functions.unchecked_append(compile(i));
+        return functions;
+    }
+
+    // OPTIMIZATION: Functions are compiled independently of each other, so spread them over several threads.
+    functions.resize(code.size());
+    parallel_for(code.size(), [&](size_t index, size_t) {
+        functions[index] = compile(index);
+    });
+    return functions;
+}
+
+}
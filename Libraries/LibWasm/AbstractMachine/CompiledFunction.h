@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/RefCounted.h>
+#include <AK/RefPtr.h>
+#include <AK/Vector.h>
+#include <LibWasm/Types.h>
+
+namespace Wasm {
+
+// O(name, PopType, PushType, Operator)
+#define ENUMERATE_WASM_COMPILED_BINARY_OPERATIONS(O)       \
+    O(i32_eq, i32, i32, Operators::Equals)                 \
+    O(i32_ne, i32, i32, Operators::NotEquals)              \
+    O(i32_lts, i32, i32, Operators::LessThan)              \
+    O(i32_ltu, u32, i32, Operators::LessThan)              \
+    O(i32_gts, i32, i32, Operators::GreaterThan)           \
+    O(i32_gtu, u32, i32, Operators::GreaterThan)           \
+    O(i32_les, i32, i32, Operators::LessThanOrEquals)      \
+    O(i32_leu, u32, i32, Operators::LessThanOrEquals)      \
+    O(i32_ges, i32, i32, Operators::GreaterThanOrEquals)   \
+    O(i32_geu, u32, i32, Operators::GreaterThanOrEquals)   \
+    O(i64_eq, i64, i32, Operators::Equals)                 \
+    O(i64_ne, i64, i32, Operators::NotEquals)              \
+    O(i64_lts, i64, i32, Operators::LessThan)              \
+    O(i64_ltu, u64, i32, Operators::LessThan)              \
+    O(i64_gts, i64, i32, Operators::GreaterThan)           \
+    O(i64_gtu, u64, i32, Operators::GreaterThan)           \
+    O(i64_les, i64, i32, Operators::LessThanOrEquals)      \
+    O(i64_leu, u64, i32, Operators::LessThanOrEquals)      \
+    O(i64_ges, i64, i32, Operators::GreaterThanOrEquals)   \
+    O(i64_geu, u64, i32, Operators::GreaterThanOrEquals)   \
+    O(f32_eq, float, i32, Operators::Equals)               \
+    O(f32_ne, float, i32, Operators::NotEquals)            \
+    O(f32_lt, float, i32, Operators::LessThan)             \
+    O(f32_gt, float, i32, Operators::GreaterThan)          \
+    O(f32_le, float, i32, Operators::LessThanOrEquals)     \
+    O(f32_ge, float, i32, Operators::GreaterThanOrEquals)  \
+    O(f64_eq, double, i32, Operators::Equals)              \
+    O(f64_ne, double, i32, Operators::NotEquals)           \
+    O(f64_lt, double, i32, Operators::LessThan)            \
+    O(f64_gt, double, i32, Operators::GreaterThan)         \
+    O(f64_le, double, i32, Operators::LessThanOrEquals)    \
+    O(f64_ge, double, i32, Operators::GreaterThanOrEquals) \
+    O(i32_add, u32, i32, Operators::Add)                   \
+    O(i32_sub, u32, i32, Operators::Subtract)              \
+    O(i32_mul, u32, i32, Operators::Multiply)              \
+    O(i32_divs, i32, i32, Operators::Divide)               \
+    O(i32_divu, u32, i32, Operators::Divide)               \
+    O(i32_rems, i32, i32, Operators::Modulo)               \
+    O(i32_remu, u32, i32, Operators::Modulo)               \
+    O(i32_and, i32, i32, Operators::BitAnd)                \
+    O(i32_or, i32, i32, Operators::BitOr)                  \
+    O(i32_xor, i32, i32, Operators::BitXor)                \
+    O(i32_shl, u32, i32, Operators::BitShiftLeft)          \
+    O(i32_shrs, i32, i32, Operators::BitShiftRight)        \
+    O(i32_shru, u32, i32, Operators::BitShiftRight)        \
+    O(i32_rotl, u32, i32, Operators::BitRotateLeft)        \
+    O(i32_rotr, u32, i32, Operators::BitRotateRight)       \
+    O(i64_add, u64, i64, Operators::Add)                   \
+    O(i64_sub, u64, i64, Operators::Subtract)              \
+    O(i64_mul, u64, i64, Operators::Multiply)              \
+    O(i64_divs, i64, i64, Operators::Divide)               \
+    O(i64_divu, u64, i64, Operators::Divide)               \
+    O(i64_rems, i64, i64, Operators::Modulo)               \
+    O(i64_remu, u64, i64, Operators::Modulo)               \
+    O(i64_and, i64, i64, Operators::BitAnd)                \
+    O(i64_or, i64, i64, Operators::BitOr)                  \
+    O(i64_xor, i64, i64, Operators::BitXor)                \
+    O(i64_shl, u64, i64, Operators::BitShiftLeft)          \
+    O(i64_shrs, i64, i64, Operators::BitShiftRight)        \
+    O(i64_shru, u64, i64, Operators::BitShiftRight)        \
+    O(i64_rotl, u64, i64, Operators::BitRotateLeft)        \
+    O(i64_rotr, u64, i64, Operators::BitRotateRight)       \
+    O(f32_add, float, float, Operators::Add)               \
+    O(f32_sub, float, float, Operators::Subtract)          \
+    O(f32_mul, float, float, Operators::Multiply)          \
+    O(f32_div, float, float, Operators::Divide)            \
+    O(f32_min, float, float, Operators::Minimum)           \
+    O(f32_max, float, float, Operators::Maximum)           \
+    O(f32_copysign, float, float, Operators::CopySign)     \
+    O(f64_add, double, double, Operators::Add)             \
+    O(f64_sub, double, double, Operators::Subtract)        \
+    O(f64_mul, double, double, Operators::Multiply)        \
+    O(f64_div, double, double, Operators::Divide)          \
+    O(f64_min, double, double, Operators::Minimum)         \
+    O(f64_max, double, double, Operators::Maximum)         \
+    O(f64_copysign, double, double, Operators::CopySign)
+
+// O(name, PopType, PushType, Operator)
+#define ENUMERATE_WASM_COMPILED_UNARY_OPERATIONS(O)                         \
+    O(i32_eqz, i32, i32, Operators::EqualsZero)                             \
+    O(i64_eqz, i64, i32, Operators::EqualsZero)                             \
+    O(i32_clz, i32, i32, Operators::CountLeadingZeros)                      \
+    O(i32_ctz, i32, i32, Operators::CountTrailingZeros)                     \
+    O(i32_popcnt, i32, i32, Operators::PopCount)                            \
+    O(i64_clz, i64, i64, Operators::CountLeadingZeros)                      \
+    O(i64_ctz, i64, i64, Operators::CountTrailingZeros)                     \
+    O(i64_popcnt, i64, i64, Operators::PopCount)                            \
+    O(f32_abs, float, float, Operators::Absolute)                           \
+    O(f32_neg, float, float, Operators::Negate)                             \
+    O(f32_ceil, float, float, Operators::Ceil)                              \
+    O(f32_floor, float, float, Operators::Floor)                            \
+    O(f32_trunc, float, float, Operators::Truncate)                         \
+    O(f32_nearest, float, float, Operators::NearbyIntegral)                 \
+    O(f32_sqrt, float, float, Operators::SquareRoot)                        \
+    O(f64_abs, double, double, Operators::Absolute)                         \
+    O(f64_neg, double, double, Operators::Negate)                           \
+    O(f64_ceil, double, double, Operators::Ceil)                            \
+    O(f64_floor, double, double, Operators::Floor)                          \
+    O(f64_trunc, double, double, Operators::Truncate)                       \
+    O(f64_nearest, double, double, Operators::NearbyIntegral)               \
+    O(f64_sqrt, double, double, Operators::SquareRoot)                      \
+    O(i32_wrap_i64, i64, i32, Operators::Wrap<i32>)                         \
+    O(i32_trunc_sf32, float, i32, Operators::CheckedTruncate<i32>)          \
+    O(i32_trunc_uf32, float, i32, Operators::CheckedTruncate<u32>)          \
+    O(i32_trunc_sf64, double, i32, Operators::CheckedTruncate<i32>)         \
+    O(i32_trunc_uf64, double, i32, Operators::CheckedTruncate<u32>)         \
+    O(i64_trunc_sf32, float, i64, Operators::CheckedTruncate<i64>)          \
+    O(i64_trunc_uf32, float, i64, Operators::CheckedTruncate<u64>)          \
+    O(i64_trunc_sf64, double, i64, Operators::CheckedTruncate<i64>)         \
+    O(i64_trunc_uf64, double, i64, Operators::CheckedTruncate<u64>)         \
+    O(i64_extend_si32, i32, i64, Operators::Extend<i64>)                    \
+    O(i64_extend_ui32, u32, i64, Operators::Extend<i64>)                    \
+    O(f32_convert_si32, i32, float, Operators::Convert<float>)              \
+    O(f32_convert_ui32, u32, float, Operators::Convert<float>)              \
+    O(f32_convert_si64, i64, float, Operators::Convert<float>)              \
+    O(f32_convert_ui64, u64, float, Operators::Convert<float>)              \
+    O(f32_demote_f64, double, float, Operators::Demote)                     \
+    O(f64_convert_si32, i32, double, Operators::Convert<double>)            \
+    O(f64_convert_ui32, u32, double, Operators::Convert<double>)            \
+    O(f64_convert_si64, i64, double, Operators::Convert<double>)            \
+    O(f64_convert_ui64, u64, double, Operators::Convert<double>)            \
+    O(f64_promote_f32, float, double, Operators::Promote)                   \
+    O(i32_reinterpret_f32, float, i32, Operators::Reinterpret<i32>)         \
+    O(i64_reinterpret_f64, double, i64, Operators::Reinterpret<i64>)        \
+    O(f32_reinterpret_i32, i32, float, Operators::Reinterpret<float>)       \
+    O(f64_reinterpret_i64, i64, double, Operators::Reinterpret<double>)     \
+    O(i32_extend8_s, i32, i32, Operators::SignExtend<i8>)                   \
+    O(i32_extend16_s, i32, i32, Operators::SignExtend<i16>)                 \
+    O(i64_extend8_s, i64, i64, Operators::SignExtend<i8>)                   \
+    O(i64_extend16_s, i64, i64, Operators::SignExtend<i16>)                 \
+    O(i64_extend32_s, i64, i64, Operators::SignExtend<i32>)                 \
+    O(i32_trunc_sat_f32_s, float, i32, Operators::SaturatingTruncate<i32>)  \
+    O(i32_trunc_sat_f32_u, float, i32, Operators::SaturatingTruncate<u32>)  \
+    O(i32_trunc_sat_f64_s, double, i32, Operators::SaturatingTruncate<i32>) \
+    O(i32_trunc_sat_f64_u, double, i32, Operators::SaturatingTruncate<u32>) \
+    O(i64_trunc_sat_f32_s, float, i64, Operators::SaturatingTruncate<i64>)  \
+    O(i64_trunc_sat_f32_u, float, i64, Operators::SaturatingTruncate<u64>)  \
+    O(i64_trunc_sat_f64_s, double, i64, Operators::SaturatingTruncate<i64>) \
+    O(i64_trunc_sat_f64_u, double, i64, Operators::SaturatingTruncate<u64>)
+
+// O(name, ReadType, PushType)
+#define ENUMERATE_WASM_COMPILED_LOADS(O) \
+    O(i32_load, i32, i32)                \
+    O(i64_load, i64, i64)                \
+    O(f32_load, float, float)            \
+    O(f64_load, double, double)          \
+    O(i32_load8_s, i8, i32)              \
+    O(i32_load8_u, u8, i32)              \
+    O(i32_load16_s, i16, i32)            \
+    O(i32_load16_u, u16, i32)            \
+    O(i64_load8_s, i8, i64)              \
+    O(i64_load8_u, u8, i64)              \
+    O(i64_load16_s, i16, i64)            \
+    O(i64_load16_u, u16, i64)            \
+    O(i64_load32_s, i32, i64)            \
+    O(i64_load32_u, u32, i64)
+
+// O(name, PopType, StoreType)
+#define ENUMERATE_WASM_COMPILED_STORES(O) \
+    O(i32_store, i32, i32)                \
+    O(i64_store, i64, i64)                \
+    O(f32_store, float, float)            \
+    O(f64_store, double, double)          \
+    O(i32_store8, i32, i8)                \
+    O(i32_store16, i32, i16)              \
+    O(i64_store8, i64, i8)                \
+    O(i64_store16, i64, i16)              \
+    O(i64_store32, i64, i32)
+
+// O(name, negated name, PopType, Operator)
+#define ENUMERATE_WASM_COMPILED_FUSED_COMPARISONS(O)         \
+    O(i32_eq, i32_ne, i32, Operators::Equals)                \
+    O(i32_ne, i32_eq, i32, Operators::NotEquals)             \
+    O(i32_lts, i32_ges, i32, Operators::LessThan)            \
+    O(i32_ltu, i32_geu, u32, Operators::LessThan)            \
+    O(i32_gts, i32_les, i32, Operators::GreaterThan)         \
+    O(i32_gtu, i32_leu, u32, Operators::GreaterThan)         \
+    O(i32_les, i32_gts, i32, Operators::LessThanOrEquals)    \
+    O(i32_leu, i32_gtu, u32, Operators::LessThanOrEquals)    \
+    O(i32_ges, i32_lts, i32, Operators::GreaterThanOrEquals) \
+    O(i32_geu, i32_ltu, u32, Operators::GreaterThanOrEquals) \
+    O(i64_eq, i64_ne, i64, Operators::Equals)                \
+    O(i64_ne, i64_eq, i64, Operators::NotEquals)             \
+    O(i64_lts, i64_ges, i64, Operators::LessThan)            \
+    O(i64_ltu, i64_geu, u64, Operators::LessThan)            \
+    O(i64_gts, i64_les, i64, Operators::GreaterThan)         \
+    O(i64_gtu, i64_leu, u64, Operators::GreaterThan)         \
+    O(i64_les, i64_gts, i64, Operators::LessThanOrEquals)    \
+    O(i64_leu, i64_gtu, u64, Operators::LessThanOrEquals)    \
+    O(i64_ges, i64_lts, i64, Operators::GreaterThanOrEquals) \
+    O(i64_geu, i64_ltu, u64, Operators::GreaterThanOrEquals)
+
+enum class CompiledOpcode : u16 {
+    // destination = lhs
+    copy,
+    // if (rhs == 0) destination = lhs
+    select,
+    // Jumps to the instruction at immediate.
+    jump,
+    jump_if_zero,
+    jump_if_not_zero,
+    // Jumps to branch_table[immediate + min(lhs, rhs)].
+    branch_table,
+    // Calls function immediate with the destination arguments starting at lhs, and puts its rhs results there.
+    call,
+    // Returns rhs results starting at lhs.
+    return_,
+    unreachable,
+    global_get,
+    global_set,
+    memory_size,
+    memory_grow,
+
+#define __ENUMERATE_COMPILED_OPCODE(name, ...) name,
+    ENUMERATE_WASM_COMPILED_BINARY_OPERATIONS(__ENUMERATE_COMPILED_OPCODE)
+    ENUMERATE_WASM_COMPILED_UNARY_OPERATIONS(__ENUMERATE_COMPILED_OPCODE)
+    ENUMERATE_WASM_COMPILED_LOADS(__ENUMERATE_COMPILED_OPCODE)
+    ENUMERATE_WASM_COMPILED_STORES(__ENUMERATE_COMPILED_OPCODE)
+#undef __ENUMERATE_COMPILED_OPCODE
+
+    // A comparison fused with the conditional jump that consumes it.
+#define __ENUMERATE_COMPILED_OPCODE(name, ...) jump_if_##name,
+    ENUMERATE_WASM_COMPILED_FUSED_COMPARISONS(__ENUMERATE_COMPILED_OPCODE)
+#undef __ENUMERATE_COMPILED_OPCODE
+};
+
+// All operands are indices into the frame's slots, except where noted above. Loads take the memory index in rhs and
+// stores take it in destination; both take the memory offset in immediate.
+struct CompiledInstruction {
+    CompiledOpcode opcode;
+    u32 destination { 0 };
+    u32 lhs { 0 };
+    u32 rhs { 0 };
+    u64 immediate { 0 };
+};
+
+// A function lowered from the stack machine into a register machine over a fixed-size frame of 64-bit slots: the
+// locals come first, then one slot per operand stack position, then the constants the function uses. Branch targets
+// are resolved to instruction indices, and values only move between slots where control flow merges.
+class CompiledFunction : public RefCounted<CompiledFunction> {
+public:
+    // Compiles every function in a validated module. Functions that use anything not covered here (vectors,
+    // references, tables, bulk memory operations, ...) are left null, and run in the bytecode interpreter instead.
+    static Vector<RefPtr<CompiledFunction const>> compile_all(Module const&);
+
+    auto& instructions() const { return m_instructions; }
+    auto& branch_table() const { return m_branch_table; }
+    auto& constants() const { return m_constants; }
+    auto constants_base() const { return m_constants_base; }
+    auto slot_count() const { return m_constants_base + m_constants.size(); }
+
+private:
+    friend class FunctionCompiler;
+
+    CompiledFunction() = default;
+
+    Vector<CompiledInstruction> m_instructions;
+    Vector<u32> m_branch_table;
+    Vector<u64> m_constants;
+    u32 m_constants_base { 0 };
+};
+
+}
@@ -160,6 +160,63 @@ struct BitRotateRight {
     static StringView name() { return "rotate_right"sv; }
 };
 
+template<typename ResultT, typename Op>
+struct SaturatingOp;
+
+// NOTE: The vector operators below work lane by lane in general, but the common operations are lowered onto operations
+//       on whole vectors instead, which the compiler maps onto the host's SIMD instructions (SSE/AVX, NEON, ...).
+namespace Detail {
+
+template<typename VectorType, typename T>
+ALWAYS_INLINE static VectorType clamp(VectorType value, T min, T max)
+{
+    using Element = RemoveCVReference<decltype(value[0])>;
+    auto min_vector = VectorType {} + static_cast<Element>(min);
+    auto max_vector = VectorType {} + static_cast<Element>(max);
+    auto clamped_below = value < min_vector ? min_vector : value;
+    return clamped_below > max_vector ? max_vector : clamped_below;
+}
+
+// Returns `Count` lanes of `vector`, starting at `Offset`.
+template<size_t Offset, size_t Count, typename VectorType>
+ALWAYS_INLINE static auto lanes_of(VectorType vector)
+{
+    return [&]<size_t... Idx>(IndexSequence<Idx...>) {
+        return __builtin_shufflevector(vector, vector, (Offset + Idx)...);
+    }(MakeIndexSequence<Count>());
+}
+
+// Returns every other lane of `vector`, starting at `Offset`.
+template<size_t Offset, typename VectorType>
+ALWAYS_INLINE static auto alternate_lanes_of(VectorType vector)
+{
+    return [&]<size_t... Idx>(IndexSequence<Idx...>) {
+        return __builtin_shufflevector(vector, vector, (Offset + Idx * 2)...);
+    }(MakeIndexSequence<vector_length<VectorType> / 2>());
+}
+
+template<typename VectorType>
+ALWAYS_INLINE static auto concatenate(VectorType low, VectorType high)
+{
+    return [&]<size_t... Idx>(IndexSequence<Idx...>) {
+        return __builtin_shufflevector(low, high, Idx...);
+    }(MakeIndexSequence<vector_length<VectorType> * 2>());
+}
+
+template<typename Op>
+struct SaturatingOpTraits {
+    static constexpr bool is_saturating = false;
+};
+
+template<typename ResultT, typename Op>
+struct SaturatingOpTraits<SaturatingOp<ResultT, Op>> {
+    static constexpr bool is_saturating = true;
+    using ResultType = ResultT;
+    using Operation = Op;
+};
+
+}
+
 template<size_t VectorSize, template<typename> typename SetSign = MakeSigned>
 struct VectorAllTrue {
     auto operator()(u128 c) const
@@ -247,6 +304,25 @@ struct VectorSwizzle {
     static StringView name() { return "vec(8x16).swizzle"sv; }
 };
 
+struct VectorShuffle {
+    u8 const* lanes;
+
+    auto operator()(u128 c1, u128 c2) const
+    {
+        // https://webassembly.github.io/spec/core/exec/instructions.html#xref-syntax-instructions-syntax-instr-vec-mathsf-i8x16-shuffle-x-ast
+        using VectorType = Native128ByteVectorOf<u8, MakeUnsigned>;
+        VectorType control;
+        __builtin_memcpy(&control, lanes, sizeof(control));
+        // NOTE: Lanes 0-15 pick from the first vector, and 16-31 from the second one. Subtracting 16 moves the latter into
+        //       range, and the former out of it (so they turn into zeros).
+        auto from_first = shuffle_or_0(bit_cast<VectorType>(c1), control);
+        auto from_second = shuffle_or_0(bit_cast<VectorType>(c2), control - 16);
+        return bit_cast<u128>(from_first | from_second);
+    }
+
+    static StringView name() { return "vec(8x16).shuffle"sv; }
+};
+
 template<size_t VectorSize, template<typename> typename SetSign>
 struct VectorExtractLane {
     size_t lane;
@@ -335,6 +411,11 @@ struct VectorCmpOp {
     auto operator()(u128 c1, u128 c2) const
     {
         using ElementType = NativeIntegralType<128 / VectorSize>;
+        if constexpr (IsOneOf<Op, Equals, NotEquals, LessThan, LessThanOrEquals, GreaterThan, GreaterThanOrEquals>) {
+            using VectorType = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
+            return bit_cast<u128>(Op {}(bit_cast<VectorType>(c1), bit_cast<VectorType>(c2)));
+        }
+
         auto result = bit_cast<Native128ByteVectorOf<ElementType, SetSign>>(c1);
         auto other = bit_cast<Native128ByteVectorOf<ElementType, SetSign>>(c2);
         Op op;
@@ -369,6 +450,9 @@ struct VectorFloatCmpOp {
     {
         auto first = bit_cast<NativeFloatingVectorType<128, VectorSize, NativeFloatingType<128 / VectorSize>>>(c1);
         auto other = bit_cast<NativeFloatingVectorType<128, VectorSize, NativeFloatingType<128 / VectorSize>>>(c2);
+        if constexpr (IsOneOf<Op, Equals, NotEquals, LessThan, LessThanOrEquals, GreaterThan, GreaterThanOrEquals>)
+            return bit_cast<u128>(Op {}(first, other));
+
         using ElementType = NativeIntegralType<128 / VectorSize>;
         Native128ByteVectorOf<ElementType, MakeUnsigned> result;
         Op op;
@@ -573,10 +657,14 @@ struct VectorIntegerExtOpPairwise {
         using VectorResult = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
         using VectorInput = NativeVectorType<128 / (VectorSize * 2), VectorSize * 2, SetSign>;
         auto vector = bit_cast<VectorInput>(c);
-        VectorResult result;
         Op op;
+        if constexpr (IsSame<Op, Add>) {
+            auto even = __builtin_convertvector(Detail::alternate_lanes_of<0>(vector), VectorResult);
+            auto odd = __builtin_convertvector(Detail::alternate_lanes_of<1>(vector), VectorResult);
+            return bit_cast<u128>(op(even, odd));
+        }
 
-        // FIXME: Find a way to not loop here
+        VectorResult result;
         for (size_t i = 0; i < VectorSize; ++i) {
             result[i] = op(vector[i * 2], vector[(i * 2) + 1]);
         }
@@ -611,19 +699,8 @@ struct VectorIntegerExt {
         using VectorResult = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
         using VectorInput = NativeVectorType<128 / (VectorSize * 2), VectorSize * 2, SetSign>;
         auto vector = bit_cast<VectorInput>(c);
-        VectorResult result;
-
-        // FIXME: Find a way to not loop here
-        for (size_t i = 0; i < VectorSize; ++i) {
-            if constexpr (Mode == VectorExt::High)
-                result[i] = vector[VectorSize + i];
-            else if constexpr (Mode == VectorExt::Low)
-                result[i] = vector[i];
-            else
-                VERIFY_NOT_REACHED();
-        }
-
-        return bit_cast<u128>(result);
+        constexpr size_t offset = Mode == VectorExt::High ? VectorSize : 0;
+        return bit_cast<u128>(__builtin_convertvector((Detail::lanes_of<offset, VectorSize>(vector)), VectorResult));
     }
 
     static StringView name()
@@ -649,11 +726,17 @@ struct VectorIntegerExtOp {
         using VectorInput = NativeVectorType<128 / (VectorSize * 2), VectorSize * 2, SetSign>;
         auto first = bit_cast<VectorInput>(lhs);
         auto second = bit_cast<VectorInput>(rhs);
-        VectorResult result;
         Op op;
+        if constexpr (IsSame<Op, Multiply>) {
+            // NOTE: The product of two lanes always fits in a lane twice their size.
+            constexpr size_t offset = Mode == VectorExt::High ? VectorSize : 0;
+            auto a = __builtin_convertvector((Detail::lanes_of<offset, VectorSize>(first)), VectorResult);
+            auto b = __builtin_convertvector((Detail::lanes_of<offset, VectorSize>(second)), VectorResult);
+            return bit_cast<u128>(op(a, b));
+        }
 
+        VectorResult result;
         using ResultType = SetSign<NativeIntegralType<128 / VectorSize>>;
-        // FIXME: Find a way to not loop here
         for (size_t i = 0; i < VectorSize; ++i) {
             if constexpr (Mode == VectorExt::High) {
                 ResultType a = first[VectorSize + i];
@@ -690,12 +773,35 @@ struct VectorIntegerBinaryOp {
     auto operator()(u128 lhs, u128 rhs) const
     {
         using VectorType = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
+        using UnsignedVectorType = NativeVectorType<128 / VectorSize, VectorSize, MakeUnsigned>;
         auto first = bit_cast<VectorType>(lhs);
         auto second = bit_cast<VectorType>(rhs);
-        VectorType result;
         Op op;
 
-        // FIXME: Find a way to not loop here
+        if constexpr (IsOneOf<Op, Add, Subtract, Multiply>) {
+            // NOTE: These wrap around, so do them on unsigned lanes.
+            return bit_cast<u128>(op(bit_cast<UnsignedVectorType>(first), bit_cast<UnsignedVectorType>(second)));
+        } else if constexpr (IsSame<Op, Minimum>) {
+            return bit_cast<u128>(first < second ? first : second);
+        } else if constexpr (IsSame<Op, Maximum>) {
+            return bit_cast<u128>(first > second ? first : second);
+        } else if constexpr (Detail::SaturatingOpTraits<Op>::is_saturating) {
+            // NOTE: Do the operation on lanes twice as big (where it can't overflow), and saturate on the way back.
+            //       Each half of the vector is done separately, to stick to 128-bit vectors.
+            using ResultType = typename Detail::SaturatingOpTraits<Op>::ResultType;
+            using WideHalfVectorType = NativeVectorType<2 * 128 / VectorSize, VectorSize / 2, MakeSigned>;
+            using HalfVectorType = NativeVectorType<128 / VectorSize, VectorSize / 2, SetSign>;
+            typename Detail::SaturatingOpTraits<Op>::Operation operation;
+            auto saturate_half = [&]<size_t Offset>() {
+                auto a = __builtin_convertvector((Detail::lanes_of<Offset, VectorSize / 2>(first)), WideHalfVectorType);
+                auto b = __builtin_convertvector((Detail::lanes_of<Offset, VectorSize / 2>(second)), WideHalfVectorType);
+                WideHalfVectorType result = operation(a, b);
+                return __builtin_convertvector(Detail::clamp(result, NumericLimits<ResultType>::min(), NumericLimits<ResultType>::max()), HalfVectorType);
+            };
+            return bit_cast<u128>(Detail::concatenate(saturate_half.template operator()<0>(), saturate_half.template operator()<VectorSize / 2>()));
+        }
+
+        VectorType result;
         for (size_t i = 0; i < VectorSize; ++i) {
             result[i] = op(first[i], second[i]);
         }
@@ -743,18 +849,18 @@ struct VectorDotProduct {
     {
         using VectorInput = NativeVectorType<128 / (VectorSize * 2), VectorSize * 2, MakeSigned>;
         using VectorResult = NativeVectorType<128 / VectorSize, VectorSize, MakeSigned>;
+        using UnsignedVectorResult = NativeVectorType<128 / VectorSize, VectorSize, MakeUnsigned>;
         auto v1 = bit_cast<VectorInput>(lhs);
         auto v2 = bit_cast<VectorInput>(rhs);
-        VectorResult result;
 
-        using ResultType = MakeUnsigned<NativeIntegralType<128 / VectorSize>>;
-        for (size_t i = 0; i < VectorSize; ++i) {
-            ResultType low = v1[i * 2] * v2[i * 2];
-            ResultType high = v1[(i * 2) + 1] * v2[(i * 2) + 1];
-            result[i] = low + high;
-        }
+        auto products_of_lanes = [&]<size_t Offset>() {
+            auto a = __builtin_convertvector(Detail::alternate_lanes_of<Offset>(v1), VectorResult);
+            auto b = __builtin_convertvector(Detail::alternate_lanes_of<Offset>(v2), VectorResult);
+            return bit_cast<UnsignedVectorResult>(a * b);
+        };
 
-        return bit_cast<u128>(result);
+        // NOTE: Each product fits in a lane, but their sum may not, so add them up as unsigned to let it wrap around.
+        return bit_cast<u128>(products_of_lanes.template operator()<0>() + products_of_lanes.template operator()<1>());
     }
 
     static StringView name() { return "dot"sv; }
@@ -766,28 +872,14 @@ struct VectorNarrow {
     {
         using VectorInput = NativeVectorType<128 / (VectorSize / 2), VectorSize / 2, MakeSigned>;
         using VectorResult = NativeVectorType<128 / VectorSize, VectorSize, MakeUnsigned>;
-        auto v1 = bit_cast<VectorInput>(lhs);
-        auto v2 = bit_cast<VectorInput>(rhs);
-        VectorResult result;
+        using VectorHalfResult = NativeVectorType<128 / VectorSize, VectorSize / 2, MakeUnsigned>;
+        static_assert(sizeof(VectorHalfResult) * 2 == sizeof(VectorResult));
 
-        for (size_t i = 0; i < (VectorSize / 2); ++i) {
-            if (v1[i] <= NumericLimits<Element>::min())
-                result[i] = NumericLimits<Element>::min();
-            else if (v1[i] >= NumericLimits<Element>::max())
-                result[i] = NumericLimits<Element>::max();
-            else
-                result[i] = v1[i];
-        }
-        for (size_t i = 0; i < (VectorSize / 2); ++i) {
-            if (v2[i] <= NumericLimits<Element>::min())
-                result[i + VectorSize / 2] = NumericLimits<Element>::min();
-            else if (v2[i] >= NumericLimits<Element>::max())
-                result[i + VectorSize / 2] = NumericLimits<Element>::max();
-            else
-                result[i + VectorSize / 2] = v2[i];
-        }
+        auto narrow = [](VectorInput vector) {
+            return __builtin_convertvector(Detail::clamp(vector, NumericLimits<Element>::min(), NumericLimits<Element>::max()), VectorHalfResult);
+        };
 
-        return bit_cast<u128>(result);
+        return bit_cast<u128>(Detail::concatenate(narrow(bit_cast<VectorInput>(lhs)), narrow(bit_cast<VectorInput>(rhs))));
     }
 
     static StringView name() { return "narrow"sv; }
@@ -798,11 +890,20 @@ struct VectorIntegerUnaryOp {
     auto operator()(u128 lhs) const
     {
         using VectorType = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
+        using UnsignedVectorType = NativeVectorType<128 / VectorSize, VectorSize, MakeUnsigned>;
+        using SignedVectorType = NativeVectorType<128 / VectorSize, VectorSize, MakeSigned>;
         auto value = bit_cast<VectorType>(lhs);
-        VectorType result;
         Op op;
 
-        // FIXME: Find a way to not loop here
+        // NOTE: Negation wraps around (so the negation of the minimum is itself), so do it on unsigned lanes.
+        if constexpr (IsSame<Op, Negate>) {
+            return bit_cast<u128>(UnsignedVectorType {} - bit_cast<UnsignedVectorType>(value));
+        } else if constexpr (IsSame<Op, Absolute>) {
+            auto negated = UnsignedVectorType {} - bit_cast<UnsignedVectorType>(value);
+            return bit_cast<u128>(bit_cast<SignedVectorType>(value) < 0 ? negated : bit_cast<UnsignedVectorType>(value));
+        }
+
+        VectorType result;
         for (size_t i = 0; i < VectorSize; ++i) {
             result[i] = op(value[i]);
         }
@@ -834,8 +935,18 @@ struct VectorFloatBinaryOp {
         using VectorType = NativeFloatingVectorType<128, VectorSize, NativeFloatingType<128 / VectorSize>>;
         auto first = bit_cast<VectorType>(lhs);
         auto second = bit_cast<VectorType>(rhs);
-        VectorType result;
         Op op;
+
+        if constexpr (IsOneOf<Op, Add, Subtract, Multiply>)
+            return bit_cast<u128>(op(first, second));
+        else if constexpr (IsSame<Op, Divide>)
+            return bit_cast<u128>(first / second);
+        else if constexpr (IsSame<Op, PseudoMinimum>)
+            return bit_cast<u128>(second < first ? second : first);
+        else if constexpr (IsSame<Op, PseudoMaximum>)
+            return bit_cast<u128>(first < second ? second : first);
+
+        VectorType result;
         for (size_t i = 0; i < VectorSize; ++i) {
             result[i] = op(first[i], second[i]);
         }
@@ -860,9 +971,18 @@ struct VectorFloatUnaryOp {
     auto operator()(u128 lhs) const
     {
         using VectorType = NativeFloatingVectorType<128, VectorSize, NativeFloatingType<128 / VectorSize>>;
+        using UnsignedVectorType = NativeVectorType<128 / VectorSize, VectorSize, MakeUnsigned>;
         auto value = bit_cast<VectorType>(lhs);
-        VectorType result;
         Op op;
+
+        // NOTE: These only touch the sign bit, NaNs included.
+        constexpr auto sign_bit = static_cast<NativeIntegralType<128 / VectorSize>>(1) << (128 / VectorSize - 1);
+        if constexpr (IsSame<Op, Negate>)
+            return bit_cast<u128>(bit_cast<UnsignedVectorType>(value) ^ sign_bit);
+        else if constexpr (IsSame<Op, Absolute>)
+            return bit_cast<u128>(bit_cast<UnsignedVectorType>(value) & ~sign_bit);
+
+        VectorType result;
         for (size_t i = 0; i < VectorSize; ++i) {
             result[i] = op(value[i]);
         }
@@ -5,14 +5,34 @@
  */
 
 #include <AK/HashTable.h>
+#include <AK/OwnPtr.h>
 #include <AK/SourceLocation.h>
 #include <AK/TemporaryChange.h>
 #include <AK/Try.h>
 #include <LibWasm/AbstractMachine/Validator.h>
+#include <LibWasm/Parallel.h>
 #include <LibWasm/Printer/Printer.h>
 
 namespace Wasm {
 
+static Context copy_for_another_thread(Context const& context)
+{
+    Context copy;
+    copy.types.extend(context.types);
+    copy.functions.extend(context.functions);
+    copy.tables.extend(context.tables);
+    copy.memories.extend(context.memories);
+    copy.globals.extend(context.globals);
+    copy.elements.extend(context.elements);
+    copy.datas.extend(context.datas);
+    copy.locals.extend(context.locals);
+    copy.data_count = context.data_count;
+    for (auto index : context.references->tree)
+        copy.references->tree.insert(index.value(), index);
+    copy.imported_function_count = context.imported_function_count;
+    return copy;
+}
+
 ErrorOr<void, ValidationError> Validator::validate(Module& module)
 {
     // Pre-emptively make invalid. The module will be set to `Valid` at the end
@@ -241,28 +261,61 @@ ErrorOr<void, ValidationError> Validator::validate(TableSection const& section)
 
 ErrorOr<void, ValidationError> Validator::validate(CodeSection const& section)
 {
-    size_t index = m_context.imported_function_count;
-    for (auto& entry : section.functions()) {
-        auto function_index = index++;
-        TRY(validate(FunctionIndex { function_index }));
-        auto& function_type = m_context.functions[function_index];
-        auto& function = entry.func();
-
-        auto function_validator = fork();
-        function_validator.m_context.locals = {};
-        function_validator.m_context.locals.extend(function_type.parameters());
-        for (auto& local : function.locals()) {
-            for (size_t i = 0; i < local.n(); ++i)
-                function_validator.m_context.locals.append(local.type());
-        }
+    auto& functions = section.functions();
+    auto first_function_index = m_context.imported_function_count;
+
+    size_t code_size = 0;
+    for (auto& entry : functions)
+        code_size += entry.size();
+
+    if (!should_process_functions_in_parallel(code_size)) {
+        for (size_t i = 0; i < functions.size(); ++i)
+            TRY(validate_function(first_function_index + i, functions[i]));
+        return {};
+    }
 
-        function_validator.m_frames.empend(function_type, FrameKind::Function, (size_t)0);
+    // OPTIMIZATION: Function bodies can be validated independently of each other, so spread them over several threads.
+    //               Copies of a Context share its vectors (and their non-atomic reference counts), so every worker gets
+    //               a validator with its own copy of everything.
+    Vector<NonnullOwnPtr<Validator>> worker_validators;
+    worker_validators.ensure_capacity(parallel_worker_count());
+    for (size_t i = 0; i < parallel_worker_count(); ++i)
+        worker_validators.unchecked_append(adopt_own(*new Validator(copy_for_another_thread(m_context))));
+
+    Vector<Optional<ValidationError>> errors;
+    errors.resize(functions.size());
+    parallel_for(functions.size(), [&](size_t index, size_t worker) {
+        if (auto result = worker_validators[worker]->validate_function(first_function_index + index, functions[index]); result.is_error())
+            errors[index] = result.release_error();
+    });
+
+    // NOTE: Report the error from the first function that failed to validate, to get the same error on every run.
+    for (auto& error : errors) {
+        if (error.has_value())
+            return error.release_value();
+    }
+    return {};
+}
 
-        auto results = TRY(function_validator.validate(function.body(), function_type.results()));
-        if (results.result_types.size() != function_type.results().size())
-            return Errors::invalid("function result"sv, function_type.results(), results.result_types);
+ErrorOr<void, ValidationError> Validator::validate_function(size_t function_index, CodeSection::Code const& entry)
+{
+    TRY(validate(FunctionIndex { function_index }));
+    auto& function_type = m_context.functions[function_index];
+    auto& function = entry.func();
+
+    auto function_validator = fork();
+    function_validator.m_context.locals = {};
+    function_validator.m_context.locals.extend(function_type.parameters());
+    for (auto& local : function.locals()) {
+        for (size_t i = 0; i < local.n(); ++i)
+            function_validator.m_context.locals.append(local.type());
     }
 
+    function_validator.m_frames.empend(function_type, FrameKind::Function, (size_t)0);
+
+    auto results = TRY(function_validator.validate(function.body(), function_type.results()));
+    if (results.result_types.size() != function_type.results().size())
+        return Errors::invalid("function result"sv, function_type.results(), results.result_types);
     return {};
 }
 
@@ -3736,6 +3789,6 @@ ByteString Validator::Errors::find_instruction_name(SourceLocation const& locati
     if (!opcode.has_value())
         return ByteString::formatted("{}", location);
 
-    return instruction_name(OpCode { *opcode });
+    return ByteString { instruction_name(OpCode { *opcode }) };
 }
 }
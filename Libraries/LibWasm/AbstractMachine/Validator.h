@@ -283,6 +283,8 @@ private:
     {
     }
 
+    ErrorOr<void, ValidationError> validate_function(size_t function_index, CodeSection::Code const&);
+
     struct Errors {
         static ValidationError invalid(StringView name) { return ByteString::formatted("Invalid {}", name); }
 
@@ -9,6 +9,7 @@
 namespace Wasm {
 
 class AbstractMachine;
+class CompiledFunction;
 class Validator;
 struct ValidationError;
 struct Interpreter;
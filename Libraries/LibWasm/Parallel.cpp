@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <LibCore/System.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
+#include <LibThreading/ThreadPool.h>
+#include <LibWasm/Parallel.h>
+
+namespace Wasm {
+
+static constexpr size_t minimum_code_size_for_parallel_processing = 256 * KiB;
+static Optional<size_t> s_minimum_code_size_override;
+
+// NOTE: The calling thread does its share of the work as well, so the pool has one thread less than we have workers.
+static size_t thread_count()
+{
+    static size_t const thread_count = clamp(Core::System::hardware_concurrency(), 1u, 16u) - 1;
+    return thread_count;
+}
+
+static Threading::ThreadPool& thread_pool()
+{
+    static auto thread_pool = make<Threading::ThreadPool>(thread_count(), "WasmCompiler"sv);
+    return *thread_pool;
+}
+
+static Atomic<Threading::ThreadPool::ClientID> s_next_client_id { 1 };
+
+bool should_process_functions_in_parallel(size_t code_size)
+{
+    if (s_minimum_code_size_override.has_value())
+        return code_size >= *s_minimum_code_size_override;
+    return thread_count() > 0 && code_size >= minimum_code_size_for_parallel_processing;
+}
+
+void set_minimum_code_size_for_parallel_processing(Optional<size_t> code_size)
+{
+    s_minimum_code_size_override = code_size;
+}
+
+size_t parallel_worker_count()
+{
+    return thread_count() + 1;
+}
+
+void parallel_for(size_t count, Function<void(size_t index, size_t worker)> const& callback)
+{
+    Atomic<size_t> next_index { 0 };
+    auto run_worker = [&](size_t worker) {
+        for (auto index = next_index++; index < count; index = next_index++)
+            callback(index, worker);
+    };
+
+    if (thread_count() == 0 || count < 2) {
+        run_worker(0);
+        return;
+    }
+
+    Threading::Mutex mutex;
+    Threading::ConditionVariable all_workers_done { mutex };
+    auto client_id = s_next_client_id++;
+    auto const pool_worker_count = min(thread_count(), count - 1);
+    auto remaining_worker_count = pool_worker_count;
+
+    Vector<Threading::ThreadPool::JobID> job_ids;
+    job_ids.ensure_capacity(pool_worker_count);
+    for (size_t worker = 1; worker <= pool_worker_count; ++worker) {
+        job_ids.unchecked_append(thread_pool().submit(client_id, Threading::ThreadPool::Priority::Normal, [&, worker] {
+            run_worker(worker);
+
+            Threading::MutexLocker const locker { mutex };
+            if (--remaining_worker_count == 0)
+                all_workers_done.signal();
+        }));
+    }
+
+    run_worker(0);
+
+    // NOTE: If the pool is busy, we may have gotten through everything before some of the workers even started.
+    for (auto job_id : job_ids) {
+        if (thread_pool().take_queued_job(job_id).has_value()) {
+            Threading::MutexLocker const locker { mutex };
+            --remaining_worker_count;
+        }
+    }
+
+    Threading::MutexLocker const locker { mutex };
+    while (remaining_worker_count > 0)
+        all_workers_done.wait();
+}
+
+}
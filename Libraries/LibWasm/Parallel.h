@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Function.h>
+#include <AK/Optional.h>
+#include <AK/Types.h>
+
+namespace Wasm {
+
+// Whether there's enough code in a module for spreading its functions over several threads to pay off.
+bool should_process_functions_in_parallel(size_t code_size);
+
+// Makes should_process_functions_in_parallel() return true from the given amount of code on, even when there are no
+// threads to spread the work over, so tests can run the parallel paths on small modules. An empty value restores the
+// default. This is meant for tests only, and must not be called while a module is being processed.
+void set_minimum_code_size_for_parallel_processing(Optional<size_t>);
+
+// The number of workers that parallel_for() spreads its work over.
+size_t parallel_worker_count();
+
+// Calls `callback(index, worker)` for every index in [0, count) and returns once all of them have returned.
+// The calls run concurrently and in no particular order, but calls with the same `worker` (which is less than
+// parallel_worker_count()) never overlap, so callers can keep some state for each worker.
+void parallel_for(size_t count, Function<void(size_t index, size_t worker)> const& callback);
+
+}
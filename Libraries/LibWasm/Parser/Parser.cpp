@@ -11,6 +11,8 @@
 #include <AK/MemoryStream.h>
 #include <AK/ScopeLogger.h>
 #include <AK/UFixedBigInt.h>
+#include <LibWasm/AbstractMachine/CompiledFunction.h>
+#include <LibWasm/Parallel.h>
 #include <LibWasm/Types.h>
 
 namespace Wasm {
@@ -1148,19 +1150,65 @@ ParseResult<CodeSection::Code> CodeSection::Code::parse(Stream& stream)
 {
     ScopeLogger<WASM_BINPARSER_DEBUG> logger("Code"sv);
     auto size = TRY_READ(stream, LEB128<u32>, ParseError::InvalidSize);
+    auto code_stream = ConstrainedStream { MaybeOwned<Stream>(stream), size };
 
     // Emprically, if there are `size` bytes to be read, then there's around
     // `size / 2` instructions, so we pass that as our size hint.
-    auto func = TRY(Func::parse(stream, size / 2));
+    auto func = TRY(Func::parse(code_stream, size / 2));
+    if (code_stream.remaining() != 0)
+        return ParseError::SectionSizeMismatch;
 
     return Code { size, move(func) };
 }
 
-ParseResult<CodeSection> CodeSection::parse(Stream& stream)
+ParseResult<CodeSection> CodeSection::parse(Stream& stream, size_t section_size)
 {
     ScopeLogger<WASM_BINPARSER_DEBUG> logger("CodeSection"sv);
-    auto result = TRY(parse_vector<Code>(stream));
-    return CodeSection { move(result) };
+    if (!should_process_functions_in_parallel(section_size)) {
+        auto result = TRY(parse_vector<Code>(stream));
+        return CodeSection { move(result) };
+    }
+
+    // OPTIMIZATION: Every function body is prefixed with its size, so we can split them all off first, and then parse
+    //               them on several threads at once.
+    size_t count = TRY_READ(stream, LEB128<u32>, ParseError::ExpectedSize);
+    // NOTE: Every function takes up at least one byte, so don't let a bogus count make us allocate a huge vector.
+    if (count > section_size)
+        return ParseError::HugeAllocationRequested;
+
+    Vector<ByteBuffer> bodies;
+    bodies.ensure_capacity(count);
+    for (size_t i = 0; i < count; ++i) {
+        size_t size = TRY_READ(stream, LEB128<u32>, ParseError::InvalidSize);
+        if (size > section_size)
+            return ParseError::InvalidSize;
+        auto body_or_error = ByteBuffer::create_uninitialized(size);
+        if (body_or_error.is_error())
+            return ParseError::OutOfMemory;
+        auto body = body_or_error.release_value();
+        if (stream.read_until_filled(body).is_error())
+            return with_eof_check(stream, ParseError::InvalidInput);
+        bodies.unchecked_append(move(body));
+    }
+
+    Vector<Optional<ParseResult<Func>>> results;
+    results.resize(count);
+    parallel_for(count, [&](size_t index, size_t) {
+        FixedMemoryStream body_stream { bodies[index].bytes() };
+        auto result = Func::parse(body_stream, bodies[index].size() / 2);
+        if (!result.is_error() && !body_stream.is_eof())
+            result = ParseError::SectionSizeMismatch;
+        results[index] = move(result);
+    });
+
+    // NOTE: Report the error from the first function that failed to parse, to get the same error on every run.
+    Vector<Code> functions;
+    functions.ensure_capacity(count);
+    for (size_t i = 0; i < count; ++i) {
+        auto func = TRY(results[i].release_value());
+        functions.unchecked_append(Code { static_cast<u32>(bodies[i].size()), move(func) });
+    }
+    return CodeSection { move(functions) };
 }
 
 ParseResult<DataSection::Data> DataSection::Data::parse(Stream& stream)
@@ -1247,6 +1295,15 @@ ParseResult<SectionId> SectionId::parse(Stream& stream)
     }
 }
 
+// NOTE: These are out of line, as destroying the compiled functions needs the complete CompiledFunction type.
+Module::Module() = default;
+Module::~Module() = default;
+
+void Module::set_compiled_functions(Vector<RefPtr<CompiledFunction const>> functions, Badge<AbstractMachine>)
+{
+    m_compiled_functions = move(functions);
+}
+
 ParseResult<NonnullRefPtr<Module>> Module::parse(Stream& stream)
 {
     ScopeLogger<WASM_BINPARSER_DEBUG> logger("Module"sv);
@@ -1305,7 +1362,7 @@ ParseResult<NonnullRefPtr<Module>> Module::parse(Stream& stream)
             module.element_section() = TRY(ElementSection::parse(section_stream));
             break;
         case SectionId::SectionIdKind::Code:
-            module.code_section() = TRY(CodeSection::parse(section_stream));
+            module.code_section() = TRY(CodeSection::parse(section_stream, section_size));
             break;
         case SectionId::SectionIdKind::Data:
             module.data_section() = TRY(DataSection::parse(section_stream));
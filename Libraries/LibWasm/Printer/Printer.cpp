@@ -16,9 +16,14 @@ struct Names {
     static HashMap<ByteString, OpCode> instructions_by_name;
 };
 
-ByteString instruction_name(OpCode const& opcode)
+// NOTE: This is called from the threads validating functions in parallel, so it must not copy the ByteStrings in the
+//       map, as that would race on their reference counts.
+StringView instruction_name(OpCode const& opcode)
 {
-    return Names::instruction_names.get(opcode).value_or("<unknown>");
+    auto it = Names::instruction_names.find(opcode);
+    if (it == Names::instruction_names.end())
+        return "<unknown>"sv;
+    return it->value;
 }
 
 Optional<OpCode> instruction_from_name(StringView name)
@@ -918,7 +918,7 @@ public:
 
     auto& functions() const { return m_functions; }
 
-    static ParseResult<CodeSection> parse(Stream& stream);
+    static ParseResult<CodeSection> parse(Stream& stream, size_t section_size);
 
 private:
     Vector<Code> m_functions;
@@ -995,7 +995,8 @@ public:
     static constexpr Array<u8, 4> wasm_magic { 0, 'a', 's', 'm' };
     static constexpr Array<u8, 4> wasm_version { 1, 0, 0, 0 };
 
-    Module() = default;
+    Module();
+    ~Module();
 
     auto& custom_sections() { return m_custom_sections; }
     auto& custom_sections() const { return m_custom_sections; }
@@ -1029,6 +1030,10 @@ public:
     StringView validation_error() const { return *m_validation_error; }
     void set_validation_error(ByteString error) { m_validation_error = move(error); }
 
+    // The code section's functions compiled by CompiledFunction::compile_all(), shared by every instance of the module.
+    auto& compiled_functions() const { return m_compiled_functions; }
+    void set_compiled_functions(Vector<RefPtr<CompiledFunction const>>, Badge<AbstractMachine>);
+
     static ParseResult<NonnullRefPtr<Module>> parse(Stream& stream);
 
 private:
@@ -1050,5 +1055,6 @@ private:
 
     ValidationStatus m_validation_status { ValidationStatus::Unchecked };
     Optional<ByteString> m_validation_error;
+    Optional<Vector<RefPtr<CompiledFunction const>>> m_compiled_functions;
 };
 }
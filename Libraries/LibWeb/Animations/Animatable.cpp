@@ -9,6 +9,7 @@
 #include <LibWeb/Animations/Animatable.h>
 #include <LibWeb/Animations/Animation.h>
 #include <LibWeb/Animations/DocumentTimeline.h>
+#include <LibWeb/Animations/KeyframeEffect.h>
 #include <LibWeb/Animations/PseudoElementParsing.h>
 #include <LibWeb/CSS/CSSTransition.h>
 #include <LibWeb/CSS/StyleValues/CSSKeywordValue.h>
@@ -128,6 +129,41 @@ void Animatable::disassociate_with_animation(GC::Ref<Animation> animation)
     impl.associated_animations.remove_first_matching([&](auto element) { return animation == element; });
 }
 
+bool Animatable::is_animating_any_property_of(ReadonlySpan<CSS::PropertyID> properties, Optional<CSS::PseudoElement> pseudo_element) const
+{
+    if (!m_impl)
+        return false;
+
+    for (auto const& animation : m_impl->associated_animations) {
+        if (animation->play_state() != Bindings::AnimationPlayState::Running)
+            continue;
+
+        auto effect = animation->effect();
+        if (!effect || !effect->is_keyframe_effect() || !effect->is_in_effect())
+            continue;
+
+        auto const& keyframe_effect = static_cast<KeyframeEffect const&>(*effect);
+        if (keyframe_effect.pseudo_element_type() != pseudo_element)
+            continue;
+
+        // NOTE: Animations created from script list their properties as target properties, while CSS animations and
+        //       transitions only have them in their keyframes.
+        for (auto property : properties) {
+            if (keyframe_effect.target_properties().contains(property))
+                return true;
+        }
+        if (auto const* key_frame_set = keyframe_effect.key_frame_set()) {
+            for (auto const& keyframe : key_frame_set->keyframes_by_key) {
+                for (auto property : properties) {
+                    if (keyframe.properties.contains(property))
+                        return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
 void Animatable::add_transitioned_properties(Vector<Vector<CSS::PropertyID>> properties, CSS::StyleValueVector delays, CSS::StyleValueVector durations, CSS::StyleValueVector timing_functions, CSS::StyleValueVector transition_behaviors)
 {
     auto& impl = ensure_impl();
@@ -48,6 +48,9 @@ public:
     void associate_with_animation(GC::Ref<Animation>);
     void disassociate_with_animation(GC::Ref<Animation>);
 
+    // Whether a running animation is currently changing any of the given properties.
+    bool is_animating_any_property_of(ReadonlySpan<CSS::PropertyID>, Optional<CSS::PseudoElement> = {}) const;
+
     GC::Ptr<CSS::CSSStyleDeclaration const> cached_animation_name_source(Optional<CSS::PseudoElement>) const;
     void set_cached_animation_name_source(GC::Ptr<CSS::CSSStyleDeclaration const> value, Optional<CSS::PseudoElement>);
 
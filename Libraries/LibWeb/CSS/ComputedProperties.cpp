@@ -1628,6 +1628,47 @@ TouchActionData ComputedProperties::touch_action() const
     return TouchActionData {};
 }
 
+WillChangeData ComputedProperties::will_change() const
+{
+    WillChangeData will_change;
+    auto const& value = property(PropertyID::WillChange);
+    if (!value.is_value_list())
+        return will_change;
+
+    for (auto const& feature : value.as_value_list().values()) {
+        if (!feature->is_custom_ident())
+            continue;
+        auto property_id = property_id_from_string(feature->as_custom_ident().custom_ident());
+        if (!property_id.has_value())
+            continue;
+
+        switch (*property_id) {
+        case PropertyID::Transform:
+        case PropertyID::Translate:
+        case PropertyID::Rotate:
+        case PropertyID::Scale:
+            will_change.transform = true;
+            break;
+        case PropertyID::Opacity:
+            will_change.opacity = true;
+            break;
+        case PropertyID::BackdropFilter:
+        case PropertyID::ClipPath:
+        case PropertyID::Filter:
+        case PropertyID::Isolation:
+        case PropertyID::Mask:
+        case PropertyID::MaskImage:
+        case PropertyID::MixBlendMode:
+        case PropertyID::ViewTransitionName:
+            will_change.other_stacking_context_property = true;
+            break;
+        default:
+            break;
+        }
+    }
+    return will_change;
+}
+
 Containment ComputedProperties::contain() const
 {
     Containment containment = {};
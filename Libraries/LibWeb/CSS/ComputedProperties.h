@@ -167,6 +167,7 @@ public:
     UserSelect user_select() const;
     Isolation isolation() const;
     TouchActionData touch_action() const;
+    WillChangeData will_change() const;
     Containment contain() const;
     MixBlendMode mix_blend_mode() const;
     Optional<FlyString> view_transition_name() const;
@@ -237,6 +238,11 @@ public:
         return m_attempted_pseudo_class_matches.get(pseudo_class);
     }
 
+    PseudoClassBitmap const& attempted_pseudo_class_matches() const
+    {
+        return m_attempted_pseudo_class_matches;
+    }
+
     void set_attempted_pseudo_class_matches(PseudoClassBitmap const& results)
     {
         m_attempted_pseudo_class_matches = results;
@@ -332,6 +332,17 @@ struct TouchActionData {
     }
 };
 
+// https://drafts.csswg.org/css-will-change/#will-change
+struct WillChangeData {
+    // transform, or one of the individual transform properties.
+    bool transform : 1 { false };
+    bool opacity : 1 { false };
+    // Any other property that would make the element a stacking context with a value other than its initial one.
+    bool other_stacking_context_property : 1 { false };
+
+    bool creates_stacking_context() const { return transform || opacity || other_stacking_context_property; }
+};
+
 struct TransformOrigin {
     CSS::LengthPercentage x { Percentage(50) };
     CSS::LengthPercentage y { Percentage(50) };
@@ -480,6 +491,7 @@ public:
     CSS::MixBlendMode mix_blend_mode() const { return m_noninherited.mix_blend_mode; }
     Optional<FlyString> view_transition_name() const { return m_noninherited.view_transition_name; }
     TouchActionData touch_action() const { return m_noninherited.touch_action; }
+    WillChangeData will_change() const { return m_noninherited.will_change; }
 
     CSS::LengthBox const& inset() const { return m_noninherited.inset; }
     const CSS::LengthBox& margin() const { return m_noninherited.margin; }
@@ -738,6 +750,7 @@ protected:
         CSS::MixBlendMode mix_blend_mode { InitialValues::mix_blend_mode() };
         Optional<FlyString> view_transition_name;
         TouchActionData touch_action;
+        WillChangeData will_change;
 
         Optional<CSS::Transformation> rotate;
         Optional<CSS::Transformation> translate;
@@ -917,6 +930,7 @@ public:
     void set_mix_blend_mode(CSS::MixBlendMode value) { m_noninherited.mix_blend_mode = value; }
     void set_view_transition_name(Optional<FlyString> value) { m_noninherited.view_transition_name = value; }
     void set_touch_action(TouchActionData value) { m_noninherited.touch_action = value; }
+    void set_will_change(WillChangeData value) { m_noninherited.will_change = value; }
 
     void set_fill(SVGPaint value) { m_inherited.fill = move(value); }
     void set_stroke(SVGPaint value) { m_inherited.stroke = move(value); }
@@ -424,6 +424,7 @@ private:
     RefPtr<CSSStyleValue const> parse_transition_value(TokenStream<ComponentValue>&);
     RefPtr<CSSStyleValue const> parse_transition_property_value(TokenStream<ComponentValue>&);
     RefPtr<CSSStyleValue const> parse_translate_value(TokenStream<ComponentValue>&);
+    RefPtr<CSSStyleValue const> parse_will_change_value(TokenStream<ComponentValue>&);
     RefPtr<CSSStyleValue const> parse_scale_value(TokenStream<ComponentValue>&);
     RefPtr<CSSStyleValue const> parse_grid_track_size_list(TokenStream<ComponentValue>&, bool allow_separate_line_name_blocks = false);
     RefPtr<CSSStyleValue const> parse_grid_auto_track_sizes(TokenStream<ComponentValue>&);
@@ -708,6 +708,10 @@ Parser::ParseErrorOr<NonnullRefPtr<CSSStyleValue const>> Parser::parse_css_value
         if (auto parsed_value = parse_contain_value(tokens); parsed_value && !tokens.has_next_token())
             return parsed_value.release_nonnull();
         return ParseError::SyntaxError;
+    case PropertyID::WillChange:
+        if (auto parsed_value = parse_will_change_value(tokens); parsed_value && !tokens.has_next_token())
+            return parsed_value.release_nonnull();
+        return ParseError::SyntaxError;
     default:
         break;
     }
@@ -3965,6 +3969,34 @@ RefPtr<CSSStyleValue const> Parser::parse_transition_property_value(TokenStream<
     return StyleValueList::create(move(transition_properties), StyleValueList::Separator::Comma);
 }
 
+RefPtr<CSSStyleValue const> Parser::parse_will_change_value(TokenStream<ComponentValue>& tokens)
+{
+    // https://drafts.csswg.org/css-will-change/#will-change
+    // auto | <animateable-feature>#
+
+    // auto
+    if (auto auto_value = parse_all_as_single_keyword_value(tokens, Keyword::Auto))
+        return auto_value;
+
+    // <animateable-feature> = scroll-position | contents | <custom-ident>
+    // NOTE: scroll-position and contents are parsed as custom idents, as they don't mean anything to us.
+    auto transaction = tokens.begin_transaction();
+    auto feature_values = parse_a_comma_separated_list_of_component_values(tokens);
+
+    StyleValueVector features;
+    for (auto const& value : feature_values) {
+        TokenStream feature_tokens { value };
+        // The <custom-ident> production in <animateable-feature> excludes the keywords will-change, none, all, and auto.
+        auto custom_ident = parse_custom_ident_value(feature_tokens, { { "will-change"sv, "none"sv, "all"sv, "auto"sv } });
+        if (!custom_ident || feature_tokens.has_next_token())
+            return nullptr;
+        features.append(custom_ident.release_nonnull());
+    }
+
+    transaction.commit();
+    return StyleValueList::create(move(features), StyleValueList::Separator::Comma);
+}
+
 RefPtr<CSSStyleValue const> Parser::parse_translate_value(TokenStream<ComponentValue>& tokens)
 {
     if (tokens.remaining_token_count() == 1) {
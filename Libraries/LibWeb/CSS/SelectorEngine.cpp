@@ -1174,4 +1174,10 @@ bool fast_matches(CSS::Selector const& selector, DOM::Element const& element_to_
     }
 }
 
+bool matches_pseudo_class(CSS::PseudoClass pseudo_class, DOM::Element const& element)
+{
+    MatchContext context;
+    return matches_pseudo_class(CSS::Selector::SimpleSelector::PseudoClassSelector { .type = pseudo_class }, element, nullptr, context, nullptr, SelectorKind::Normal);
+}
+
 }
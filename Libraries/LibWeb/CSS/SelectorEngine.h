@@ -25,4 +25,7 @@ struct MatchContext {
 
 bool matches(CSS::Selector const&, DOM::Element const&, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context, Optional<CSS::PseudoElement> = {}, GC::Ptr<DOM::ParentNode const> scope = {}, SelectorKind selector_kind = SelectorKind::Normal, GC::Ptr<DOM::Element const> anchor = nullptr);
 
+// Matches a pseudo-class that takes no arguments against the element on its own.
+bool matches_pseudo_class(CSS::PseudoClass, DOM::Element const&);
+
 }
@@ -2434,6 +2434,102 @@ GC::Ptr<ComputedProperties> StyleComputer::compute_pseudo_element_style_if_neede
     return compute_style_impl(element, move(pseudo_element), ComputeStyleMode::CreatePseudoElementStyleIfNeeded);
 }
 
+// Returns whether `element` is in the same state as `sibling` for every pseudo-class that was tried while computing the
+// sibling's cascaded values.
+static bool has_same_pseudo_class_state(DOM::Element const& element, DOM::Element const& sibling, PseudoClassBitmap const& attempted_pseudo_class_matches)
+{
+    for (size_t i = 0; i < to_underlying(PseudoClass::__Count); ++i) {
+        auto pseudo_class = static_cast<PseudoClass>(i);
+        if (!attempted_pseudo_class_matches.get(pseudo_class))
+            continue;
+
+        switch (pseudo_class) {
+        case PseudoClass::Is:
+        case PseudoClass::Where:
+        case PseudoClass::Not:
+            // NOTE: These only combine other selectors, and any pseudo-classes in those are recorded on their own.
+            continue;
+        case PseudoClass::Lang:
+            // NOTE: The language comes from the elements' attributes or is inherited from their parent, and both of
+            //       those are the same for the two elements.
+            continue;
+        case PseudoClass::Dir:
+            if (element.directionality() != sibling.directionality())
+                return false;
+            continue;
+        case PseudoClass::NthChild:
+        case PseudoClass::NthLastChild:
+        case PseudoClass::NthOfType:
+        case PseudoClass::NthLastOfType:
+        case PseudoClass::Has:
+            // NOTE: We don't know the arguments these were matched with, so we can't tell whether they would match.
+            return false;
+        default:
+            if (SelectorEngine::matches_pseudo_class(pseudo_class, element) != SelectorEngine::matches_pseudo_class(pseudo_class, sibling))
+                return false;
+            continue;
+        }
+    }
+
+    return true;
+}
+
+// Returns a previous sibling whose cascaded values are guaranteed to be identical to what a full cascade would produce
+// for `element`, or null if there is no such sibling.
+static DOM::Element const* element_to_share_cascaded_values_with(DOM::Element const& element)
+{
+    auto const* sibling = element.previous_element_sibling();
+    if (!sibling)
+        return nullptr;
+
+    if (sibling->local_name() != element.local_name() || sibling->namespace_uri() != element.namespace_uri())
+        return nullptr;
+
+    if (sibling->needs_style_update() || sibling->use_pseudo_element().has_value())
+        return nullptr;
+
+    // NOTE: Shadow hosts can be matched by :host rules from their own shadow tree, and slottables by ::slotted()
+    //       rules from whichever slot they are assigned to.
+    if (element.is_shadow_host() || sibling->is_shadow_host())
+        return nullptr;
+    if (sibling->assigned_slot_internal() != element.assigned_slot_internal())
+        return nullptr;
+
+    if (element.inline_style() || sibling->inline_style())
+        return nullptr;
+
+    auto computed_properties = sibling->computed_properties();
+    if (!computed_properties || !sibling->cascaded_properties({}))
+        return nullptr;
+
+    // NOTE: Any selector that looked at pseudo-class state (:hover, :checked, :empty, ...) or at the sibling's position
+    //       among its siblings may have matched differently for `element`, so we only share when both elements are in
+    //       the same state for every pseudo-class the sibling's cascade looked at, and it didn't depend on position.
+    if (!has_same_pseudo_class_state(element, *sibling, computed_properties->attempted_pseudo_class_matches()))
+        return nullptr;
+    if (sibling->style_affected_by_structural_changes()
+        || sibling->sibling_invalidation_distance() != 0
+        || sibling->affected_by_has_pseudo_class_in_subject_position()
+        || sibling->affected_by_has_pseudo_class_in_non_subject_position()
+        || sibling->affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator())
+        return nullptr;
+
+    // Everything else a selector or presentational hint can look at is an attribute, so those must be identical.
+    auto attribute_count = element.attribute_list_size();
+    if (sibling->attribute_list_size() != attribute_count)
+        return nullptr;
+    for (size_t i = 0; i < attribute_count; ++i) {
+        auto const* attribute = element.attributes()->item(i);
+        auto const* sibling_attribute = sibling->attributes()->item(i);
+        if (attribute->local_name() != sibling_attribute->local_name()
+            || attribute->namespace_uri() != sibling_attribute->namespace_uri()
+            || attribute->value() != sibling_attribute->value())
+            return nullptr;
+    }
+
+    return sibling;
+}
+
 GC::Ptr<ComputedProperties> StyleComputer::compute_style_impl(DOM::Element& element, Optional<CSS::PseudoElement> pseudo_element, ComputeStyleMode mode) const
 {
     build_rule_cache_if_needed();
@@ -2453,6 +2549,27 @@ GC::Ptr<ComputedProperties> StyleComputer::compute_style_impl(DOM::Element& elem
 
     ScopeGuard guard { [&element]() { element.set_needs_style_update(false); } };
 
+    // OPTIMIZATION: Runs of identical siblings (list items, table cells, ...) are very common, and the cascade is by far
+    //               the most expensive part of style computation. If the previous sibling is indistinguishable from this
+    //               element as far as selector matching is concerned, reuse its cascaded values and only compute the
+    //               properties, since those depend on inheritance and per-element state like animations.
+    if (!pseudo_element.has_value() && mode == ComputeStyleMode::Normal) {
+        if (auto const* sibling = element_to_share_cascaded_values_with(element)) {
+            ++m_style_sharing_statistics.shared_cascades;
+            element.set_custom_properties({}, sibling->custom_properties({}));
+            if (sibling->style_uses_css_custom_properties())
+                element.set_style_uses_css_custom_properties(true);
+            GC::Ref<CascadedProperties> cascaded_properties = *sibling->cascaded_properties({});
+            element.set_cascaded_properties({}, cascaded_properties);
+            auto computed_properties = compute_properties(element, {}, cascaded_properties);
+            // NOTE: The sibling's cascade tried the same pseudo-classes ours would have, and both pseudo-class state
+            //       invalidation and the next sibling's sharing check rely on knowing which ones those were.
+            computed_properties->set_attempted_pseudo_class_matches(sibling->computed_properties()->attempted_pseudo_class_matches());
+            return computed_properties;
+        }
+    }
+    ++m_style_sharing_statistics.computed_cascades;
+
     // 1. Perform the cascade. This produces the "specified style"
     bool did_match_any_pseudo_element_rules = false;
     PseudoClassBitmap attempted_pseudo_class_matches;
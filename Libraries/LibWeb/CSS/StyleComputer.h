@@ -205,6 +205,13 @@ public:
 
     [[nodiscard]] inline bool should_reject_with_ancestor_filter(Selector const&) const;
 
+    struct StyleSharingStatistics {
+        size_t shared_cascades { 0 };
+        size_t computed_cascades { 0 };
+    };
+    StyleSharingStatistics const& style_sharing_statistics() const { return m_style_sharing_statistics; }
+    void reset_style_sharing_statistics() { m_style_sharing_statistics = {}; }
+
 private:
     enum class ComputeStyleMode {
         Normal,
@@ -293,6 +300,7 @@ private:
     static void collect_selector_insights(Selector const&, SelectorInsights&);
 
     OwnPtr<SelectorInsights> m_selector_insights;
+    mutable StyleSharingStatistics m_style_sharing_statistics;
     Array<OwnPtr<RuleCache>, to_underlying(PseudoClass::__Count)> m_pseudo_class_rule_cache;
     OwnPtr<StyleInvalidationData> m_style_invalidation_data;
     OwnPtr<RuleCachesForDocumentAndShadowRoots> m_author_rule_cache;
@@ -18,6 +18,7 @@
 #include <AK/Utf8View.h>
 #include <LibCore/Timer.h>
 #include <LibGC/RootVector.h>
+#include <LibGfx/TextLayout.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/FunctionObject.h>
 #include <LibJS/Runtime/NativeFunction.h>
@@ -1297,7 +1298,7 @@ void Document::update_layout(UpdateLayoutReason reason)
 
     update_style();
 
-    if (m_layout_root && !m_layout_root->needs_layout_update())
+    if (m_layout_root && !m_layout_root->needs_layout_update() && !m_layout_root->child_needs_layout_update())
         return;
 
     // NOTE: If this is a document hosting <template> contents, layout is unnecessary.
@@ -1384,6 +1385,14 @@ void Document::update_layout(UpdateLayoutReason reason)
                 Layout::AvailableSize::make_definite(viewport_rect.height())));
     }
 
+    [[maybe_unused]] size_t laid_out_box_count = 0;
+    if constexpr (UPDATE_LAYOUT_DEBUG) {
+        for (auto const& it : layout_state.used_values_per_layout_node) {
+            if (it.value->has_been_laid_out() && is<Layout::Box>(*it.key))
+                ++laid_out_box_count;
+        }
+    }
+
     layout_state.commit(*m_layout_root);
 
     // Broadcast the current viewport rect to any new paintables, so they know whether they're visible or not.
@@ -1417,7 +1426,9 @@ void Document::update_layout(UpdateLayoutReason reason)
         window->scroll_by(0, 0);
 
     if constexpr (UPDATE_LAYOUT_DEBUG) {
-        dbgln("LAYOUT {} {} µs", to_string(reason), timer.elapsed_time().to_microseconds());
+        dbgln("LAYOUT {} {} µs, {} boxes laid out", to_string(reason), timer.elapsed_time().to_microseconds(), laid_out_box_count);
+        auto shaping_cache_statistics = Gfx::shaping_cache_statistics();
+        dbgln("SHAPING CACHE {} hits, {} misses, {} evictions ({:.1}% hit rate)", shaping_cache_statistics.hits, shaping_cache_statistics.misses, shaping_cache_statistics.evictions, shaping_cache_statistics.hit_rate() * 100);
     }
 }
 
@@ -1544,8 +1555,14 @@ void Document::update_style()
     evaluate_media_rules();
 
     style_computer().reset_ancestor_filter();
+    style_computer().reset_style_sharing_statistics();
 
     auto invalidation = update_style_recursively(*this, style_computer(), false);
+
+    if constexpr (LIBWEB_CSS_DEBUG) {
+        auto const& statistics = style_computer().style_sharing_statistics();
+        dbgln("Style update: {} cascades computed, {} shared with a sibling", statistics.computed_cascades, statistics.shared_cascades);
+    }
     if (!invalidation.is_none())
         invalidate_display_list();
     if (invalidation.rebuild_stacking_context_tree)
@@ -13,6 +13,7 @@
 #include <AK/ScopeGuard.h>
 #include <LibJS/Runtime/Completion.h>
 #include <LibRequests/RequestTimingInfo.h>
+#include <LibURL/Site.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/Bindings/PrincipalHostDefined.h>
 #include <LibWeb/ContentSecurityPolicy/BlockingAlgorithms.h>
@@ -2299,6 +2300,14 @@ WebIDL::ExceptionOr<GC::Ref<PendingResponse>> nonstandard_resource_loader_file_o
     load_request.set_page(page);
     load_request.set_method(ByteString::copy(request->method()));
 
+    // NOTE: RequestServer's disk cache is shared by every site, so its entries are partitioned by the site of the
+    //       top-level document and the site of the frame making the request.
+    if (auto partition_key = Infrastructure::determine_the_network_partition_key(*request); partition_key.has_value() && request->client()) {
+        auto top_level_site = URL::Site::obtain(partition_key->top_level_origin).serialize();
+        auto frame_site = URL::Site::obtain(request->client()->origin()).serialize();
+        load_request.set_cache_partition_key(MUST(String::formatted("{} {}", top_level_site, frame_site)));
+    }
+
     for (auto const& header : *request->header_list())
         load_request.set_header(ByteString::copy(header.name), ByteString::copy(header.value));
 
@@ -13,25 +13,112 @@ namespace Web::HTML {
 
 GC_DEFINE_ALLOCATOR(AnimatedBitmapDecodedImageData);
 
-ErrorOr<GC::Ref<AnimatedBitmapDecodedImageData>> AnimatedBitmapDecodedImageData::create(JS::Realm& realm, Vector<Frame>&& frames, size_t loop_count, bool animated)
+ErrorOr<GC::Ref<AnimatedBitmapDecodedImageData>> AnimatedBitmapDecodedImageData::create(JS::Realm& realm, Vector<Frame>&& frames, size_t loop_count, bool animated, RefPtr<Platform::StreamedFrames> streamed_frames, Gfx::ColorSpace color_space)
 {
-    return realm.create<AnimatedBitmapDecodedImageData>(move(frames), loop_count, animated);
+    return realm.create<AnimatedBitmapDecodedImageData>(move(frames), loop_count, animated, move(streamed_frames), move(color_space));
 }
 
-AnimatedBitmapDecodedImageData::AnimatedBitmapDecodedImageData(Vector<Frame>&& frames, size_t loop_count, bool animated)
+AnimatedBitmapDecodedImageData::AnimatedBitmapDecodedImageData(Vector<Frame>&& frames, size_t loop_count, bool animated, RefPtr<Platform::StreamedFrames> streamed_frames, Gfx::ColorSpace color_space)
     : m_frames(move(frames))
+    , m_size(m_frames.first().bitmap->size())
     , m_loop_count(loop_count)
     , m_animated(animated)
+    , m_streamed_frames(move(streamed_frames))
+    , m_color_space(move(color_space))
 {
+    if (m_streamed_frames) {
+        m_streamed_frames->on_frames_decoded = [this](size_t first_frame_index, Vector<RefPtr<Gfx::Bitmap>> bitmaps) {
+            did_decode_streamed_frames(first_frame_index, move(bitmaps));
+        };
+        m_streamed_frames->on_error = [this] {
+            did_fail_to_decode_streamed_frames();
+        };
+    }
 }
 
 AnimatedBitmapDecodedImageData::~AnimatedBitmapDecodedImageData() = default;
 
+void AnimatedBitmapDecodedImageData::finalize()
+{
+    Base::finalize();
+    if (m_streamed_frames) {
+        m_streamed_frames->on_frames_decoded = nullptr;
+        m_streamed_frames->on_error = nullptr;
+    }
+}
+
 RefPtr<Gfx::ImmutableBitmap> AnimatedBitmapDecodedImageData::bitmap(size_t frame_index, Gfx::IntSize) const
 {
     if (frame_index >= m_frames.size())
         return nullptr;
-    return m_frames[frame_index].bitmap;
+    if (!m_streamed_frames)
+        return m_frames[frame_index].bitmap;
+
+    const_cast<AnimatedBitmapDecodedImageData&>(*this).request_streamed_frames_if_needed(frame_index);
+
+    if (auto const& bitmap = m_frames[frame_index].bitmap)
+        return bitmap;
+
+    // Playback got ahead of decoding. Keep showing the most recent frame we have, rather than nothing at all.
+    for (size_t distance = 1; distance < m_frames.size(); ++distance) {
+        if (auto const& bitmap = m_frames[(frame_index + m_frames.size() - distance) % m_frames.size()].bitmap)
+            return bitmap;
+    }
+    return nullptr;
+}
+
+void AnimatedBitmapDecodedImageData::request_streamed_frames_if_needed(size_t frame_index)
+{
+    if (frame_index != m_playhead_frame_index) {
+        m_playhead_frame_index = frame_index;
+        drop_streamed_frames_outside_of_playback_window();
+    }
+
+    if (m_has_pending_streamed_frames_request)
+        return;
+
+    for (size_t distance = 0; distance <= streamed_frames_to_keep_ahead; ++distance) {
+        auto index = (frame_index + distance) % m_frames.size();
+        if (!m_frames[index].bitmap) {
+            m_has_pending_streamed_frames_request = true;
+            m_streamed_frames->request_frames(index, streamed_frames_to_keep_ahead + 1 - distance);
+            return;
+        }
+    }
+}
+
+void AnimatedBitmapDecodedImageData::did_decode_streamed_frames(size_t first_frame_index, Vector<RefPtr<Gfx::Bitmap>> bitmaps)
+{
+    m_has_pending_streamed_frames_request = false;
+
+    for (size_t i = 0; i < bitmaps.size(); ++i) {
+        if (!bitmaps[i])
+            continue;
+        auto& frame = m_frames[(first_frame_index + i) % m_frames.size()];
+        frame.bitmap = Gfx::ImmutableBitmap::create(bitmaps[i].release_nonnull(), Gfx::AlphaType::Premultiplied, m_color_space);
+    }
+
+    drop_streamed_frames_outside_of_playback_window();
+}
+
+void AnimatedBitmapDecodedImageData::did_fail_to_decode_streamed_frames()
+{
+    // NOTE: The frames we asked for are not coming. Allow the next frame that gets painted to ask for them again, rather
+    //       than getting stuck on whatever frames we happen to have.
+    m_has_pending_streamed_frames_request = false;
+}
+
+void AnimatedBitmapDecodedImageData::drop_streamed_frames_outside_of_playback_window()
+{
+    // NOTE: Frames that playback has moved past will not be shown again until the animation loops around, by which point
+    //       they have been requested again. We do hold on to the one right before the playhead though, so there is
+    //       something to show if the current frame has not arrived yet.
+    auto window_start = (m_playhead_frame_index + m_frames.size() - 1) % m_frames.size();
+    for (size_t i = 0; i < m_frames.size(); ++i) {
+        auto distance_into_window = (i + m_frames.size() - window_start) % m_frames.size();
+        if (distance_into_window > streamed_frames_to_keep_ahead + 1)
+            m_frames[i].bitmap = nullptr;
+    }
 }
 
 int AnimatedBitmapDecodedImageData::frame_duration(size_t frame_index) const
@@ -43,17 +130,17 @@ int AnimatedBitmapDecodedImageData::frame_duration(size_t frame_index) const
 
 Optional<CSSPixels> AnimatedBitmapDecodedImageData::intrinsic_width() const
 {
-    return m_frames.first().bitmap->width();
+    return m_size.width();
 }
 
 Optional<CSSPixels> AnimatedBitmapDecodedImageData::intrinsic_height() const
 {
-    return m_frames.first().bitmap->height();
+    return m_size.height();
 }
 
 Optional<CSSPixelFraction> AnimatedBitmapDecodedImageData::intrinsic_aspect_ratio() const
 {
-    return CSSPixels(m_frames.first().bitmap->width()) / CSSPixels(m_frames.first().bitmap->height());
+    return CSSPixels(m_size.width()) / CSSPixels(m_size.height());
 }
 
 }
@@ -6,8 +6,10 @@
 
 #pragma once
 
+#include <LibGfx/ColorSpace.h>
 #include <LibGfx/ImmutableBitmap.h>
 #include <LibWeb/HTML/DecodedImageData.h>
+#include <LibWeb/Platform/ImageCodecPlugin.h>
 
 namespace Web::HTML {
 
@@ -21,7 +23,12 @@ public:
         int duration { 0 };
     };
 
-    static ErrorOr<GC::Ref<AnimatedBitmapDecodedImageData>> create(JS::Realm&, Vector<Frame>&&, size_t loop_count, bool animated);
+    // For streamed images, how many frames past the one currently being shown we keep decoded.
+    static constexpr size_t streamed_frames_to_keep_ahead = 4;
+
+    // NOTE: For streamed images, only the first frame needs to have a bitmap. The others are requested from
+    //       `streamed_frames` as playback approaches them, and dropped again once it has moved past them.
+    static ErrorOr<GC::Ref<AnimatedBitmapDecodedImageData>> create(JS::Realm&, Vector<Frame>&&, size_t loop_count, bool animated, RefPtr<Platform::StreamedFrames> streamed_frames = {}, Gfx::ColorSpace color_space = {});
     virtual ~AnimatedBitmapDecodedImageData() override;
 
     virtual RefPtr<Gfx::ImmutableBitmap> bitmap(size_t frame_index, Gfx::IntSize = {}) const override;
@@ -36,11 +43,24 @@ public:
     virtual Optional<CSSPixelFraction> intrinsic_aspect_ratio() const override;
 
 private:
-    AnimatedBitmapDecodedImageData(Vector<Frame>&&, size_t loop_count, bool animated);
+    AnimatedBitmapDecodedImageData(Vector<Frame>&&, size_t loop_count, bool animated, RefPtr<Platform::StreamedFrames>, Gfx::ColorSpace);
+
+    virtual void finalize() override;
+
+    void request_streamed_frames_if_needed(size_t frame_index);
+    void did_decode_streamed_frames(size_t first_frame_index, Vector<RefPtr<Gfx::Bitmap>>);
+    void did_fail_to_decode_streamed_frames();
+    void drop_streamed_frames_outside_of_playback_window();
 
     Vector<Frame> m_frames;
+    Gfx::IntSize m_size;
     size_t m_loop_count { 0 };
     bool m_animated { false };
+
+    RefPtr<Platform::StreamedFrames> m_streamed_frames;
+    Gfx::ColorSpace m_color_space;
+    size_t m_playhead_frame_index { 0 };
+    bool m_has_pending_streamed_frames_request { false };
 };
 
 }
@@ -4,10 +4,12 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Debug.h>
 #include <LibCore/EventLoop.h>
 #include <LibWeb/HTML/RenderingThread.h>
 #include <LibWeb/HTML/TraversableNavigable.h>
 #include <LibWeb/Painting/BackingStore.h>
+#include <LibWeb/Painting/DamageTracking.h>
 
 namespace Web::HTML {
 
@@ -35,6 +37,7 @@ void RenderingThread::start(DisplayListPlayerType display_list_player_type)
 {
     m_display_list_player_type = display_list_player_type;
     VERIFY(m_skia_player);
+    m_skia_player->set_compositor_layer_cache(&m_compositor_layer_cache);
     m_thread = Threading::Thread::construct([this] {
         rendering_thread_loop();
         return static_cast<intptr_t>(0);
@@ -64,8 +67,30 @@ void RenderingThread::rendering_thread_loop()
             break;
         }
 
-        auto painting_surface = painting_surface_for_backing_store(task->backing_store);
-        m_skia_player->execute(*task->display_list, task->scroll_state_snapshot, painting_surface);
+        auto damage_rect = prepare_partial_repaint(*task);
+        auto paint_rect = damage_rect.has_value() ? *damage_rect : Gfx::IntRect { {}, task->backing_store->size() };
+        if (paints_into_backing_store_bitmaps() && Painting::TiledRasterizer::can_rasterize(*task->display_list, paint_rect)) {
+            m_tiled_rasterizer.rasterize(*task->display_list, task->scroll_state_snapshot, task->backing_store->bitmap(), paint_rect, &m_compositor_layer_cache);
+        } else if (!paint_rect.is_empty()) {
+            auto painting_surface = painting_surface_for_backing_store(task->backing_store);
+            m_skia_player->execute(*task->display_list, task->scroll_state_snapshot, painting_surface, damage_rect);
+        }
+
+        if constexpr (DAMAGE_TRACKING_DEBUG) {
+            if (task->previous_frame_backing_store) {
+                auto frame_area = task->backing_store->size().area();
+                if (!damage_rect.has_value())
+                    dbgln("Repainted the whole viewport");
+                else if (frame_area > 0)
+                    dbgln("Repainted {} of the viewport, {}% of its pixels", *damage_rect, damage_rect->size().area() * 100 / frame_area);
+            }
+        }
+
+        if (task->previous_frame_backing_store) {
+            m_compositor_layer_cache.retain_only_layers_in(*task->display_list);
+            m_last_frame = LastFrame { task->display_list, move(task->scroll_state_snapshot), task->backing_store };
+        }
+
         if (m_exit)
             break;
         m_main_thread_event_loop.deferred_invoke([callback = move(task->callback)] {
@@ -74,13 +99,75 @@ void RenderingThread::rendering_thread_loop()
     }
 }
 
-void RenderingThread::enqueue_rendering_task(NonnullRefPtr<Painting::DisplayList> display_list, Painting::ScrollStateSnapshot&& scroll_state_snapshot, NonnullRefPtr<Painting::BackingStore> backing_store, Function<void()>&& callback)
+void RenderingThread::enqueue_rendering_task(NonnullRefPtr<Painting::DisplayList> display_list, Painting::ScrollStateSnapshot&& scroll_state_snapshot, NonnullRefPtr<Painting::BackingStore> backing_store, RefPtr<Painting::BackingStore> previous_frame_backing_store, Function<void()>&& callback)
 {
     Threading::MutexLocker const locker { m_rendering_task_mutex };
-    m_rendering_tasks.enqueue(Task { move(display_list), move(scroll_state_snapshot), move(backing_store), move(callback) });
+    m_rendering_tasks.enqueue(Task { move(display_list), move(scroll_state_snapshot), move(backing_store), move(previous_frame_backing_store), move(callback) });
     m_rendering_task_ready_wake_condition.signal();
 }
 
+static void copy_undamaged_pixels(Gfx::Bitmap const& source, Gfx::Bitmap& destination, Gfx::IntRect const& damage_rect)
+{
+    VERIFY(source.size() == destination.size());
+    VERIFY(source.format() == destination.format());
+
+    size_t const bytes_per_pixel = sizeof(Gfx::ARGB32);
+    size_t const row_size = source.width() * bytes_per_pixel;
+    for (int y = 0; y < source.height(); ++y) {
+        auto const* source_row = source.scanline_u8(y);
+        auto* destination_row = destination.scanline_u8(y);
+        if (y < damage_rect.top() || y >= damage_rect.bottom()) {
+            memcpy(destination_row, source_row, row_size);
+            continue;
+        }
+        size_t const damage_start = damage_rect.left() * bytes_per_pixel;
+        size_t const damage_end = damage_rect.right() * bytes_per_pixel;
+        memcpy(destination_row, source_row, damage_start);
+        memcpy(destination_row + damage_end, source_row + damage_end, row_size - damage_end);
+    }
+}
+
+// Returns the part of the task's backing store that has to be painted, after bringing the rest of it up to date with
+// the previous frame. An empty Optional means the whole backing store has to be painted.
+Optional<Gfx::IntRect> RenderingThread::prepare_partial_repaint(Task const& task)
+{
+    if (!task.previous_frame_backing_store || !m_last_frame.has_value())
+        return {};
+
+    // NOTE: GPU-backed surfaces do not paint into the backing store's bitmap directly, so we can't bring the
+    //       undamaged pixels over from the previous frame.
+    if (!paints_into_backing_store_bitmaps())
+        return {};
+
+    auto& previous_frame_backing_store = *task.previous_frame_backing_store;
+    auto& backing_store = *task.backing_store;
+    if (&previous_frame_backing_store != m_last_frame->backing_store.ptr())
+        return {};
+    if (previous_frame_backing_store.size() != backing_store.size())
+        return {};
+    if (previous_frame_backing_store.bitmap().format() != backing_store.bitmap().format())
+        return {};
+
+    auto damage_rect = Painting::compute_damage_rect(*m_last_frame->display_list, m_last_frame->scroll_state_snapshot, *task.display_list, task.scroll_state_snapshot);
+    if (!damage_rect.has_value())
+        return {};
+
+    Gfx::IntRect backing_store_rect { {}, backing_store.size() };
+    damage_rect = damage_rect->intersected(backing_store_rect);
+    if (damage_rect == backing_store_rect)
+        return {};
+
+    if (&previous_frame_backing_store != &backing_store)
+        copy_undamaged_pixels(previous_frame_backing_store.bitmap(), backing_store.bitmap(), *damage_rect);
+
+    return damage_rect;
+}
+
+bool RenderingThread::paints_into_backing_store_bitmaps() const
+{
+    return m_display_list_player_type == DisplayListPlayerType::SkiaCPU || !m_skia_backend_context;
+}
+
 NonnullRefPtr<Gfx::PaintingSurface> RenderingThread::painting_surface_for_backing_store(Painting::BackingStore& backing_store)
 {
     auto& bitmap = backing_store.bitmap();
@@ -14,7 +14,9 @@
 #include <LibThreading/Thread.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/Page/Page.h>
+#include <LibWeb/Painting/CompositorLayerCache.h>
 #include <LibWeb/Painting/DisplayListPlayerSkia.h>
+#include <LibWeb/Painting/TiledRasterizer.h>
 
 namespace Web::HTML {
 
@@ -29,11 +31,12 @@ public:
     void start(DisplayListPlayerType);
     void set_skia_player(OwnPtr<Painting::DisplayListPlayerSkia>&& player) { m_skia_player = move(player); }
     void set_skia_backend_context(RefPtr<Gfx::SkiaBackendContext> context) { m_skia_backend_context = move(context); }
-    void enqueue_rendering_task(NonnullRefPtr<Painting::DisplayList>, Painting::ScrollStateSnapshot&&, NonnullRefPtr<Painting::BackingStore>, Function<void()>&& callback);
+    void enqueue_rendering_task(NonnullRefPtr<Painting::DisplayList>, Painting::ScrollStateSnapshot&&, NonnullRefPtr<Painting::BackingStore>, RefPtr<Painting::BackingStore> previous_frame_backing_store, Function<void()>&& callback);
     void clear_bitmap_to_surface_cache();
 
 private:
     void rendering_thread_loop();
+    bool paints_into_backing_store_bitmaps() const;
     NonnullRefPtr<Gfx::PaintingSurface> painting_surface_for_backing_store(Painting::BackingStore& backing_store);
 
     Core::EventLoop& m_main_thread_event_loop;
@@ -41,6 +44,8 @@ private:
 
     OwnPtr<Painting::DisplayListPlayerSkia> m_skia_player;
     RefPtr<Gfx::SkiaBackendContext> m_skia_backend_context;
+    Painting::TiledRasterizer m_tiled_rasterizer;
+    Painting::CompositorLayerCache m_compositor_layer_cache;
 
     RefPtr<Threading::Thread> m_thread;
     Atomic<bool> m_exit { false };
@@ -50,8 +55,13 @@ private:
         NonnullRefPtr<Painting::DisplayList> display_list;
         Painting::ScrollStateSnapshot scroll_state_snapshot;
         NonnullRefPtr<Painting::BackingStore> backing_store;
+        // NOTE: Only set for frames painted into the viewport's backing stores, where it holds the previously
+        //       presented frame.
+        RefPtr<Painting::BackingStore> previous_frame_backing_store;
         Function<void()> callback;
     };
+    Optional<Gfx::IntRect> prepare_partial_repaint(Task const&);
+
     // NOTE: Queue will only contain multiple items in case tasks were scheduled by screenshot requests.
     //       Otherwise, it will contain only one item at a time.
     Queue<Task> m_rendering_tasks;
@@ -60,6 +70,15 @@ private:
 
     HashMap<Gfx::Bitmap*, NonnullRefPtr<Gfx::PaintingSurface>> m_bitmap_to_surface;
     bool m_needs_to_clear_bitmap_to_surface_cache { false };
+
+    // The last frame painted into one of the viewport's backing stores, used to only repaint what changed since.
+    // Only accessed from the rendering thread.
+    struct LastFrame {
+        NonnullRefPtr<Painting::DisplayList> display_list;
+        Painting::ScrollStateSnapshot scroll_state_snapshot;
+        NonnullRefPtr<Painting::BackingStore> backing_store;
+    };
+    Optional<LastFrame> m_last_frame;
 };
 
 }
@@ -7,6 +7,7 @@
 #include <AK/Debug.h>
 #include <LibCore/ElapsedTimer.h>
 #include <LibJS/Bytecode/Interpreter.h>
+#include <LibURL/Site.h>
 #include <LibWeb/Bindings/ExceptionOrUtils.h>
 #include <LibWeb/HTML/Scripting/ClassicScript.h>
 #include <LibWeb/HTML/Scripting/Environments.h>
@@ -48,9 +49,16 @@ GC::Ref<ClassicScript> ClassicScript::create(ByteString filename, StringView sou
 
     // FIXME: 9. Record classic script creation time given script and sourceURLForWindowScripts .
 
+    // NOTE: Parsed scripts are cached process-wide, so we partition the cache by the site of the top-level document and
+    //       the origin of the realm, like the HTTP cache. Opaque origins can't be told apart, so their scripts aren't
+    //       cached at all.
+    Optional<String> cache_partition_key;
+    if (auto& settings = principal_realm_settings_object(realm); !settings.origin().is_opaque() && !settings.top_level_origin.is_opaque())
+        cache_partition_key = MUST(String::formatted("{} {}", URL::Site::obtain(settings.top_level_origin).serialize(), settings.origin().serialize()));
+
     // 10. Let result be ParseScript(source, realm, script).
     auto parse_timer = Core::ElapsedTimer::start_new();
-    auto result = JS::Script::parse(source, realm, script->filename(), script, source_line_number);
+    auto result = JS::Script::parse(source, realm, script->filename(), script, source_line_number, cache_partition_key.map([](auto& key) { return key.bytes_as_string_view(); }));
     dbgln_if(HTML_SCRIPT_DEBUG, "ClassicScript: Parsed {} in {}ms", script->filename(), parse_timer.elapsed_milliseconds());
 
     // 11. If result is a list of errors, then:
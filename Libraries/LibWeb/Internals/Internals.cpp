@@ -7,6 +7,7 @@
 #include <LibJS/Runtime/VM.h>
 #include <LibWeb/Bindings/InternalsPrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/CSS/StyleComputer.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/Event.h>
 #include <LibWeb/DOM/EventTarget.h>
@@ -234,6 +235,12 @@ void Internals::set_echo_server_port(u16 const port)
     s_echo_server_port = port;
 }
 
+WebIDL::UnsignedLong Internals::get_shared_cascade_count()
+{
+    // NOTE: This is the number of elements that reused a sibling's cascaded values during the most recent style update.
+    return static_cast<WebIDL::UnsignedLong>(window().associated_document().style_computer().style_sharing_statistics().shared_cascades);
+}
+
 void Internals::set_browser_zoom(double factor)
 {
     page().client().page_did_set_browser_zoom(factor);
@@ -6,6 +6,7 @@
  */
 
 #include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOM/Element.h>
 #include <LibWeb/HTML/HTMLHtmlElement.h>
 #include <LibWeb/Layout/BlockContainer.h>
 #include <LibWeb/Layout/Box.h>
@@ -57,6 +58,44 @@ Optional<CSSPixelFraction> Box::natural_aspect_ratio() const
     return m_natural_aspect_ratio;
 }
 
+bool Box::is_relayout_boundary() const
+{
+    auto const* element = as_if<DOM::Element>(dom_node());
+    if (!element || is_generated())
+        return false;
+
+    // NOTE: We only consider block-level boxes in block flow. Inline-level boxes take their baseline from their contents,
+    //       and flex and grid containers may size and align their items based on them.
+    if (!display().is_block_outside() || is_flex_item() || is_grid_item())
+        return false;
+    if (!parent() || !(parent()->display().is_flow_inside() || parent()->display().is_flow_root_inside()))
+        return false;
+
+    // NOTE: Tables and replaced boxes grow to fit their contents (or natural size) regardless of their specified size,
+    //       so only boxes that lay out their own contents in flow can keep a change inside from affecting their size.
+    if (!(display().is_flow_inside() || display().is_flow_root_inside()) || is_table_wrapper() || is_replaced_box())
+        return false;
+
+    // The box must establish an independent formatting context, so that floats and margins inside it can not
+    // interact with anything outside of it.
+    auto const& computed_values = this->computed_values();
+    bool clips_overflow = computed_values.overflow_x() != CSS::Overflow::Visible && computed_values.overflow_y() != CSS::Overflow::Visible;
+    if (!clips_overflow && !element->has_layout_containment())
+        return false;
+
+    auto is_independent_of_contents = [](CSS::Size const& size) {
+        return size.is_length() || size.is_auto() || size.is_none();
+    };
+    if (!is_independent_of_contents(computed_values.min_width()) || !is_independent_of_contents(computed_values.max_width())
+        || !is_independent_of_contents(computed_values.min_height()) || !is_independent_of_contents(computed_values.max_height()))
+        return false;
+
+    // https://drafts.csswg.org/css-contain-2/#containment-size
+    if (has_size_containment())
+        return true;
+    return computed_values.width().is_length() && computed_values.height().is_length();
+}
+
 void Box::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
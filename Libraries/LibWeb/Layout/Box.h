@@ -43,6 +43,10 @@ public:
     bool has_size_containment() const { return m_has_size_containment; }
     void set_has_size_containment(bool value) { m_has_size_containment = value; }
 
+    // A box whose size and position can not be influenced by anything inside of it. Changes to its contents only
+    // require layout of the box itself, not of its ancestors.
+    bool is_relayout_boundary() const;
+
     void set_natural_width(Optional<CSSPixels> width) { m_natural_width = width; }
     void set_natural_height(Optional<CSSPixels> height) { m_natural_height = height; }
     void set_natural_aspect_ratio(Optional<CSSPixelFraction> ratio) { m_natural_aspect_ratio = ratio; }
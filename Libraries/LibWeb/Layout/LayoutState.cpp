@@ -618,6 +618,7 @@ void LayoutState::UsedValues::set_content_width(CSSPixels width)
     // FIXME: We should not do this! Definiteness of widths should be determined early,
     //        and not changed later (except for some special cases in flex layout..)
     m_has_definite_width = true;
+    m_has_been_laid_out = true;
 }
 
 void LayoutState::UsedValues::set_content_height(CSSPixels height)
@@ -628,6 +629,7 @@ void LayoutState::UsedValues::set_content_height(CSSPixels height)
         height = 0;
     }
     m_content_height = clamp_to_max_dimension_value(height);
+    m_has_been_laid_out = true;
 }
 
 AvailableSize LayoutState::UsedValues::available_width_inside() const
@@ -75,6 +75,9 @@ struct LayoutState {
         void set_has_definite_width(bool has_definite_width) { m_has_definite_width = has_definite_width; }
         void set_has_definite_height(bool has_definite_height) { m_has_definite_height = has_definite_height; }
 
+        // Whether layout has assigned a content size to this box, as opposed to its used values only having been read.
+        bool has_been_laid_out() const { return m_has_been_laid_out; }
+
         bool has_definite_width() const { return m_has_definite_width && width_constraint == SizeConstraint::None; }
         bool has_definite_height() const { return m_has_definite_height && height_constraint == SizeConstraint::None; }
 
@@ -182,6 +185,7 @@ struct LayoutState {
 
         bool m_has_definite_width { false };
         bool m_has_definite_height { false };
+        bool m_has_been_laid_out { false };
 
         HashTable<GC::Ptr<Box const>> m_floating_descendants;
 
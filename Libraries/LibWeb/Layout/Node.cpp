@@ -262,6 +262,12 @@ bool Node::establishes_stacking_context() const
     if (computed_values().view_transition_name().has_value())
         return true;
 
+    // https://drafts.csswg.org/css-will-change/#will-change
+    // If any non-initial value of a property would create a stacking context on the element, specifying that property
+    // in will-change must create a stacking context on the element.
+    if (computed_values().will_change().creates_stacking_context())
+        return true;
+
     return computed_values().opacity() < 1.0f;
 }
 
@@ -934,6 +940,7 @@ void NodeWithStyle::apply_style(CSS::ComputedProperties const& computed_style)
     }
 
     computed_values.set_touch_action(computed_style.touch_action());
+    computed_values.set_will_change(computed_style.will_change());
 
     auto const& math_shift_value = computed_style.property(CSS::PropertyID::MathShift);
     if (auto math_shift = keyword_to_math_shift(math_shift_value.to_keyword()); math_shift.has_value())
@@ -1285,7 +1292,9 @@ void NodeWithStyleAndBoxModelMetrics::visit_edges(Cell::Visitor& visitor)
 
 void Node::set_needs_layout_update(DOM::SetNeedsLayoutReason reason)
 {
-    if (m_needs_layout_update)
+    // NOTE: If we were only marked as the ancestor of a change below us, and we are a relayout boundary, our ancestors
+    //       have not been marked yet. A change to this node itself must still be propagated to them.
+    if (m_needs_layout_update && (!parent() || parent()->m_needs_layout_update))
         return;
 
     if constexpr (UPDATE_LAYOUT_DEBUG) {
@@ -1306,10 +1315,22 @@ void Node::set_needs_layout_update(DOM::SetNeedsLayoutReason reason)
         return IterationDecision::Continue;
     });
 
+    // OPTIMIZATION: Once we pass a relayout boundary, the layout of the ancestors above it can no longer be affected by
+    //               this change. We only flag them as having a child that needs layout, which keeps their cached
+    //               intrinsic sizes alive.
+    bool passed_relayout_boundary = false;
     for (auto* ancestor = parent(); ancestor; ancestor = ancestor->parent()) {
         if (ancestor->m_needs_layout_update)
             break;
+        if (passed_relayout_boundary) {
+            if (ancestor->m_child_needs_layout_update)
+                break;
+            ancestor->m_child_needs_layout_update = true;
+            continue;
+        }
         ancestor->m_needs_layout_update = true;
+        if (auto* box = as_if<Box>(*ancestor); box && box->is_relayout_boundary())
+            passed_relayout_boundary = true;
     }
 }
 
@@ -47,7 +47,15 @@ public:
 
     bool needs_layout_update() const { return m_needs_layout_update; }
     void set_needs_layout_update(DOM::SetNeedsLayoutReason);
-    void reset_needs_layout_update() { m_needs_layout_update = false; }
+    void reset_needs_layout_update()
+    {
+        m_needs_layout_update = false;
+        m_child_needs_layout_update = false;
+    }
+
+    // Set on the ancestors of a relayout boundary whose contents need layout. The layout of these ancestors is
+    // unaffected, so they keep their cached intrinsic sizes, but a layout pass is still required.
+    bool child_needs_layout_update() const { return m_child_needs_layout_update; }
 
     bool is_generated() const { return m_generated_for.has_value(); }
     bool is_generated_for_before_pseudo_element() const { return m_generated_for == CSS::GeneratedPseudoElement::Before; }
@@ -220,6 +228,7 @@ private:
     bool m_has_been_wrapped_in_table_wrapper { false };
 
     bool m_needs_layout_update { false };
+    bool m_child_needs_layout_update { false };
 
     Optional<CSS::GeneratedPseudoElement> m_generated_for {};
 
@@ -46,6 +46,10 @@ public:
     GC::Ptr<Page> page() const { return m_page.ptr(); }
     void set_page(Page& page) { m_page = page; }
 
+    // Identifies the sites that may share cached responses to this request. Requests without one are not cached.
+    Optional<String> const& cache_partition_key() const { return m_cache_partition_key; }
+    void set_cache_partition_key(Optional<String> cache_partition_key) { m_cache_partition_key = move(cache_partition_key); }
+
     unsigned hash() const
     {
         auto body_hash = string_hash((char const*)m_body.data(), m_body.size());
@@ -82,6 +86,7 @@ private:
     ByteBuffer m_body;
     Core::ElapsedTimer m_load_timer;
     GC::Root<Page> m_page;
+    Optional<String> m_cache_partition_key;
     bool m_main_resource { false };
 };
 
@@ -449,6 +449,15 @@ struct ApplyMaskBitmap {
     }
 };
 
+// Paints the commands of a stacking context that is likely to be repainted with only its transform or opacity changing,
+// e.g. while those are animated. The player may rasterize the display list into a compositor layer once, and keep
+// reusing it for as long as the display list stays the same.
+struct PaintCompositorLayer {
+    // Identifies the layer across frames.
+    u64 layer_id { 0 };
+    NonnullRefPtr<DisplayList> display_list;
+};
+
 using Command = Variant<
     DrawGlyphRun,
     FillRect,
@@ -487,5 +496,6 @@ using Command = Variant<
     ApplyCompositeAndBlendingOperator,
     ApplyFilters,
     ApplyTransform,
-    ApplyMaskBitmap>;
+    ApplyMaskBitmap,
+    PaintCompositorLayer>;
 }
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Debug.h>
+#include <AK/HashTable.h>
+#include <LibWeb/Painting/CompositorLayerCache.h>
+#include <LibWeb/Painting/DamageTracking.h>
+
+namespace Web::Painting {
+
+Optional<CompositorLayerCache::RasterizedLayer> CompositorLayerCache::find_or_rasterize(PaintCompositorLayer const& command, ScrollStateSnapshot const& scroll_state, RasterizeFunction const& rasterize)
+{
+    // NOTE: The mutex is recursive, so layers nested in this one can be rasterized by the function we call below.
+    Threading::MutexLocker const locker { m_mutex };
+
+    if (auto it = m_layers.find(command.layer_id); it != m_layers.end()) {
+        auto& layer = it->value;
+        auto damage_rect = compute_damage_rect(*layer.display_list, layer.scroll_state, *command.display_list, scroll_state);
+        if (damage_rect.has_value() && damage_rect->is_empty()) {
+            // Hold on to the newest display list, so the previous one can be freed.
+            layer.display_list = command.display_list;
+            layer.scroll_state = scroll_state;
+            return layer.rasterized;
+        }
+        m_layers.remove(it);
+    }
+
+    auto bounds = compute_display_list_bounds(*command.display_list, scroll_state);
+    if (!bounds.has_value() || bounds->is_empty())
+        return {};
+    if (static_cast<u64>(bounds->width()) * static_cast<u64>(bounds->height()) > maximum_layer_area)
+        return {};
+
+    auto bitmap = rasterize(*bounds);
+    if (!bitmap)
+        return {};
+
+    dbgln_if(COMPOSITOR_LAYER_DEBUG, "Rasterized compositor layer {} at {}", command.layer_id, *bounds);
+
+    RasterizedLayer rasterized { bitmap.release_nonnull(), *bounds };
+    m_layers.set(command.layer_id, Layer { command.display_list, scroll_state, rasterized });
+    return rasterized;
+}
+
+static void collect_layer_ids(DisplayList const& display_list, HashTable<u64>& layer_ids)
+{
+    for (auto const& item : display_list.commands()) {
+        item.command.visit(
+            [&](PaintCompositorLayer const& command) {
+                layer_ids.set(command.layer_id);
+                collect_layer_ids(*command.display_list, layer_ids);
+            },
+            [&](PaintNestedDisplayList const& command) {
+                if (command.display_list)
+                    collect_layer_ids(*command.display_list, layer_ids);
+            },
+            [](auto const&) {});
+    }
+}
+
+void CompositorLayerCache::retain_only_layers_in(DisplayList const& display_list)
+{
+    HashTable<u64> layer_ids;
+    collect_layer_ids(display_list, layer_ids);
+
+    Threading::MutexLocker const locker { m_mutex };
+    m_layers.remove_all_matching([&](u64 layer_id, Layer const&) {
+        return !layer_ids.contains(layer_id);
+    });
+}
+
+void CompositorLayerCache::clear()
+{
+    Threading::MutexLocker const locker { m_mutex };
+    m_layers.clear();
+}
+
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Function.h>
+#include <AK/HashMap.h>
+#include <AK/Noncopyable.h>
+#include <LibGfx/ImmutableBitmap.h>
+#include <LibGfx/Rect.h>
+#include <LibThreading/Mutex.h>
+#include <LibWeb/Painting/DisplayList.h>
+#include <LibWeb/Painting/ScrollState.h>
+
+namespace Web::Painting {
+
+// Keeps the rasterized content of compositor layers around between frames, so that a layer whose content did not
+// change only needs to be drawn with its new transform and opacity, rather than being painted all over again.
+//
+// NOTE: This is shared by all the players painting a traversable's frames, which may run on several threads at once.
+class CompositorLayerCache {
+    AK_MAKE_NONCOPYABLE(CompositorLayerCache);
+    AK_MAKE_NONMOVABLE(CompositorLayerCache);
+
+public:
+    // Layers with more pixels than this are painted directly instead.
+    static constexpr u64 maximum_layer_area = 4096 * 4096;
+
+    CompositorLayerCache() = default;
+
+    struct RasterizedLayer {
+        NonnullRefPtr<Gfx::ImmutableBitmap> bitmap;
+        // Where the bitmap goes, in the coordinate space the layer is painted in.
+        Gfx::IntRect rect;
+    };
+
+    // Returns the rasterized content of the layer, calling the given function to rasterize the part of the surface
+    // covered by the layer if it's not in the cache, or the cached content is out of date. An empty Optional means
+    // that the layer can't be cached, and its display list should be played back directly.
+    using RasterizeFunction = Function<RefPtr<Gfx::ImmutableBitmap>(Gfx::IntRect const&)>;
+    Optional<RasterizedLayer> find_or_rasterize(PaintCompositorLayer const&, ScrollStateSnapshot const&, RasterizeFunction const&);
+
+    // Drops the layers that the given display list does not paint anymore.
+    void retain_only_layers_in(DisplayList const&);
+
+    void clear();
+
+private:
+    struct Layer {
+        NonnullRefPtr<DisplayList> display_list;
+        ScrollStateSnapshot scroll_state;
+        RasterizedLayer rasterized;
+    };
+
+    Threading::Mutex m_mutex;
+    HashMap<u64, Layer> m_layers;
+};
+
+}
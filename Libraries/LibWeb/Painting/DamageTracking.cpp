@@ -0,0 +1,434 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibGfx/AffineTransform.h>
+#include <LibGfx/Matrix4x4.h>
+#include <LibGfx/TextLayout.h>
+#include <LibWeb/Painting/DamageTracking.h>
+
+namespace Web::Painting {
+
+// Glyphs may be drawn slightly outside of the rect of their run (e.g. italic overhang), and anti-aliasing may touch
+// the pixels right next to a shape, so damage is padded by this much.
+static constexpr int damage_padding = 2;
+
+static bool glyph_runs_are_identical(Gfx::GlyphRun const& a, Gfx::GlyphRun const& b)
+{
+    if (&a == &b)
+        return true;
+    if (&a.font() != &b.font() || a.text_type() != b.text_type() || a.glyphs().size() != b.glyphs().size())
+        return false;
+    for (size_t i = 0; i < a.glyphs().size(); ++i) {
+        if (a.glyphs()[i].glyph_id != b.glyphs()[i].glyph_id || a.glyphs()[i].position != b.glyphs()[i].position)
+            return false;
+    }
+    return true;
+}
+
+static bool corner_radii_are_identical(CornerRadii const& a, CornerRadii const& b)
+{
+    auto radii_are_identical = [](CornerRadius const& a, CornerRadius const& b) {
+        return a.horizontal_radius == b.horizontal_radius && a.vertical_radius == b.vertical_radius;
+    };
+    return radii_are_identical(a.top_left, b.top_left)
+        && radii_are_identical(a.top_right, b.top_right)
+        && radii_are_identical(a.bottom_right, b.bottom_right)
+        && radii_are_identical(a.bottom_left, b.bottom_left);
+}
+
+static bool matrices_are_identical(Gfx::FloatMatrix4x4 const& a, Gfx::FloatMatrix4x4 const& b)
+{
+    return __builtin_memcmp(a.elements(), b.elements(), sizeof(float) * 16) == 0;
+}
+
+static bool color_stops_are_identical(ColorStopData const& a, ColorStopData const& b, CSS::InterpolationMethod const& a_method, CSS::InterpolationMethod const& b_method)
+{
+    return a.list == b.list
+        && a.repeat_length == b.repeat_length
+        && a_method.color_space == b_method.color_space
+        && a_method.hue_method == b_method.hue_method;
+}
+
+static bool box_shadows_are_identical(PaintBoxShadowParams const& a, PaintBoxShadowParams const& b)
+{
+    return a.color == b.color
+        && a.placement == b.placement
+        && corner_radii_are_identical(a.corner_radii, b.corner_radii)
+        && a.offset_x == b.offset_x
+        && a.offset_y == b.offset_y
+        && a.blur_radius == b.blur_radius
+        && a.spread_distance == b.spread_distance
+        && a.device_content_rect == b.device_content_rect;
+}
+
+static bool display_lists_are_identical(DisplayList const& a, ScrollStateSnapshot const& a_scroll_state, DisplayList const& b, ScrollStateSnapshot const& b_scroll_state)
+{
+    if (&a == &b)
+        return true;
+    auto damage = compute_damage_rect(a, a_scroll_state, b, b_scroll_state);
+    return damage.has_value() && damage->is_empty();
+}
+
+// NOTE: Commands we don't know how to compare are never identical, which makes us repaint them every frame.
+static bool commands_are_identical(Command const& a_command, Command const& b_command)
+{
+    if (a_command.index() != b_command.index())
+        return false;
+
+    return a_command.visit([&](auto const& a) -> bool {
+        using T = RemoveCVReference<decltype(a)>;
+        auto const& b = b_command.get<T>();
+
+        if constexpr (IsSame<T, DrawGlyphRun>) {
+            return a.scale == b.scale && a.rect == b.rect && a.translation == b.translation && a.color == b.color
+                && a.orientation == b.orientation && glyph_runs_are_identical(a.glyph_run, b.glyph_run);
+        } else if constexpr (IsSame<T, FillRect>) {
+            return a.rect == b.rect && a.color == b.color;
+        } else if constexpr (IsSame<T, DrawScaledImmutableBitmap>) {
+            return a.dst_rect == b.dst_rect && a.clip_rect == b.clip_rect && a.bitmap == b.bitmap && a.scaling_mode == b.scaling_mode;
+        } else if constexpr (IsSame<T, DrawRepeatedImmutableBitmap>) {
+            return a.dst_rect == b.dst_rect && a.clip_rect == b.clip_rect && a.bitmap == b.bitmap && a.scaling_mode == b.scaling_mode
+                && a.repeat.x == b.repeat.x && a.repeat.y == b.repeat.y;
+        } else if constexpr (IsOneOf<T, Save, SaveLayer, Restore, PopStackingContext>) {
+            return true;
+        } else if constexpr (IsSame<T, Translate>) {
+            return a.delta == b.delta;
+        } else if constexpr (IsSame<T, AddClipRect>) {
+            return a.rect == b.rect;
+        } else if constexpr (IsSame<T, PushStackingContext>) {
+            return a.opacity == b.opacity && a.compositing_and_blending_operator == b.compositing_and_blending_operator
+                && a.isolate == b.isolate && a.source_paintable_rect == b.source_paintable_rect
+                && a.transform.origin == b.transform.origin && matrices_are_identical(a.transform.matrix, b.transform.matrix)
+                && !a.clip_path.has_value() && !b.clip_path.has_value();
+        } else if constexpr (IsSame<T, PaintLinearGradient>) {
+            return a.gradient_rect == b.gradient_rect && a.linear_gradient_data.gradient_angle == b.linear_gradient_data.gradient_angle
+                && color_stops_are_identical(a.linear_gradient_data.color_stops, b.linear_gradient_data.color_stops, a.linear_gradient_data.interpolation_method, b.linear_gradient_data.interpolation_method);
+        } else if constexpr (IsSame<T, PaintRadialGradient>) {
+            return a.rect == b.rect && a.center == b.center && a.size == b.size
+                && color_stops_are_identical(a.radial_gradient_data.color_stops, b.radial_gradient_data.color_stops, a.radial_gradient_data.interpolation_method, b.radial_gradient_data.interpolation_method);
+        } else if constexpr (IsSame<T, PaintConicGradient>) {
+            return a.rect == b.rect && a.position == b.position && a.conic_gradient_data.start_angle == b.conic_gradient_data.start_angle
+                && color_stops_are_identical(a.conic_gradient_data.color_stops, b.conic_gradient_data.color_stops, a.conic_gradient_data.interpolation_method, b.conic_gradient_data.interpolation_method);
+        } else if constexpr (IsOneOf<T, PaintOuterBoxShadow, PaintInnerBoxShadow>) {
+            return box_shadows_are_identical(a.box_shadow_params, b.box_shadow_params);
+        } else if constexpr (IsSame<T, PaintTextShadow>) {
+            return a.glyph_run_scale == b.glyph_run_scale && a.shadow_bounding_rect == b.shadow_bounding_rect && a.text_rect == b.text_rect
+                && a.draw_location == b.draw_location && a.blur_radius == b.blur_radius && a.color == b.color
+                && glyph_runs_are_identical(a.glyph_run, b.glyph_run);
+        } else if constexpr (IsSame<T, FillRectWithRoundedCorners>) {
+            return a.rect == b.rect && a.color == b.color && corner_radii_are_identical(a.corner_radii, b.corner_radii);
+        } else if constexpr (IsSame<T, DrawEllipse>) {
+            return a.rect == b.rect && a.color == b.color && a.thickness == b.thickness;
+        } else if constexpr (IsSame<T, FillEllipse>) {
+            return a.rect == b.rect && a.color == b.color;
+        } else if constexpr (IsSame<T, DrawLine>) {
+            return a.color == b.color && a.from == b.from && a.to == b.to && a.thickness == b.thickness
+                && a.style == b.style && a.alternate_color == b.alternate_color;
+        } else if constexpr (IsSame<T, DrawRect>) {
+            return a.rect == b.rect && a.color == b.color && a.rough == b.rough;
+        } else if constexpr (IsSame<T, DrawTriangleWave>) {
+            return a.p1 == b.p1 && a.p2 == b.p2 && a.color == b.color && a.amplitude == b.amplitude && a.thickness == b.thickness;
+        } else if constexpr (IsSame<T, AddRoundedRectClip>) {
+            return a.border_rect == b.border_rect && a.corner_clip == b.corner_clip && corner_radii_are_identical(a.corner_radii, b.corner_radii);
+        } else if constexpr (IsSame<T, PaintNestedDisplayList>) {
+            if (a.rect != b.rect || !a.display_list || !b.display_list)
+                return a.rect == b.rect && a.display_list == b.display_list;
+            return display_lists_are_identical(*a.display_list, a.scroll_state_snapshot, *b.display_list, b.scroll_state_snapshot);
+        } else if constexpr (IsSame<T, PaintScrollBar>) {
+            return a.gutter_rect == b.gutter_rect && a.thumb_rect == b.thumb_rect && a.vertical == b.vertical;
+        } else if constexpr (IsSame<T, ApplyOpacity>) {
+            return a.opacity == b.opacity;
+        } else if constexpr (IsSame<T, ApplyCompositeAndBlendingOperator>) {
+            return a.compositing_and_blending_operator == b.compositing_and_blending_operator;
+        } else if constexpr (IsSame<T, ApplyTransform>) {
+            return a.origin == b.origin && matrices_are_identical(a.matrix, b.matrix);
+        } else {
+            return false;
+        }
+    });
+}
+
+// Applies the scroll offsets to a command, the same way DisplayListPlayer does before executing it.
+static Command resolve_command(DisplayList::CommandListItem const& item, ScrollStateSnapshot const& scroll_state, double device_pixels_per_css_pixel)
+{
+    auto command = item.command;
+
+    if (command.has<PaintScrollBar>()) {
+        auto& paint_scroll_bar = command.get<PaintScrollBar>();
+        auto scroll_offset = scroll_state.own_offset_for_frame_with_id(paint_scroll_bar.scroll_frame_id);
+        if (paint_scroll_bar.vertical) {
+            auto offset = scroll_offset.y() * paint_scroll_bar.scroll_size;
+            paint_scroll_bar.thumb_rect.translate_by(0, -offset.to_int() * device_pixels_per_css_pixel);
+        } else {
+            auto offset = scroll_offset.x() * paint_scroll_bar.scroll_size;
+            paint_scroll_bar.thumb_rect.translate_by(-offset.to_int() * device_pixels_per_css_pixel, 0);
+        }
+    }
+
+    if (item.scroll_frame_id.has_value()) {
+        auto cumulative_offset = scroll_state.cumulative_offset_for_frame_with_id(item.scroll_frame_id.value());
+        auto scroll_offset = cumulative_offset.to_type<double>().scaled(device_pixels_per_css_pixel).to_type<int>();
+        command.visit(
+            [&](auto& command) {
+                if constexpr (requires { command.translate_by(scroll_offset); }) {
+                    command.translate_by(scroll_offset);
+                }
+            });
+    }
+
+    return command;
+}
+
+static bool items_are_identical(DisplayList::CommandListItem const& a, ScrollStateSnapshot const& a_scroll_state, DisplayList::CommandListItem const& b, ScrollStateSnapshot const& b_scroll_state, double device_pixels_per_css_pixel)
+{
+    if (a.scroll_frame_id != b.scroll_frame_id)
+        return false;
+
+    // NOTE: The commands of a compositor layer are played back with the same scroll state as the layer itself.
+    if (a.command.has<PaintCompositorLayer>() && b.command.has<PaintCompositorLayer>()) {
+        auto const& a_layer = a.command.get<PaintCompositorLayer>();
+        auto const& b_layer = b.command.get<PaintCompositorLayer>();
+        return a_layer.layer_id == b_layer.layer_id
+            && display_lists_are_identical(*a_layer.display_list, a_scroll_state, *b_layer.display_list, b_scroll_state);
+    }
+
+    // NOTE: Scrollbars move with their own scroll frame, which is not reflected by the item's scroll frame.
+    if (a.scroll_frame_id.has_value() || a.command.has<PaintScrollBar>()) {
+        if (a.scroll_frame_id.has_value()) {
+            auto a_offset = a_scroll_state.cumulative_offset_for_frame_with_id(a.scroll_frame_id.value());
+            auto b_offset = b_scroll_state.cumulative_offset_for_frame_with_id(b.scroll_frame_id.value());
+            if (a_offset != b_offset)
+                return false;
+        }
+        if (a.command.has<PaintScrollBar>())
+            return commands_are_identical(resolve_command(a, a_scroll_state, device_pixels_per_css_pixel), resolve_command(b, b_scroll_state, device_pixels_per_css_pixel));
+    }
+
+    return commands_are_identical(a.command, b.command);
+}
+
+// The area a (resolved) command may paint into, in the coordinate space it is executed in. Commands that affect how
+// later commands are painted, rather than painting anything themselves, have no such area.
+static Optional<Gfx::IntRect> painted_rect(Command const& command)
+{
+    return command.visit(
+        [](DrawGlyphRun const& command) -> Optional<Gfx::IntRect> {
+            return command.rect.inflated(command.rect.height(), command.rect.height() / 2);
+        },
+        [](DrawRepeatedImmutableBitmap const& command) -> Optional<Gfx::IntRect> {
+            return command.clip_rect;
+        },
+        [](DrawLine const& command) -> Optional<Gfx::IntRect> {
+            return Gfx::IntRect::from_two_points(command.from, command.to).inflated(command.thickness * 2, command.thickness * 2);
+        },
+        [](DrawTriangleWave const& command) -> Optional<Gfx::IntRect> {
+            auto extent = (command.amplitude + command.thickness) * 2;
+            return Gfx::IntRect::from_two_points(command.p1, command.p2).inflated(extent, extent);
+        },
+        [](PaintScrollBar const& command) -> Optional<Gfx::IntRect> {
+            return command.gutter_rect.united(command.thumb_rect);
+        },
+        [](auto const& command) -> Optional<Gfx::IntRect> {
+            if constexpr (requires { command.bounding_rect(); })
+                return command.bounding_rect();
+            else
+                return {};
+        });
+}
+
+static bool is_filter(Command const& command)
+{
+    return command.has<ApplyFilters>() || command.has<ApplyBackdropFilter>();
+}
+
+static bool is_clip_or_mask(Command const& command)
+{
+    return command.visit([](auto const& command) {
+        if constexpr (requires { command.is_clip_or_mask(); })
+            return command.is_clip_or_mask();
+        else
+            return false;
+    });
+}
+
+// Whether a command affects how the commands after it are painted, in addition to (or instead of) painting something.
+static bool changes_canvas_state(Command const& command)
+{
+    return command.visit(
+        [](PaintNestedDisplayList const&) { return true; },
+        [](PaintCompositorLayer const&) { return false; },
+        [](auto const& command) {
+            if constexpr (requires { command.is_clip_or_mask(); })
+                return command.is_clip_or_mask();
+            else
+                return !painted_rect(Command { command }).has_value();
+        });
+}
+
+namespace {
+
+// Follows the transforms of the canvas through a display list, the same way DisplayListPlayerSkia does.
+class TransformTracker {
+public:
+    void apply(Command const& command)
+    {
+        command.visit(
+            [&](Save const&) { m_saved_transforms.append(m_transform); },
+            [&](SaveLayer const&) { m_saved_transforms.append(m_transform); },
+            [&](Restore const&) { restore(); },
+            [&](Translate const& command) { m_transform.translate(command.delta.to_type<float>()); },
+            [&](PushStackingContext const& command) {
+                m_saved_transforms.append(m_transform);
+                concat(command.transform.origin, command.transform.matrix);
+            },
+            [&](PopStackingContext const&) { restore(); },
+            [&](ApplyTransform const& command) { concat(command.origin, command.matrix); },
+            [&](PaintNestedDisplayList const& command) { m_transform.translate(command.rect.location().to_type<float>()); },
+            [](auto const&) {});
+    }
+
+    Gfx::IntRect map(Gfx::IntRect const& rect) const { return m_transform.map(rect); }
+
+private:
+    void restore()
+    {
+        if (!m_saved_transforms.is_empty())
+            m_transform = m_saved_transforms.take_last();
+    }
+
+    void concat(Gfx::FloatPoint origin, Gfx::FloatMatrix4x4 const& matrix)
+    {
+        auto affine_transform = Gfx::extract_2d_affine_transform(matrix);
+        m_transform.multiply(Gfx::AffineTransform {}.translate(origin).multiply(affine_transform).translate(-origin));
+    }
+
+    Gfx::AffineTransform m_transform;
+    Vector<Gfx::AffineTransform> m_saved_transforms;
+};
+
+}
+
+Optional<Gfx::IntRect> compute_damage_rect(DisplayList const& previous, ScrollStateSnapshot const& previous_scroll_state, DisplayList const& next, ScrollStateSnapshot const& next_scroll_state)
+{
+    if (previous.device_pixels_per_css_pixel() != next.device_pixels_per_css_pixel())
+        return {};
+
+    auto device_pixels_per_css_pixel = next.device_pixels_per_css_pixel();
+    auto const& previous_commands = previous.commands();
+    auto const& next_commands = next.commands();
+
+    TransformTracker transform_tracker;
+    Gfx::IntRect damage;
+    bool has_filters = false;
+
+    auto identical = [&](size_t previous_index, size_t next_index) {
+        auto const& previous_item = previous_commands[previous_index];
+        auto const& next_item = next_commands[next_index];
+        has_filters |= is_filter(previous_item.command) || is_filter(next_item.command);
+        return items_are_identical(previous_item, previous_scroll_state, next_item, next_scroll_state, device_pixels_per_css_pixel);
+    };
+
+    auto track_transform = [&](DisplayList::CommandListItem const& item, ScrollStateSnapshot const& scroll_state) {
+        if (item.scroll_frame_id.has_value())
+            transform_tracker.apply(resolve_command(item, scroll_state, device_pixels_per_css_pixel));
+        else
+            transform_tracker.apply(item.command);
+    };
+
+    // Returns false if the damage caused by the item can't be bounded.
+    auto add_damage = [&](DisplayList::CommandListItem const& item, ScrollStateSnapshot const& scroll_state) {
+        auto rect = item.command.has<PaintCompositorLayer>()
+            ? compute_display_list_bounds(*item.command.get<PaintCompositorLayer>().display_list, scroll_state)
+            : painted_rect(resolve_command(item, scroll_state, device_pixels_per_css_pixel));
+        if (!rect.has_value())
+            return false;
+        damage.unite(transform_tracker.map(*rect).inflated(damage_padding * 2, damage_padding * 2));
+        return true;
+    };
+
+    if (previous_commands.size() == next_commands.size()) {
+        // Compare the lists command by command. As long as every command that changes the canvas state is identical,
+        // both lists have the same state at every index.
+        for (size_t i = 0; i < next_commands.size(); ++i) {
+            if (!identical(i, i)) {
+                // NOTE: A changed clip only affects what is painted inside the old and new clip rects, but a nested
+                //       display list that moved also moves the canvas for the commands that follow it.
+                auto const& previous_command = previous_commands[i].command;
+                auto const& next_command = next_commands[i].command;
+                if (previous_command.has<PaintNestedDisplayList>() && next_command.has<PaintNestedDisplayList>()
+                    && previous_command.get<PaintNestedDisplayList>().rect != next_command.get<PaintNestedDisplayList>().rect)
+                    return {};
+
+                if (!add_damage(previous_commands[i], previous_scroll_state) || !add_damage(next_commands[i], next_scroll_state))
+                    return {};
+            }
+            track_transform(next_commands[i], next_scroll_state);
+        }
+    } else {
+        // Something was added or removed; skip over the identical commands at the start and the end, and damage
+        // everything in between.
+        auto common_size = min(previous_commands.size(), next_commands.size());
+
+        size_t prefix_size = 0;
+        while (prefix_size < common_size && identical(prefix_size, prefix_size)) {
+            track_transform(next_commands[prefix_size], next_scroll_state);
+            ++prefix_size;
+        }
+
+        size_t suffix_size = 0;
+        while (suffix_size < common_size - prefix_size && identical(previous_commands.size() - 1 - suffix_size, next_commands.size() - 1 - suffix_size))
+            ++suffix_size;
+
+        // NOTE: The commands after the changed ones are only painted the same way if the canvas state is the same,
+        //       so we give up if anything in between changes it.
+        for (size_t i = prefix_size; i < previous_commands.size() - suffix_size; ++i) {
+            if (changes_canvas_state(previous_commands[i].command) || !add_damage(previous_commands[i], previous_scroll_state))
+                return {};
+        }
+        for (size_t i = prefix_size; i < next_commands.size() - suffix_size; ++i) {
+            if (changes_canvas_state(next_commands[i].command) || !add_damage(next_commands[i], next_scroll_state))
+                return {};
+        }
+    }
+
+    // NOTE: Filters such as blur() spread changes beyond the bounds of whatever changed.
+    if (has_filters && !damage.is_empty())
+        return {};
+
+    return damage;
+}
+
+Optional<Gfx::IntRect> compute_display_list_bounds(DisplayList const& display_list, ScrollStateSnapshot const& scroll_state)
+{
+    auto device_pixels_per_css_pixel = display_list.device_pixels_per_css_pixel();
+
+    TransformTracker transform_tracker;
+    Gfx::IntRect bounds;
+    for (auto const& item : display_list.commands()) {
+        auto command = resolve_command(item, scroll_state, device_pixels_per_css_pixel);
+        if (is_filter(command))
+            return {};
+
+        Optional<Gfx::IntRect> rect;
+        if (auto const* layer = command.get_pointer<PaintCompositorLayer>()) {
+            rect = compute_display_list_bounds(*layer->display_list, scroll_state);
+            if (!rect.has_value())
+                return {};
+        } else if (!is_clip_or_mask(command)) {
+            rect = painted_rect(command);
+        }
+
+        if (rect.has_value())
+            bounds.unite(transform_tracker.map(*rect));
+        transform_tracker.apply(command);
+    }
+
+    if (bounds.is_empty())
+        return bounds;
+    return bounds.inflated(damage_padding * 2, damage_padding * 2);
+}
+
+}
@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Optional.h>
+#include <LibGfx/Rect.h>
+#include <LibWeb/Painting/DisplayList.h>
+#include <LibWeb/Painting/ScrollState.h>
+
+namespace Web::Painting {
+
+// Compares the display list of the previous frame with that of the next one, and returns the part of the surface that
+// may render differently between them. An empty rect means nothing changed, while an empty Optional means that the
+// damage could not be bounded, and the whole surface should be repainted.
+//
+// NOTE: This errs on the side of caution: commands that cannot be compared (e.g. paths and painting surfaces) are
+//       always considered damaged, and changes to state commands (transforms, clips that come and go, filters) damage
+//       everything.
+Optional<Gfx::IntRect> compute_damage_rect(DisplayList const& previous, ScrollStateSnapshot const& previous_scroll_state, DisplayList const& next, ScrollStateSnapshot const& next_scroll_state);
+
+// Returns the part of the surface that playing back the display list may paint into, or an empty Optional if that
+// can't be bounded (e.g. because of filters).
+Optional<Gfx::IntRect> compute_display_list_bounds(DisplayList const&, ScrollStateSnapshot const&);
+
+}
@@ -35,18 +35,18 @@ static bool command_is_clip_or_mask(Command const& command)
         });
 }
 
-void DisplayListPlayer::execute(DisplayList& display_list, ScrollStateSnapshot const& scroll_state, RefPtr<Gfx::PaintingSurface> surface)
+void DisplayListPlayer::execute(DisplayList& display_list, ScrollStateSnapshot const& scroll_state, RefPtr<Gfx::PaintingSurface> surface, Optional<Gfx::IntRect> damage_rect)
 {
     if (surface) {
         surface->lock_context();
     }
-    execute_impl(display_list, scroll_state, surface);
+    execute_impl(display_list, scroll_state, surface, damage_rect);
     if (surface) {
         surface->unlock_context();
     }
 }
 
-void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnapshot const& scroll_state, RefPtr<Gfx::PaintingSurface> surface)
+void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnapshot const& scroll_state, RefPtr<Gfx::PaintingSurface> surface, Optional<Gfx::IntRect> damage_rect)
 {
     if (surface)
         m_surfaces.append(*surface);
@@ -60,6 +60,12 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
 
     VERIFY(!m_surfaces.is_empty());
 
+    // NOTE: Clipping to the damage rect makes every command outside of it get culled below.
+    if (damage_rect.has_value()) {
+        save({});
+        add_clip_rect({ *damage_rect });
+    }
+
     for (size_t command_index = 0; command_index < commands.size(); command_index++) {
         auto scroll_frame_id = commands[command_index].scroll_frame_id;
         auto command = commands[command_index].command;
@@ -145,10 +151,15 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
         else HANDLE_COMMAND(ApplyFilters, apply_filters)
         else HANDLE_COMMAND(ApplyTransform, apply_transform)
         else HANDLE_COMMAND(ApplyMaskBitmap, apply_mask_bitmap)
+        else if (command.has<PaintCompositorLayer>())
+            paint_compositor_layer(command.get<PaintCompositorLayer>(), scroll_state);
         else VERIFY_NOT_REACHED();
         // clang-format on
     }
 
+    if (damage_rect.has_value())
+        restore({});
+
     if (surface)
         flush();
 }
@@ -26,11 +26,12 @@ class DisplayListPlayer {
 public:
     virtual ~DisplayListPlayer() = default;
 
-    void execute(DisplayList&, ScrollStateSnapshot const&, RefPtr<Gfx::PaintingSurface>);
+    // If a damage rect is given, only that part of the surface is repainted, and the rest is left untouched.
+    void execute(DisplayList&, ScrollStateSnapshot const&, RefPtr<Gfx::PaintingSurface>, Optional<Gfx::IntRect> damage_rect = {});
 
 protected:
     Gfx::PaintingSurface& surface() const { return m_surfaces.last(); }
-    void execute_impl(DisplayList&, ScrollStateSnapshot const& scroll_state, RefPtr<Gfx::PaintingSurface>);
+    void execute_impl(DisplayList&, ScrollStateSnapshot const& scroll_state, RefPtr<Gfx::PaintingSurface>, Optional<Gfx::IntRect> damage_rect = {});
 
 private:
     virtual void flush() = 0;
@@ -72,6 +73,7 @@ private:
     virtual void apply_filters(ApplyFilters const&) = 0;
     virtual void apply_transform(ApplyTransform const&) = 0;
     virtual void apply_mask_bitmap(ApplyMaskBitmap const&) = 0;
+    virtual void paint_compositor_layer(PaintCompositorLayer const&, ScrollStateSnapshot const&) = 0;
     virtual bool would_be_fully_clipped_by_painter(Gfx::IntRect) const = 0;
 
     Vector<NonnullRefPtr<Gfx::PaintingSurface>, 1> m_surfaces;
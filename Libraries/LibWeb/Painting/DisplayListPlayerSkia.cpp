@@ -1114,6 +1114,28 @@ void DisplayListPlayerSkia::apply_mask_bitmap(ApplyMaskBitmap const& command)
     canvas.clipShader(builder.makeShader());
 }
 
+void DisplayListPlayerSkia::paint_compositor_layer(PaintCompositorLayer const& command, ScrollStateSnapshot const& scroll_state)
+{
+    Optional<CompositorLayerCache::RasterizedLayer> layer;
+    if (m_compositor_layer_cache) {
+        layer = m_compositor_layer_cache->find_or_rasterize(command, scroll_state, [&](Gfx::IntRect const& rect) -> RefPtr<Gfx::ImmutableBitmap> {
+            auto layer_surface = Gfx::PaintingSurface::create_with_size(m_context, rect.size(), Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied);
+            layer_surface->canvas().translate(-rect.x(), -rect.y());
+            execute_impl(*command.display_list, scroll_state, layer_surface);
+            return Gfx::ImmutableBitmap::create_snapshot_from_painting_surface(layer_surface);
+        });
+    }
+
+    if (!layer.has_value()) {
+        execute_impl(*command.display_list, scroll_state, {});
+        return;
+    }
+
+    // NOTE: The layer is drawn with whatever transform and opacity the enclosing stacking context currently has,
+    //       which may scale it, so use linear filtering rather than picking the nearest pixels.
+    surface().canvas().drawImage(layer->bitmap->sk_image(), layer->rect.x(), layer->rect.y(), SkSamplingOptions(SkFilterMode::kLinear));
+}
+
 bool DisplayListPlayerSkia::would_be_fully_clipped_by_painter(Gfx::IntRect rect) const
 {
     return surface().canvas().quickReject(to_skia_rect(rect));
@@ -8,6 +8,7 @@
 
 #include <LibGfx/PaintingSurface.h>
 #include <LibGfx/SkiaBackendContext.h>
+#include <LibWeb/Painting/CompositorLayerCache.h>
 #include <LibWeb/Painting/DisplayListRecorder.h>
 
 class GrDirectContext;
@@ -19,6 +20,9 @@ public:
     DisplayListPlayerSkia(RefPtr<Gfx::SkiaBackendContext>);
     DisplayListPlayerSkia();
 
+    // Without a cache, compositor layers are painted directly like any other commands.
+    void set_compositor_layer_cache(CompositorLayerCache* cache) { m_compositor_layer_cache = cache; }
+
 private:
     void flush() override;
     void draw_glyph_run(DrawGlyphRun const&) override;
@@ -59,10 +63,12 @@ private:
     void apply_filters(ApplyFilters const&) override;
     void apply_transform(ApplyTransform const&) override;
     void apply_mask_bitmap(ApplyMaskBitmap const&) override;
+    void paint_compositor_layer(PaintCompositorLayer const&, ScrollStateSnapshot const&) override;
 
     bool would_be_fully_clipped_by_painter(Gfx::IntRect) const override;
 
     RefPtr<Gfx::SkiaBackendContext> m_context;
+    CompositorLayerCache* m_compositor_layer_cache { nullptr };
 };
 
 }
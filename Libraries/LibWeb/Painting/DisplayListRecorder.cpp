@@ -446,4 +446,12 @@ void DisplayListRecorder::apply_mask_bitmap(Gfx::IntPoint origin, Gfx::Immutable
     });
 }
 
+void DisplayListRecorder::paint_compositor_layer(u64 layer_id, NonnullRefPtr<DisplayList> display_list)
+{
+    append(PaintCompositorLayer {
+        .layer_id = layer_id,
+        .display_list = move(display_list),
+    });
+}
+
 }
@@ -153,6 +153,7 @@ public:
     void apply_filters(Vector<Gfx::Filter> filter);
     void apply_transform(Gfx::FloatPoint origin, Gfx::FloatMatrix4x4);
     void apply_mask_bitmap(Gfx::IntPoint origin, Gfx::ImmutableBitmap const&, Gfx::Bitmap::MaskKind);
+    void paint_compositor_layer(u64 layer_id, NonnullRefPtr<DisplayList>);
 
     DisplayListRecorder(DisplayList&);
     ~DisplayListRecorder();
@@ -13,8 +13,22 @@ namespace Web::Painting {
 
 class ScrollStateSnapshot {
 public:
+    struct Entry {
+        CSSPixelPoint cumulative_offset;
+        CSSPixelPoint own_offset;
+    };
+
     static ScrollStateSnapshot create(Vector<NonnullRefPtr<ScrollFrame>> const& scroll_frames);
 
+    // Creates a snapshot from the offsets of each scroll frame, indexed by their id. This is for tests, which have no
+    // paintables to create scroll frames for.
+    static ScrollStateSnapshot create(Vector<Entry> entries)
+    {
+        ScrollStateSnapshot snapshot;
+        snapshot.entries = move(entries);
+        return snapshot;
+    }
+
     CSSPixelPoint cumulative_offset_for_frame_with_id(size_t id) const
     {
         if (id >= entries.size())
@@ -30,10 +44,6 @@ public:
     }
 
 private:
-    struct Entry {
-        CSSPixelPoint cumulative_offset;
-        CSSPixelPoint own_offset;
-    };
     Vector<Entry> entries;
 };
 
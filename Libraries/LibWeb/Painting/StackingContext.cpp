@@ -11,6 +11,7 @@
 #include <LibGfx/Matrix4x4.h>
 #include <LibGfx/Rect.h>
 #include <LibWeb/CSS/StyleValues/TransformationStyleValue.h>
+#include <LibWeb/DOM/Element.h>
 #include <LibWeb/Layout/Box.h>
 #include <LibWeb/Layout/ReplacedBox.h>
 #include <LibWeb/Layout/Viewport.h>
@@ -30,6 +31,27 @@ static void paint_node(Paintable const& paintable, PaintContext& context, PaintP
     paintable.after_paint(context, phase);
 }
 
+// Stacking contexts whose transform or opacity is (or is about to be) animated get painted into a layer of their own.
+static Optional<u64> compositor_layer_id_for(PaintableBox const& paintable_box)
+{
+    auto const* element = as_if<DOM::Element>(paintable_box.dom_node().ptr());
+    if (!element)
+        return {};
+
+    static constexpr Array composited_properties {
+        CSS::PropertyID::Transform,
+        CSS::PropertyID::Translate,
+        CSS::PropertyID::Rotate,
+        CSS::PropertyID::Scale,
+        CSS::PropertyID::Opacity,
+    };
+
+    auto will_change = paintable_box.computed_values().will_change();
+    if (!will_change.transform && !will_change.opacity && !element->is_animating_any_property_of(composited_properties))
+        return {};
+    return static_cast<u64>(element->unique_id().value());
+}
+
 StackingContext::StackingContext(PaintableBox& paintable, StackingContext* parent, size_t index_in_tree_order)
     : m_paintable(paintable)
     , m_parent(parent)
@@ -371,7 +393,18 @@ void StackingContext::paint(PaintContext& context) const
         }
     }
 
-    paint_internal(context);
+    if (auto layer_id = compositor_layer_id_for(paintable_box()); layer_id.has_value()) {
+        // NOTE: The stacking context's transform and opacity were applied above, outside of the layer, so the layer's
+        //       content stays the same while they animate, and can be reused by the rendering thread.
+        auto layer_display_list = DisplayList::create();
+        layer_display_list->set_device_pixels_per_css_pixel(context.device_pixels_per_css_pixel());
+        DisplayListRecorder layer_recorder(*layer_display_list);
+        auto layer_context = context.clone(layer_recorder);
+        paint_internal(layer_context);
+        context.display_list_recorder().paint_compositor_layer(*layer_id, move(layer_display_list));
+    } else {
+        paint_internal(context);
+    }
 
     if (!filter.is_empty()) {
         context.display_list_recorder().restore();
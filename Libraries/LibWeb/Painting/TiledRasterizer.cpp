@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <AK/Debug.h>
+#include <LibCore/ElapsedTimer.h>
+#include <LibCore/System.h>
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/PaintingSurface.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
+#include <LibWeb/Painting/DisplayListPlayerSkia.h>
+#include <LibWeb/Painting/TiledRasterizer.h>
+
+namespace Web::Painting {
+
+static size_t raster_thread_count()
+{
+    static size_t const thread_count = clamp(Core::System::hardware_concurrency(), 1u, 16u);
+    return thread_count;
+}
+
+static Threading::ThreadPool& raster_thread_pool()
+{
+    static auto thread_pool = make<Threading::ThreadPool>(raster_thread_count(), "Rasterizer"sv);
+    return *thread_pool;
+}
+
+static Atomic<Threading::ThreadPool::ClientID> s_next_client_id { 1 };
+
+TiledRasterizer::TiledRasterizer()
+    : m_client_id(s_next_client_id++)
+{
+}
+
+static bool draws_painting_surfaces(DisplayList const& display_list)
+{
+    for (auto const& item : display_list.commands()) {
+        if (item.command.has<DrawPaintingSurface>())
+            return true;
+        if (auto const* nested = item.command.get_pointer<PaintNestedDisplayList>(); nested && nested->display_list && draws_painting_surfaces(*nested->display_list))
+            return true;
+        if (auto const* layer = item.command.get_pointer<PaintCompositorLayer>(); layer && draws_painting_surfaces(*layer->display_list))
+            return true;
+    }
+    return false;
+}
+
+bool TiledRasterizer::can_rasterize(DisplayList const& display_list, Gfx::IntRect const& rect)
+{
+    if (raster_thread_count() < 2)
+        return false;
+    if (rect.width() <= tile_size && rect.height() <= tile_size)
+        return false;
+    if (rect.size().area() < minimum_area_for_tiling)
+        return false;
+    return !draws_painting_surfaces(display_list);
+}
+
+void TiledRasterizer::rasterize(DisplayList& display_list, ScrollStateSnapshot const& scroll_state, Gfx::Bitmap& bitmap, Gfx::IntRect const& rect, CompositorLayerCache* compositor_layer_cache)
+{
+    auto paint_rect = rect.intersected(bitmap.rect());
+    if (paint_rect.is_empty())
+        return;
+
+    auto timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+
+    Vector<Gfx::IntRect> tiles;
+    for (int y = paint_rect.top() / tile_size * tile_size; y < paint_rect.bottom(); y += tile_size) {
+        for (int x = paint_rect.left() / tile_size * tile_size; x < paint_rect.right(); x += tile_size)
+            tiles.append(Gfx::IntRect { x, y, tile_size, tile_size }.intersected(paint_rect));
+    }
+
+    Threading::Mutex mutex;
+    Threading::ConditionVariable all_tiles_painted { mutex };
+    size_t remaining_tile_count = tiles.size();
+
+    for (auto const& tile : tiles) {
+        raster_thread_pool().submit(m_client_id, Threading::ThreadPool::Priority::High, [&, tile] {
+            // NOTE: Every tile gets its own player and surface, since those keep state while playing back. The
+            //       surfaces all wrap the same pixels, but the tiles don't overlap, so neither do the writes.
+            DisplayListPlayerSkia player;
+            player.set_compositor_layer_cache(compositor_layer_cache);
+            player.execute(display_list, scroll_state, Gfx::PaintingSurface::wrap_bitmap(bitmap), tile);
+
+            Threading::MutexLocker const locker { mutex };
+            if (--remaining_tile_count == 0)
+                all_tiles_painted.signal();
+        });
+    }
+
+    Threading::MutexLocker const locker { mutex };
+    while (remaining_tile_count > 0)
+        all_tiles_painted.wait();
+
+    dbgln_if(TILED_RASTERIZER_DEBUG, "Painted {} in {} tiles on {} threads in {}ms", paint_rect, tiles.size(), raster_thread_count(), timer.elapsed_milliseconds());
+}
+
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Noncopyable.h>
+#include <LibGfx/Forward.h>
+#include <LibGfx/Rect.h>
+#include <LibThreading/ThreadPool.h>
+#include <LibWeb/Painting/CompositorLayerCache.h>
+#include <LibWeb/Painting/DisplayList.h>
+#include <LibWeb/Painting/ScrollState.h>
+
+namespace Web::Painting {
+
+// Rasterizes display lists into bitmaps by splitting them up into a grid of tiles, and painting the tiles in parallel
+// on a pool of worker threads shared by the whole process. Every tile plays back the whole display list, clipped to
+// the tile, which makes the player cull all the commands that don't touch it.
+//
+// The grid is fixed relative to the bitmap, so only the tiles touching the rect being painted are repainted, and all
+// other tiles keep whatever was painted into them before.
+class TiledRasterizer {
+    AK_MAKE_NONCOPYABLE(TiledRasterizer);
+    AK_MAKE_NONMOVABLE(TiledRasterizer);
+
+public:
+    static constexpr int tile_size = 512;
+
+    // Painting fewer pixels than this isn't worth the cost of handing the work to other threads.
+    static constexpr int minimum_area_for_tiling = 2 * tile_size * tile_size;
+
+    TiledRasterizer();
+
+    // NOTE: Display lists can only be played back from multiple threads at once if they don't draw painting surfaces
+    //       (i.e. canvases), as taking a snapshot of those is not thread safe.
+    static bool can_rasterize(DisplayList const&, Gfx::IntRect const&);
+
+    // Paints the part of the bitmap covered by the given rect, and returns once all of its tiles are done.
+    void rasterize(DisplayList&, ScrollStateSnapshot const&, Gfx::Bitmap&, Gfx::IntRect const&, CompositorLayerCache* = nullptr);
+
+private:
+    Threading::ThreadPool::ClientID m_client_id { 0 };
+};
+
+}
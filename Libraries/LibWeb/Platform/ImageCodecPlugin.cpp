@@ -11,6 +11,8 @@ namespace Web::Platform {
 
 static ImageCodecPlugin* s_the;
 
+StreamedFrames::~StreamedFrames() = default;
+
 ImageCodecPlugin::~ImageCodecPlugin() = default;
 
 ImageCodecPlugin& ImageCodecPlugin::the()
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <AK/Function.h>
+#include <AK/RefCounted.h>
 #include <AK/RefPtr.h>
 #include <AK/Vector.h>
 #include <LibCore/Promise.h>
@@ -20,10 +22,29 @@ struct Frame {
     size_t duration { 0 };
 };
 
+// The frames of an animated image that is too large to be decoded up front. The decoder holds on to the image, and
+// decodes frames when they are requested.
+class StreamedFrames : public RefCounted<StreamedFrames> {
+public:
+    virtual ~StreamedFrames();
+
+    // Decodes `count` frames starting at `first_frame_index`, wrapping around to the first frame.
+    virtual void request_frames(size_t first_frame_index, size_t count) = 0;
+
+    Function<void(size_t first_frame_index, Vector<RefPtr<Gfx::Bitmap>>)> on_frames_decoded;
+
+    // Invoked instead of on_frames_decoded if the requested frames will not arrive, e.g. because the decoder went away.
+    Function<void()> on_error;
+};
+
 struct DecodedImage {
     bool is_animated { false };
     u32 loop_count { 0 };
+
+    // NOTE: For streamed images, only the first frame has a bitmap.
     Vector<Frame> frames;
+    RefPtr<StreamedFrames> streamed_frames;
+
     Gfx::ColorSpace color_space;
 };
 
@@ -45,6 +45,8 @@ ErrorOr<NonnullOwnPtr<CookieJar>> CookieJar::create(Database& database)
     statements.insert_cookie = TRY(database.prepare_statement("INSERT OR REPLACE INTO Cookies VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);"sv));
     statements.expire_cookie = TRY(database.prepare_statement("DELETE FROM Cookies WHERE (expiry_time < ?);"sv));
     statements.select_all_cookies = TRY(database.prepare_statement("SELECT * FROM Cookies;"sv));
+    statements.begin_transaction = TRY(database.prepare_statement("BEGIN TRANSACTION;"sv));
+    statements.commit_transaction = TRY(database.prepare_statement("COMMIT;"sv));
 
     return adopt_own(*new CookieJar { PersistedStorage { database, statements } });
 }
@@ -67,11 +69,19 @@ CookieJar::CookieJar(Optional<PersistedStorage> persisted_storage)
     m_persisted_storage->synchronization_timer = Core::Timer::create_repeating(
         static_cast<int>(DATABASE_SYNCHRONIZATION_TIMER.to_milliseconds()),
         [this]() {
+            auto& database = m_persisted_storage->database;
+            auto const& statements = m_persisted_storage->statements;
+
+            // NOTE: Write all changes in a single transaction, rather than having SQLite commit each cookie separately.
+            database.execute_statement(statements.begin_transaction, {});
+
             for (auto const& it : m_transient_storage.take_dirty_cookies())
                 m_persisted_storage->insert_cookie(it.value);
 
             auto now = m_transient_storage.purge_expired_cookies();
-            m_persisted_storage->database.execute_statement(m_persisted_storage->statements.expire_cookie, {}, now);
+            database.execute_statement(statements.expire_cookie, {}, now);
+
+            database.execute_statement(statements.commit_transaction, {});
         });
     m_persisted_storage->synchronization_timer->start();
 }
@@ -535,10 +545,12 @@ Vector<Web::Cookie::Cookie> CookieJar::get_matching_cookies(const URL::URL& url,
 {
     auto now = UnixDateTime::now();
 
+    auto request_path = url.serialize_path();
+
     // 1. Let cookie-list be the set of cookies from the cookie store that meets all of the following requirements:
     Vector<Web::Cookie::Cookie> cookie_list;
 
-    m_transient_storage.for_each_cookie([&](Web::Cookie::Cookie& cookie) {
+    m_transient_storage.for_each_cookie_for_host(canonicalized_domain, [&](Web::Cookie::Cookie& cookie) {
         // * Either:
         //     The cookie's host-only-flag is true and the canonicalized host of the retrieval's URI is identical to
         //     the cookie's domain.
@@ -552,7 +564,7 @@ Vector<Web::Cookie::Cookie> CookieJar::get_matching_cookies(const URL::URL& url,
             return;
 
         // * The retrieval's URI's path path-matches the cookie's path.
-        if (!path_matches(url.serialize_path(), cookie.path))
+        if (!path_matches(request_path, cookie.path))
             return;
 
         // * If the cookie's secure-only-flag is true, then the retrieval's URI must denote a "secure" connection (as
@@ -612,13 +624,31 @@ Vector<Web::Cookie::Cookie> CookieJar::get_matching_cookies(const URL::URL& url,
 void CookieJar::TransientStorage::set_cookies(Cookies cookies)
 {
     m_cookies = move(cookies);
+    m_keys_by_domain.clear();
+    m_expiry_queue.clear();
+
+    for (auto const& [key, cookie] : m_cookies)
+        add_to_indices(key, cookie.expiry_time);
+
     purge_expired_cookies();
 }
 
 void CookieJar::TransientStorage::set_cookie(CookieStorageKey key, Web::Cookie::Cookie cookie)
 {
-    m_cookies.set(key, cookie);
+    if (auto old_cookie = m_cookies.find(key); old_cookie != m_cookies.end()) {
+        if (old_cookie->value.expiry_time != cookie.expiry_time)
+            m_expiry_queue.insert({ cookie.expiry_time, key });
+        old_cookie->value = cookie;
+    } else {
+        m_cookies.set(key, cookie);
+        add_to_indices(key, cookie.expiry_time);
+    }
+
     m_dirty_cookies.set(move(key), move(cookie));
+
+    // Don't let outdated expiry queue entries pile up if the same cookies keep being updated.
+    if (m_expiry_queue.size() > 2 * m_cookies.size() + 64)
+        rebuild_expiry_queue();
 }
 
 Optional<Web::Cookie::Cookie const&> CookieJar::TransientStorage::get_cookie(CookieStorageKey const& key)
@@ -636,8 +666,17 @@ UnixDateTime CookieJar::TransientStorage::purge_expired_cookies(Optional<AK::Dur
             cookie.value.expiry_time -= *offset;
     }
 
-    auto is_expired = [&](auto const&, auto const& cookie) { return cookie.expiry_time < now; };
-    m_cookies.remove_all_matching(is_expired);
+    while (!m_expiry_queue.is_empty() && m_expiry_queue.peek_min().expiry_time < now) {
+        auto entry = m_expiry_queue.pop_min();
+
+        // NOTE: The cookie may have been removed or given a new expiry time since this entry was queued.
+        auto cookie = m_cookies.find(entry.key);
+        if (cookie == m_cookies.end() || cookie->value.expiry_time != entry.expiry_time)
+            continue;
+
+        m_cookies.remove(cookie);
+        remove_from_indices(entry.key);
+    }
 
     return now;
 }
@@ -646,10 +685,36 @@ void CookieJar::TransientStorage::expire_and_purge_all_cookies()
 {
     for (auto& [key, value] : m_cookies) {
         value.expiry_time = UnixDateTime::earliest();
-        set_cookie(key, value);
+        m_dirty_cookies.set(key, move(value));
     }
 
-    purge_expired_cookies();
+    m_cookies.clear();
+    m_keys_by_domain.clear();
+    m_expiry_queue.clear();
+}
+
+void CookieJar::TransientStorage::add_to_indices(CookieStorageKey const& key, UnixDateTime expiry_time)
+{
+    m_keys_by_domain.ensure(key.domain).append(key);
+    m_expiry_queue.insert({ expiry_time, key });
+}
+
+void CookieJar::TransientStorage::remove_from_indices(CookieStorageKey const& key)
+{
+    auto keys = m_keys_by_domain.find(key.domain);
+    VERIFY(keys != m_keys_by_domain.end());
+
+    keys->value.remove_first_matching([&](auto const& other) { return other == key; });
+    if (keys->value.is_empty())
+        m_keys_by_domain.remove(keys);
+}
+
+void CookieJar::TransientStorage::rebuild_expiry_queue()
+{
+    m_expiry_queue.clear();
+
+    for (auto const& [key, cookie] : m_cookies)
+        m_expiry_queue.insert({ cookie.expiry_time, key });
 }
 
 void CookieJar::PersistedStorage::insert_cookie(Web::Cookie::Cookie const& cookie)
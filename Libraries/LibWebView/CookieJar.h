@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/BinaryHeap.h>
 #include <AK/Function.h>
 #include <AK/HashMap.h>
 #include <AK/Optional.h>
@@ -35,6 +36,8 @@ class CookieJar {
         Database::StatementID insert_cookie { 0 };
         Database::StatementID expire_cookie { 0 };
         Database::StatementID select_all_cookies { 0 };
+        Database::StatementID begin_transaction { 0 };
+        Database::StatementID commit_transaction { 0 };
     };
 
     class TransientStorage {
@@ -68,9 +71,52 @@ class CookieJar {
             }
         }
 
+        // Invokes the callback for each cookie whose domain is the given host or one of its parent domains. These are
+        // the only cookies that may match a request to that host.
+        template<typename Callback>
+        void for_each_cookie_for_host(StringView host, Callback callback)
+        {
+            auto for_each_cookie_in_domain = [&](StringView domain) {
+                auto keys = m_keys_by_domain.find(domain);
+                if (keys == m_keys_by_domain.end())
+                    return;
+
+                for (auto const& key : keys->value)
+                    callback(m_cookies.find(key)->value);
+            };
+
+            for_each_cookie_in_domain(host);
+
+            for (size_t i = 0; i < host.length(); ++i) {
+                if (host[i] == '.')
+                    for_each_cookie_in_domain(host.substring_view(i + 1));
+            }
+        }
+
     private:
+        void add_to_indices(CookieStorageKey const&, UnixDateTime expiry_time);
+        void remove_from_indices(CookieStorageKey const&);
+        void rebuild_expiry_queue();
+
         Cookies m_cookies;
         Cookies m_dirty_cookies;
+
+        // Keys of all cookies, grouped by the cookie's domain.
+        HashMap<String, Vector<CookieStorageKey>> m_keys_by_domain;
+
+        // A min-heap of cookie keys by expiry time. Updating a cookie's expiry time leaves its old entry behind, which
+        // is ignored once it reaches the top of the heap.
+        struct ExpiryQueueEntry {
+            UnixDateTime expiry_time;
+            CookieStorageKey key;
+        };
+        struct ExpiryQueueComparator {
+            bool operator()(ExpiryQueueEntry const& a, ExpiryQueueEntry const& b) const { return a.expiry_time < b.expiry_time; }
+        };
+        struct ExpiryQueueIndexSetter {
+            void operator()(ExpiryQueueEntry&, size_t) const { }
+        };
+        IntrusiveBinaryHeap<ExpiryQueueEntry, ExpiryQueueComparator, ExpiryQueueIndexSetter> m_expiry_queue;
     };
 
     struct PersistedStorage {
@@ -13,6 +13,38 @@
 
 namespace WebView {
 
+class StreamedFramesFromImageDecoder final : public Web::Platform::StreamedFrames {
+public:
+    StreamedFramesFromImageDecoder(NonnullRefPtr<ImageDecoderClient::Client> client, i64 image_id)
+        : m_client(move(client))
+        , m_image_id(image_id)
+    {
+    }
+
+    virtual ~StreamedFramesFromImageDecoder() override
+    {
+        m_client->release_streamed_image(m_image_id);
+    }
+
+    virtual void request_frames(size_t first_frame_index, size_t count) override
+    {
+        m_client->request_streamed_frames(
+            m_image_id, first_frame_index, count,
+            [this](size_t first_frame_index, Vector<RefPtr<Gfx::Bitmap>> bitmaps) {
+                if (on_frames_decoded)
+                    on_frames_decoded(first_frame_index, move(bitmaps));
+            },
+            [this] {
+                if (on_error)
+                    on_error();
+            });
+    }
+
+private:
+    NonnullRefPtr<ImageDecoderClient::Client> m_client;
+    i64 m_image_id { 0 };
+};
+
 ImageCodecPlugin::ImageCodecPlugin(NonnullRefPtr<ImageDecoderClient::Client> client)
     : m_client(move(client))
 {
@@ -46,7 +78,7 @@ NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::deco
 
     auto image_decoder_promise = m_client->decode_image(
         bytes,
-        [promise](ImageDecoderClient::DecodedImage& result) -> ErrorOr<void> {
+        [promise, client = NonnullRefPtr(*m_client)](ImageDecoderClient::DecodedImage& result) -> ErrorOr<void> {
             // FIXME: Remove this codec plugin and just use the ImageDecoderClient directly to avoid these copies
             Web::Platform::DecodedImage decoded_image;
             decoded_image.is_animated = result.is_animated;
@@ -54,6 +86,8 @@ NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::deco
             for (auto& frame : result.frames) {
                 decoded_image.frames.empend(move(frame.bitmap), frame.duration);
             }
+            if (result.streamed_image_id.has_value())
+                decoded_image.streamed_frames = adopt_ref(*new StreamedFramesFromImageDecoder(client, *result.streamed_image_id));
             decoded_image.color_space = move(result.color_space);
             promise->resolve(move(decoded_image));
             return {};
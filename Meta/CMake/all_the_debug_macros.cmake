@@ -4,11 +4,13 @@ set(BMP_DEBUG ON)
 set(CACHE_DEBUG ON)
 set(CALLBACK_MACHINE_DEBUG ON)
 set(CANVAS_RENDERING_CONTEXT_2D_DEBUG ON)
+set(COMPOSITOR_LAYER_DEBUG ON)
 set(CRYPTO_DEBUG ON)
 set(CSS_LOADER_DEBUG ON)
 set(CSS_PARSER_DEBUG ON)
 set(CSS_TOKENIZER_DEBUG ON)
 set(CSS_TRANSITIONS_DEBUG ON)
+set(DAMAGE_TRACKING_DEBUG ON)
 set(DEVTOOLS_DEBUG ON)
 set(DNS_DEBUG ON)
 set(EDITOR_DEBUG ON)
@@ -58,6 +60,7 @@ set(STYLE_INVALIDATION_DEBUG ON)
 set(SYNTAX_HIGHLIGHTING_DEBUG ON)
 set(TEXTEDITOR_DEBUG ON)
 set(TIFF_DEBUG ON)
+set(TILED_RASTERIZER_DEBUG ON)
 set(TIME_ZONE_DEBUG ON)
 set(TLS_DEBUG ON)
 set(TOKENIZER_TRACE_DEBUG ON)
@@ -6,17 +6,68 @@
 
 #include <AK/Debug.h>
 #include <AK/IDAllocator.h>
+#include <AK/QuickSort.h>
 #include <ImageDecoder/ConnectionFromClient.h>
 #include <ImageDecoder/ImageDecoderClientEndpoint.h>
+#include <LibCore/System.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/ImageFormats/ImageDecoder.h>
 #include <LibGfx/ImageFormats/TIFFMetadata.h>
+#include <LibThreading/ThreadPool.h>
 
 namespace ImageDecoder {
 
 static HashMap<int, RefPtr<ConnectionFromClient>> s_connections;
 static IDAllocator s_client_ids;
 
+static size_t s_decode_thread_count = 0;
+
+static Threading::ThreadPool& decode_thread_pool()
+{
+    static OwnPtr<Threading::ThreadPool> thread_pool;
+    if (!thread_pool) {
+        if (s_decode_thread_count == 0)
+            s_decode_thread_count = clamp(Core::System::hardware_concurrency(), 1u, 8u);
+        thread_pool = make<Threading::ThreadPool>(s_decode_thread_count, "ImageDecoder"sv);
+    }
+    return *thread_pool;
+}
+
+void ConnectionFromClient::set_decode_thread_count(size_t thread_count)
+{
+    s_decode_thread_count = thread_count;
+}
+
+// Latencies of the most recent decodes, from the request arriving until the result is sent back.
+static constexpr size_t max_decode_latency_samples = 256;
+static Vector<AK::Duration> s_decode_latencies;
+static size_t s_next_decode_latency_index = 0;
+static u64 s_decode_count = 0;
+
+static void record_decode_latency([[maybe_unused]] AK::Duration latency)
+{
+    if constexpr (IMAGE_DECODER_DEBUG) {
+        if (s_decode_latencies.size() < max_decode_latency_samples)
+            s_decode_latencies.append(latency);
+        else
+            s_decode_latencies[s_next_decode_latency_index] = latency;
+        s_next_decode_latency_index = (s_next_decode_latency_index + 1) % max_decode_latency_samples;
+
+        if (++s_decode_count % 32 != 0)
+            return;
+
+        auto sorted_latencies = s_decode_latencies;
+        quick_sort(sorted_latencies);
+        auto percentile = [&](size_t percent) {
+            return sorted_latencies[min(sorted_latencies.size() - 1, sorted_latencies.size() * percent / 100)].to_milliseconds();
+        };
+
+        auto& thread_pool = decode_thread_pool();
+        dbgln("ImageDecoder: {} decodes, latency p50={}ms p90={}ms p99={}ms, {} jobs queued, {} running",
+            s_decode_count, percentile(50), percentile(90), percentile(99), thread_pool.queued_job_count(), thread_pool.running_job_count());
+    }
+}
+
 ConnectionFromClient::ConnectionFromClient(NonnullOwnPtr<IPC::Transport> transport)
     : IPC::ConnectionFromClient<ImageDecoderClientEndpoint, ImageDecoderServerEndpoint>(*this, move(transport), s_client_ids.allocate())
 {
@@ -25,10 +76,13 @@ ConnectionFromClient::ConnectionFromClient(NonnullOwnPtr<IPC::Transport> transpo
 
 void ConnectionFromClient::die()
 {
-    for (auto& [_, job] : m_pending_jobs) {
+    // NOTE: Canceling a job that is still queued on the thread pool finishes it right away, which removes it from
+    //       m_pending_jobs, so we must not be iterating over that map while doing so.
+    auto pending_jobs = move(m_pending_jobs);
+    for (auto& [_, job] : pending_jobs) {
         job->cancel();
     }
-    m_pending_jobs.clear();
+    m_streamed_images.clear();
 
     auto client_id = this->client_id();
     s_connections.remove(client_id);
@@ -99,6 +153,26 @@ static void decode_image_to_bitmaps_and_durations_with_decoder(Gfx::ImageDecoder
     }
 }
 
+// NOTE: Frame durations are only known once a frame has been decoded, so we still go through every frame here. Only the
+//       first one is kept though, which bounds the memory use to that of a single frame.
+static void decode_first_frame_and_durations_with_decoder(Gfx::ImageDecoder const& decoder, Optional<Gfx::IntSize> ideal_size, Vector<RefPtr<Gfx::Bitmap>>& bitmaps, Vector<u32>& durations)
+{
+    for (size_t i = 0; i < decoder.frame_count(); ++i) {
+        auto frame_or_error = decoder.frame(i, ideal_size);
+        if (frame_or_error.is_error()) {
+            if (i == 0)
+                bitmaps.append({});
+            durations.append(0);
+            continue;
+        }
+
+        auto frame = frame_or_error.release_value();
+        if (i == 0)
+            bitmaps.append(frame.image.release_nonnull());
+        durations.append(frame.duration);
+    }
+}
+
 static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core::AnonymousBuffer const& encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> const& known_mime_type)
 {
     auto decoder = TRY(Gfx::ImageDecoder::try_create_for_raw_bytes(ReadonlyBytes { encoded_buffer.data<u8>(), encoded_buffer.size() }, known_mime_type));
@@ -132,9 +206,16 @@ static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core:
         }
     }
 
-    decode_image_to_bitmaps_and_durations_with_decoder(*decoder, move(ideal_size), bitmaps, result.durations);
+    auto decoded_size = ideal_size.value_or(decoder->size());
+    auto decoded_frame_byte_size = static_cast<size_t>(decoded_size.width()) * decoded_size.height() * sizeof(Gfx::ARGB32);
+    if (result.is_animated && decoder->frame_count() > 1 && decoder->frame_count() * decoded_frame_byte_size > ConnectionFromClient::streamed_image_threshold) {
+        decode_first_frame_and_durations_with_decoder(*decoder, ideal_size, bitmaps, result.durations);
+        result.streamed_image = adopt_ref(*new ConnectionFromClient::StreamedImage(encoded_buffer, decoder.release_nonnull(), ideal_size));
+    } else {
+        decode_image_to_bitmaps_and_durations_with_decoder(*decoder, move(ideal_size), bitmaps, result.durations);
+    }
 
-    if (bitmaps.is_empty())
+    if (bitmaps.is_empty() || !bitmaps.first())
         return Error::from_string_literal("Could not decode image");
 
     result.bitmaps = Gfx::BitmapSequence { move(bitmaps) };
@@ -144,13 +225,20 @@ static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core:
 
 NonnullRefPtr<ConnectionFromClient::Job> ConnectionFromClient::make_decode_image_job(i64 image_id, Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type)
 {
+    auto request_time = MonotonicTime::now();
+
     return Job::construct(
+        decode_thread_pool(), client_id(), Threading::ThreadPool::Priority::Normal,
         [encoded_buffer = move(encoded_buffer), ideal_size = move(ideal_size), mime_type = move(mime_type)](auto&) -> ErrorOr<DecodeResult> {
             return TRY(decode_image_to_details(encoded_buffer, ideal_size, mime_type));
         },
-        [strong_this = NonnullRefPtr(*this), image_id](DecodeResult result) -> ErrorOr<void> {
-            strong_this->async_did_decode_image(image_id, result.is_animated, result.loop_count, move(result.bitmaps), move(result.durations), result.scale, move(result.color_profile));
+        [strong_this = NonnullRefPtr(*this), image_id, request_time](DecodeResult result) -> ErrorOr<void> {
+            bool is_streamed = result.streamed_image;
+            if (is_streamed)
+                strong_this->m_streamed_images.set(image_id, result.streamed_image.release_nonnull());
+            strong_this->async_did_decode_image(image_id, result.is_animated, result.loop_count, move(result.bitmaps), move(result.durations), result.scale, move(result.color_profile), is_streamed);
             strong_this->m_pending_jobs.remove(image_id);
+            record_decode_latency(MonotonicTime::now() - request_time);
             return {};
         },
         [strong_this = NonnullRefPtr(*this), image_id](Error error) -> void {
@@ -182,4 +270,48 @@ void ConnectionFromClient::cancel_decoding(i64 image_id)
     }
 }
 
+void ConnectionFromClient::request_streamed_frames(i64 image_id, u32 first_frame_index, u32 count)
+{
+    auto streamed_image = m_streamed_images.get(image_id);
+    if (!streamed_image.has_value()) {
+        dbgln_if(IMAGE_DECODER_DEBUG, "No streamed image with ID {}", image_id);
+        async_did_fail_to_decode_streamed_frames(image_id, "No such streamed image"_string);
+        return;
+    }
+
+    // NOTE: The job is not tracked; if the image is released while it runs, its result is simply dropped.
+    // NOTE: Frames are requested for animations that are currently playing, so these go ahead of regular decodes.
+    (void)StreamedFramesJob::construct(
+        decode_thread_pool(), client_id(), Threading::ThreadPool::Priority::High,
+        [streamed_image = NonnullRefPtr(*streamed_image.value()), first_frame_index, count](auto&) -> ErrorOr<Gfx::BitmapSequence> {
+            Threading::MutexLocker locker(streamed_image->decoder_mutex);
+            auto const& decoder = *streamed_image->decoder;
+            auto frame_count = decoder.frame_count();
+
+            Vector<RefPtr<Gfx::Bitmap>> bitmaps;
+            for (size_t i = 0; i < min<size_t>(count, frame_count); ++i) {
+                auto frame_or_error = decoder.frame((first_frame_index + i) % frame_count, streamed_image->ideal_size);
+                if (frame_or_error.is_error())
+                    bitmaps.append({});
+                else
+                    bitmaps.append(frame_or_error.release_value().image);
+            }
+            return Gfx::BitmapSequence { move(bitmaps) };
+        },
+        [strong_this = NonnullRefPtr(*this), image_id, first_frame_index](Gfx::BitmapSequence bitmaps) -> ErrorOr<void> {
+            if (strong_this->is_open() && strong_this->m_streamed_images.contains(image_id))
+                strong_this->async_did_decode_streamed_frames(image_id, first_frame_index, move(bitmaps));
+            return {};
+        },
+        [strong_this = NonnullRefPtr(*this), image_id](Error error) -> void {
+            if (strong_this->is_open() && strong_this->m_streamed_images.contains(image_id))
+                strong_this->async_did_fail_to_decode_streamed_frames(image_id, MUST(String::formatted("Decoding failed: {}", error)));
+        });
+}
+
+void ConnectionFromClient::release_streamed_image(i64 image_id)
+{
+    m_streamed_images.remove(image_id);
+}
+
 }
@@ -6,14 +6,17 @@
 
 #pragma once
 
+#include <AK/AtomicRefCounted.h>
 #include <AK/HashMap.h>
 #include <ImageDecoder/Forward.h>
 #include <ImageDecoder/ImageDecoderClientEndpoint.h>
 #include <ImageDecoder/ImageDecoderServerEndpoint.h>
 #include <LibGfx/BitmapSequence.h>
 #include <LibGfx/ColorSpace.h>
+#include <LibGfx/ImageFormats/ImageDecoder.h>
 #include <LibIPC/ConnectionFromClient.h>
 #include <LibThreading/BackgroundAction.h>
+#include <LibThreading/Mutex.h>
 
 namespace ImageDecoder {
 
@@ -26,6 +29,30 @@ public:
 
     virtual void die() override;
 
+    // Animated images whose frames would take up more than this much memory once decoded are streamed: only the first
+    // frame is sent with the decode result, and the client requests the others as playback reaches them.
+    static constexpr size_t streamed_image_threshold = 64 * MiB;
+
+    // Decoding happens on a pool of this many threads, shared by all clients.
+    static void set_decode_thread_count(size_t);
+
+    // The decoder for a streamed image, kept alive along with the encoded data it reads from.
+    struct StreamedImage : public AtomicRefCounted<StreamedImage> {
+        StreamedImage(Core::AnonymousBuffer encoded_buffer, NonnullRefPtr<Gfx::ImageDecoder> decoder, Optional<Gfx::IntSize> ideal_size)
+            : encoded_buffer(move(encoded_buffer))
+            , decoder(move(decoder))
+            , ideal_size(ideal_size)
+        {
+        }
+
+        Core::AnonymousBuffer encoded_buffer;
+        NonnullRefPtr<Gfx::ImageDecoder> decoder;
+        Optional<Gfx::IntSize> ideal_size;
+
+        // NOTE: Decoders are not thread-safe, and frame requests for the same image may run on different threads.
+        Threading::Mutex decoder_mutex;
+    };
+
     struct DecodeResult {
         bool is_animated = false;
         u32 loop_count = 0;
@@ -33,15 +60,19 @@ public:
         Gfx::BitmapSequence bitmaps;
         Vector<u32> durations;
         Gfx::ColorSpace color_profile;
+        RefPtr<StreamedImage> streamed_image;
     };
 
 private:
     using Job = Threading::BackgroundAction<DecodeResult>;
+    using StreamedFramesJob = Threading::BackgroundAction<Gfx::BitmapSequence>;
 
     explicit ConnectionFromClient(NonnullOwnPtr<IPC::Transport>);
 
     virtual Messages::ImageDecoderServer::DecodeImageResponse decode_image(Core::AnonymousBuffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type) override;
     virtual void cancel_decoding(i64 image_id) override;
+    virtual void request_streamed_frames(i64 image_id, u32 first_frame_index, u32 count) override;
+    virtual void release_streamed_image(i64 image_id) override;
     virtual Messages::ImageDecoderServer::ConnectNewClientsResponse connect_new_clients(size_t count) override;
     virtual Messages::ImageDecoderServer::InitTransportResponse init_transport(int peer_pid) override;
 
@@ -51,6 +82,7 @@ private:
 
     i64 m_next_image_id { 0 };
     HashMap<i64, NonnullRefPtr<Job>> m_pending_jobs;
+    HashMap<i64, NonnullRefPtr<StreamedImage>> m_streamed_images;
 };
 
 }
@@ -24,11 +24,16 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     Core::ArgsParser args_parser;
     StringView mach_server_name;
     bool wait_for_debugger = false;
+    size_t decode_thread_count = 0;
 
     args_parser.add_option(mach_server_name, "Mach server name", "mach-server-name", 0, "mach_server_name");
     args_parser.add_option(wait_for_debugger, "Wait for debugger", "wait-for-debugger");
+    args_parser.add_option(decode_thread_count, "Number of threads to decode images on (default: based on CPU count)", "decode-threads", 0, "count");
     args_parser.parse(arguments);
 
+    if (decode_thread_count > 0)
+        ImageDecoder::ConnectionFromClient::set_decode_thread_count(decode_thread_count);
+
     if (wait_for_debugger)
         Core::Process::wait_for_debugger_and_break();
 
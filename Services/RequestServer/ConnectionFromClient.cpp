@@ -21,6 +21,7 @@
 #include <LibWebSocket/ConnectionInfo.h>
 #include <LibWebSocket/Message.h>
 #include <RequestServer/ConnectionFromClient.h>
+#include <RequestServer/DiskCache.h>
 #include <RequestServer/RequestClientEndpoint.h>
 #ifdef AK_OS_WINDOWS
 // needed because curl.h includes winsock2.h
@@ -31,6 +32,7 @@
 namespace RequestServer {
 
 ByteString g_default_certificate_path;
+bool g_disk_cache_enabled = false;
 static HashMap<int, RefPtr<ConnectionFromClient>> s_connections;
 static IDAllocator s_client_ids;
 static long s_connect_timeout_seconds = 90L;
@@ -41,6 +43,26 @@ static struct {
     bool use_dns_over_tls = true;
 } g_dns_info;
 
+static DiskCache* disk_cache()
+{
+    static OwnPtr<DiskCache> s_disk_cache;
+    static bool s_did_attempt_to_create_disk_cache = false;
+
+    if (!g_disk_cache_enabled)
+        return nullptr;
+
+    if (!s_did_attempt_to_create_disk_cache) {
+        s_did_attempt_to_create_disk_cache = true;
+
+        if (auto disk_cache = DiskCache::create(); disk_cache.is_error())
+            dbgln("Unable to create HTTP disk cache: {}", disk_cache.error());
+        else
+            s_disk_cache = disk_cache.release_value();
+    }
+
+    return s_disk_cache.ptr();
+}
+
 static WeakPtr<Resolver> s_resolver {};
 static NonnullRefPtr<Resolver> default_resolver()
 {
@@ -114,6 +136,10 @@ struct ConnectionFromClient::ActiveRequest {
     String url;
     Optional<String> reason_phrase;
     ByteBuffer body;
+    long http_status_code { 0 };
+    Optional<DiskCache::ResponseToStore> disk_cache_response;
+    ByteBuffer disk_cache_body;
+    Optional<DiskCache::CachedResponse> stale_response;
 
     ActiveRequest(ConnectionFromClient& client, CURLM* multi, CURL* easy, i32 request_id, int writer_fd)
         : multi(multi)
@@ -142,10 +168,50 @@ struct ConnectionFromClient::ActiveRequest {
         if (got_all_headers)
             return;
         got_all_headers = true;
-        long http_status_code = 0;
         auto result = curl_easy_getinfo(easy, CURLINFO_RESPONSE_CODE, &http_status_code);
         VERIFY(result == CURLE_OK);
+
+        if (stale_response.has_value()) {
+            auto const& response = *disk_cache_response;
+
+            if (disk_cache()->revalidate_entry(*stale_response, response.url, response.partition_key, http_status_code, headers, response.request_time, UnixDateTime::now())) {
+                // NOTE: The stored body is sent to the client once this (empty) response has been received in full.
+                disk_cache_response.clear();
+                client->async_headers_became_available(request_id, stale_response->headers, stale_response->status_code, stale_response->reason_phrase);
+                return;
+            }
+
+            stale_response.clear();
+        }
+
         client->async_headers_became_available(request_id, headers, http_status_code, reason_phrase);
+
+        if (disk_cache_response.has_value()) {
+            if (DiskCache::is_cacheable(http_status_code, headers))
+                disk_cache_response->response_time = UnixDateTime::now();
+            else
+                disk_cache_response.clear();
+        }
+    }
+};
+
+struct ConnectionFromClient::CachedRequest {
+    int writer_fd { 0 };
+    NonnullOwnPtr<Core::MappedFile> body;
+    size_t bytes_written { 0 };
+    RefPtr<Core::Notifier> notifier;
+
+    CachedRequest(int writer_fd, NonnullOwnPtr<Core::MappedFile> body)
+        : writer_fd(writer_fd)
+        , body(move(body))
+    {
+    }
+
+    ~CachedRequest()
+    {
+        if (notifier)
+            notifier->set_enabled(false);
+        MUST(Core::System::close(writer_fd));
     }
 };
 
@@ -188,6 +254,19 @@ size_t ConnectionFromClient::on_data_received(void* buffer, size_t size, size_t
 
     size_t total_size = size * nmemb;
 
+    // NOTE: A 304 (Not Modified) response has no content, and the client is going to receive the stored body instead.
+    if (request->stale_response.has_value())
+        return total_size;
+
+    if (request->disk_cache_response.has_value()) {
+        if (request->disk_cache_body.size() + total_size > DiskCache::maximum_entry_size) {
+            request->disk_cache_response.clear();
+            request->disk_cache_body.clear();
+        } else {
+            request->disk_cache_body.append(buffer, total_size);
+        }
+    }
+
     size_t remaining_length = total_size;
     u8 const* remaining_data = static_cast<u8 const*>(buffer);
     while (remaining_length > 0) {
@@ -384,13 +463,25 @@ void ConnectionFromClient::set_use_system_dns()
 }
 
 #ifdef AK_OS_WINDOWS
-void ConnectionFromClient::start_request(i32, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData)
+void ConnectionFromClient::start_request(i32, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData, Optional<String>)
 {
     VERIFY(0 && "RequestServer::ConnectionFromClient::start_request is not implemented");
 }
 #else
-void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL::URL url, HTTP::HeaderMap request_headers, ByteBuffer request_body, Core::ProxyData proxy_data)
+void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL::URL url, HTTP::HeaderMap request_headers, ByteBuffer request_body, Core::ProxyData proxy_data, Optional<String> cache_partition_key)
 {
+    auto request_time = UnixDateTime::now();
+    Optional<DiskCache::CachedResponse> stale_response;
+
+    if (auto* cache = disk_cache(); cache && cache_partition_key.has_value()) {
+        if (auto cached_response = cache->open_entry(method, url, *cache_partition_key, request_headers); cached_response.has_value()) {
+            if (cached_response->revalidation_headers.has_value())
+                stale_response = cached_response.release_value();
+            else if (start_cached_request(request_id, cached_response.release_value()))
+                return;
+        }
+    }
+
     auto host = url.serialized_host().to_byte_string();
 
     m_resolver->dns.lookup(host, DNS::Messages::Class::IN, { DNS::Messages::ResourceType::A, DNS::Messages::ResourceType::AAAA })
@@ -399,7 +490,7 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
             // FIXME: Implement timing info for DNS lookup failure.
             async_request_finished(request_id, 0, {}, Requests::NetworkError::UnableToResolveHost);
         })
-        .when_resolved([this, request_id, host = move(host), url = move(url), method = move(method), request_body = move(request_body), request_headers = move(request_headers), proxy_data](auto const& dns_result) mutable {
+        .when_resolved([this, request_id, host = move(host), url = move(url), method = move(method), request_body = move(request_body), request_headers = move(request_headers), proxy_data, cache_partition_key = move(cache_partition_key), request_time, stale_response = move(stale_response)](auto const& dns_result) mutable {
             if (dns_result->records().is_empty() || dns_result->cached_addresses().is_empty()) {
                 dbgln("StartRequest: DNS lookup failed for '{}'", host);
                 // FIXME: Implement timing info for DNS lookup failure.
@@ -426,6 +517,10 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
 
             auto request = make<ActiveRequest>(*this, m_curl_multi, easy, request_id, writer_fd);
             request->url = url.to_string();
+            if (disk_cache() && cache_partition_key.has_value() && DiskCache::is_cacheable(method, request_headers)) {
+                request->disk_cache_response = DiskCache::ResponseToStore { .url = url, .partition_key = cache_partition_key.release_value(), .request_time = request_time };
+                request->stale_response = move(stale_response);
+            }
 
             auto set_option = [easy](auto option, auto value) {
                 auto result = curl_easy_setopt(easy, option, value);
@@ -486,6 +581,14 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
                 curl_headers = curl_slist_append(curl_headers, header_string.characters());
             }
 
+            // NOTE: Ask the server whether our stale copy of the response is still valid, rather than for the response itself.
+            if (request->stale_response.has_value()) {
+                for (auto const& header : request->stale_response->revalidation_headers->headers()) {
+                    auto header_string = ByteString::formatted("{}: {}", header.name, header.value);
+                    curl_headers = curl_slist_append(curl_headers, header_string.characters());
+                }
+            }
+
             if (curl_headers) {
                 set_option(CURLOPT_HTTPHEADER, curl_headers);
                 request->curl_string_lists.append(curl_headers);
@@ -660,6 +763,25 @@ void ConnectionFromClient::check_active_requests()
                 }
             }
 
+            // NOTE: The server has confirmed that our stale response is still valid, so send its stored body through
+            //       the pipe the client is already reading from.
+            if (request_was_successful && request->stale_response.has_value()) {
+                send_cached_response_body(request->request_id, exchange(request->writer_fd, 0), move(request->stale_response->body));
+                m_active_requests.remove(request->request_id);
+                continue;
+            }
+
+            if (request_was_successful && request->disk_cache_response.has_value()) {
+                if (auto* cache = disk_cache()) {
+                    auto& response = *request->disk_cache_response;
+                    response.status_code = request->http_status_code;
+                    response.reason_phrase = request->reason_phrase;
+                    response.headers = request->headers;
+                    response.body = request->disk_cache_body;
+                    cache->store_entry(response);
+                }
+            }
+
             async_request_finished(request->request_id, request->downloaded_so_far, timing_info, network_error);
         }
 
@@ -667,8 +789,67 @@ void ConnectionFromClient::check_active_requests()
     }
 }
 
+bool ConnectionFromClient::start_cached_request(i32 request_id, DiskCache::CachedResponse response)
+{
+    auto fds_or_error = Core::System::pipe2(O_NONBLOCK);
+    if (fds_or_error.is_error()) {
+        dbgln("StartRequest: Failed to create pipe for cached response, falling back to the network: {}", fds_or_error.error());
+        return false;
+    }
+
+    auto fds = fds_or_error.release_value();
+    async_request_started(request_id, IPC::File::adopt_fd(fds[0]));
+    async_headers_became_available(request_id, response.headers, response.status_code, response.reason_phrase);
+
+    send_cached_response_body(request_id, fds[1], move(response.body));
+    return true;
+}
+
+void ConnectionFromClient::send_cached_response_body(i32 request_id, int writer_fd, NonnullOwnPtr<Core::MappedFile> body)
+{
+    auto request = make<CachedRequest>(writer_fd, move(body));
+    request->notifier = Core::Notifier::construct(request->writer_fd, Core::NotificationType::Write);
+    request->notifier->on_activation = [this, request_id] {
+        auto& request = *m_cached_requests.get(request_id).value();
+        auto remaining_body = request.body->bytes().slice(request.bytes_written);
+
+        auto result = Core::System::write(request.writer_fd, remaining_body);
+        if (result.is_error()) {
+            if (result.error().code() == EAGAIN)
+                return;
+            dbgln("CachedRequest: write failed: {}", result.error());
+        } else {
+            request.bytes_written += result.value();
+            if (request.bytes_written < request.body->bytes().size())
+                return;
+        }
+
+        async_request_finished(request_id, request.bytes_written, {}, {});
+
+        // NOTE: We are running inside the notifier's callback, so we have to keep it alive until we've returned.
+        request.notifier->set_enabled(false);
+        Core::deferred_invoke([request = m_cached_requests.take(request_id)] {});
+    };
+    request->notifier->set_enabled(true);
+
+    m_cached_requests.set(request_id, move(request));
+}
+
+Messages::RequestServer::DiskCacheStatisticsResponse ConnectionFromClient::disk_cache_statistics()
+{
+    auto* cache = disk_cache();
+    if (!cache)
+        return { 0, 0, 0, 0 };
+
+    auto const& statistics = cache->statistics();
+    return { statistics.hits, statistics.misses, statistics.bytes_served, statistics.bytes_stored };
+}
+
 Messages::RequestServer::StopRequestResponse ConnectionFromClient::stop_request(i32 request_id)
 {
+    if (m_cached_requests.remove(request_id))
+        return true;
+
     auto request = m_active_requests.take(request_id);
     if (!request.has_value()) {
         dbgln("StopRequest: Request ID {} not found", request_id);
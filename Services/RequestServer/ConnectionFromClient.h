@@ -10,6 +10,7 @@
 #include <LibDNS/Resolver.h>
 #include <LibIPC/ConnectionFromClient.h>
 #include <LibWebSocket/WebSocket.h>
+#include <RequestServer/DiskCache.h>
 #include <RequestServer/RequestClientEndpoint.h>
 #include <RequestServer/RequestServerEndpoint.h>
 
@@ -42,10 +43,11 @@ private:
     virtual Messages::RequestServer::IsSupportedProtocolResponse is_supported_protocol(ByteString) override;
     virtual void set_dns_server(ByteString host_or_address, u16 port, bool use_tls) override;
     virtual void set_use_system_dns() override;
-    virtual void start_request(i32 request_id, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData) override;
+    virtual void start_request(i32 request_id, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData, Optional<String>) override;
     virtual Messages::RequestServer::StopRequestResponse stop_request(i32) override;
     virtual Messages::RequestServer::SetCertificateResponse set_certificate(i32, ByteString, ByteString) override;
     virtual void ensure_connection(URL::URL url, ::RequestServer::CacheLevel cache_level) override;
+    virtual Messages::RequestServer::DiskCacheStatisticsResponse disk_cache_statistics() override;
 
     virtual void websocket_connect(i64 websocket_id, URL::URL, ByteString, Vector<ByteString>, Vector<ByteString>, HTTP::HeaderMap) override;
     virtual void websocket_send(i64 websocket_id, bool, ByteBuffer) override;
@@ -64,6 +66,12 @@ private:
 
     HashMap<i32, NonnullOwnPtr<ActiveRequest>> m_active_requests;
 
+    struct CachedRequest;
+    // Returns false if the cached response couldn't be served, in which case the request should go to the network.
+    bool start_cached_request(i32 request_id, DiskCache::CachedResponse);
+    void send_cached_response_body(i32 request_id, int writer_fd, NonnullOwnPtr<Core::MappedFile> body);
+    HashMap<i32, NonnullOwnPtr<CachedRequest>> m_cached_requests;
+
     void check_active_requests();
     void* m_curl_multi { nullptr };
     RefPtr<Core::Timer> m_timer;
@@ -0,0 +1,590 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Hex.h>
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <AK/QuickSort.h>
+#include <LibCore/DateTime.h>
+#include <LibCore/DirIterator.h>
+#include <LibCore/Directory.h>
+#include <LibCore/File.h>
+#include <LibCore/StandardPaths.h>
+#include <LibCore/System.h>
+#include <LibCrypto/Hash/SHA2.h>
+#include <RequestServer/DiskCache.h>
+
+namespace RequestServer {
+
+static constexpr auto metadata_extension = ".meta"sv;
+static constexpr auto body_extension = ".body"sv;
+
+ErrorOr<NonnullOwnPtr<DiskCache>> DiskCache::create(u64 maximum_size)
+{
+    // FIXME: Move this to a generic "Ladybird cache directory" helper.
+    auto directory = ByteString::formatted("{}/Ladybird/HTTPCache", Core::StandardPaths::user_data_directory());
+    return create(move(directory), maximum_size);
+}
+
+ErrorOr<NonnullOwnPtr<DiskCache>> DiskCache::create(ByteString directory, u64 maximum_size)
+{
+    TRY(Core::Directory::create(directory, Core::Directory::CreateDirectories::Yes));
+
+    auto cache = adopt_own(*new DiskCache(move(directory), maximum_size));
+    cache->build_index();
+    return cache;
+}
+
+DiskCache::DiskCache(ByteString directory, u64 maximum_size)
+    : m_directory(move(directory))
+    , m_maximum_size(maximum_size)
+{
+}
+
+String DiskCache::key_for(StringView partition_key, URL::URL const& url)
+{
+    auto digest = Crypto::Hash::SHA256::hash(ByteString::formatted("{}\n{}", partition_key, url.serialize(URL::ExcludeFragment::Yes)));
+    return MUST(String::from_byte_string(encode_hex(digest.bytes())));
+}
+
+ByteString DiskCache::metadata_path(StringView key) const
+{
+    return ByteString::formatted("{}/{}{}", m_directory, key, metadata_extension);
+}
+
+ByteString DiskCache::body_path(StringView key) const
+{
+    return ByteString::formatted("{}/{}{}", m_directory, key, body_extension);
+}
+
+void DiskCache::build_index()
+{
+    Core::DirIterator iterator(m_directory, Core::DirIterator::SkipDots);
+
+    while (iterator.has_next()) {
+        auto name = iterator.next_path();
+        if (!name.ends_with(body_extension))
+            continue;
+
+        auto key = MUST(String::from_utf8(name.substring_view(0, name.length() - body_extension.length())));
+
+        auto stat = Core::System::stat(body_path(key));
+        if (stat.is_error() || Core::System::stat(metadata_path(key)).is_error()) {
+            (void)Core::System::unlink(body_path(key));
+            continue;
+        }
+
+        auto size = static_cast<u64>(stat.value().st_size);
+        m_index.set(key, { .size = size, .last_access_time = UnixDateTime::from_seconds_since_epoch(stat.value().st_mtime) });
+        m_total_size += size;
+    }
+
+    evict_entries_if_needed();
+}
+
+// https://httpwg.org/specs/rfc9111.html#cache-request-directive
+// https://httpwg.org/specs/rfc9111.html#cache-response-directive
+struct CacheControl {
+    bool no_store { false };
+    bool no_cache { false };
+    Optional<u64> max_age;
+};
+
+static CacheControl parse_cache_control(StringView cache_control)
+{
+    CacheControl directives;
+
+    for (auto directive : cache_control.split_view(',')) {
+        directive = directive.trim_whitespace();
+
+        if (directive.equals_ignoring_ascii_case("no-store"sv))
+            directives.no_store = true;
+        else if (directive.equals_ignoring_ascii_case("no-cache"sv))
+            directives.no_cache = true;
+        else if (directive.starts_with("max-age="sv, CaseSensitivity::CaseInsensitive))
+            directives.max_age = directive.substring_view("max-age="sv.length()).trim("\""sv).to_number<u64>();
+    }
+
+    return directives;
+}
+
+static CacheControl parse_cache_control(HTTP::HeaderMap const& headers)
+{
+    if (auto cache_control = headers.get("Cache-Control"); cache_control.has_value())
+        return parse_cache_control(*cache_control);
+    return {};
+}
+
+// https://httpwg.org/specs/rfc9111.html#calculating.freshness.lifetime
+static AK::Duration freshness_lifetime(HTTP::HeaderMap const& response_headers)
+{
+    // NOTE: A no-cache response may be stored, but must be revalidated before each use.
+    auto directives = parse_cache_control(response_headers);
+    if (directives.no_cache)
+        return AK::Duration::zero();
+
+    // FIXME: Support the Expires header field and heuristic freshness.
+    return AK::Duration::from_seconds(static_cast<i64>(directives.max_age.value_or(0)));
+}
+
+// https://httpwg.org/specs/rfc9111.html#validation.sent
+static Optional<HTTP::HeaderMap> conditional_request_headers(HTTP::HeaderMap const& stored_headers)
+{
+    HTTP::HeaderMap headers;
+
+    if (auto etag = stored_headers.get("ETag"); etag.has_value())
+        headers.set("If-None-Match", *etag);
+    if (auto last_modified = stored_headers.get("Last-Modified"); last_modified.has_value())
+        headers.set("If-Modified-Since", *last_modified);
+
+    if (headers.headers().is_empty())
+        return {};
+    return headers;
+}
+
+// https://httpwg.org/specs/rfc9111.html#caching.overview
+bool DiskCache::is_cacheable(StringView method, HTTP::HeaderMap const& request_headers)
+{
+    if (method != "GET"sv)
+        return false;
+
+    // NOTE: We don't store partial content, and we don't attach credentials to stored responses.
+    if (request_headers.contains("Range") || request_headers.contains("Authorization"))
+        return false;
+
+    // NOTE: Conditional requests come from a cache in front of us that is trying to revalidate its own entry, and
+    //       requests with no-cache or no-store (e.g. a forced reload) must go to the network.
+    if (request_headers.contains("If-None-Match") || request_headers.contains("If-Modified-Since"))
+        return false;
+
+    if (auto cache_control = request_headers.get("Cache-Control"); cache_control.has_value()) {
+        auto directives = parse_cache_control(*cache_control);
+        if (directives.no_store || directives.no_cache || directives.max_age == 0u)
+            return false;
+    }
+
+    if (auto pragma = request_headers.get("Pragma"); pragma.has_value() && pragma->contains("no-cache"sv, CaseSensitivity::CaseInsensitive))
+        return false;
+
+    return true;
+}
+
+// https://httpwg.org/specs/rfc9111.html#response.cacheability
+bool DiskCache::is_cacheable(u32 status_code, HTTP::HeaderMap const& response_headers)
+{
+    // AD-HOC: We only store complete, successful responses.
+    if (status_code != 200)
+        return false;
+
+    // AD-HOC: We don't store responses with Set-Cookie, as replaying them would set the cookie again.
+    if (response_headers.contains("Set-Cookie"))
+        return false;
+
+    // FIXME: Support Vary by storing the selecting request headers alongside the entry. For now, only Vary on
+    //        Accept-Encoding is allowed, since we always send the same Accept-Encoding ourselves.
+    if (auto vary = response_headers.get("Vary"); vary.has_value() && !vary->equals_ignoring_ascii_case("Accept-Encoding"sv))
+        return false;
+
+    if (parse_cache_control(response_headers).no_store)
+        return false;
+
+    // NOTE: A response that is stale as soon as it's stored is only worth storing if it can be revalidated.
+    if (freshness_lifetime(response_headers) == AK::Duration::zero())
+        return conditional_request_headers(response_headers).has_value();
+
+    return true;
+}
+
+// https://httpwg.org/specs/rfc9111.html#storing.fields
+static bool is_exempted_for_storage(StringView header_name)
+{
+    return header_name.is_one_of_ignoring_ascii_case(
+        "Connection"sv,
+        "Proxy-Connection"sv,
+        "Keep-Alive"sv,
+        "TE"sv,
+        "Transfer-Encoding"sv,
+        "Upgrade"sv);
+}
+
+// https://httpwg.org/specs/rfc9111.html#update
+static HTTP::HeaderMap updated_stored_headers(HTTP::HeaderMap const& stored_headers, HTTP::HeaderMap const& response_headers)
+{
+    // [T]he cache MUST add each header field in the provided response to the stored response, replacing field values
+    // that are already present, with the following exceptions:
+    // - Header fields excepted from storage in Section 3.1,
+    // - [...]
+    // - The Content-Length header field.
+    auto is_updated = [](StringView name) {
+        return !is_exempted_for_storage(name) && !name.equals_ignoring_ascii_case("Content-Length"sv);
+    };
+
+    HTTP::HeaderMap headers;
+
+    for (auto const& header : stored_headers.headers()) {
+        // NOTE: The Age we computed for the stale response is no longer relevant.
+        if (header.name.equals_ignoring_ascii_case("Age"sv))
+            continue;
+        if (is_updated(header.name) && response_headers.contains(header.name))
+            continue;
+        headers.set(header.name, header.value);
+    }
+
+    for (auto const& header : response_headers.headers()) {
+        if (is_updated(header.name))
+            headers.set(header.name, header.value);
+    }
+
+    return headers;
+}
+
+// https://httpwg.org/specs/rfc9111.html#field.age
+static HTTP::HeaderMap headers_with_age(HTTP::HeaderMap const& stored_headers, AK::Duration current_age)
+{
+    HTTP::HeaderMap headers;
+
+    for (auto const& header : stored_headers.headers()) {
+        if (!header.name.equals_ignoring_ascii_case("Age"sv))
+            headers.set(header.name, header.value);
+    }
+
+    headers.set("Age", ByteString::number(current_age.to_seconds()));
+    return headers;
+}
+
+// https://httpwg.org/specs/rfc9111.html#age.calculations
+static AK::Duration corrected_initial_age(HTTP::HeaderMap const& response_headers, UnixDateTime request_time, UnixDateTime response_time)
+{
+    // The term "age_value" denotes the value of the Age header field, in a form appropriate for arithmetic operation;
+    // or 0, if not available.
+    auto age_value = AK::Duration::zero();
+    if (auto age = response_headers.get("Age"); age.has_value())
+        age_value = AK::Duration::from_seconds(age->trim_whitespace().to_number<i64>().value_or(0));
+
+    // The term "date_value" denotes the value of the Date header field, in a form appropriate for arithmetic
+    // operations.
+    // NOTE: A response without a valid Date is treated as if it was generated when it was received.
+    auto date_value = response_time;
+    if (auto date = response_headers.get("Date"); date.has_value()) {
+        if (auto date_time = Core::DateTime::parse("%a, %d %b %Y %H:%M:%S %Z"sv, *date); date_time.has_value())
+            date_value = UnixDateTime::from_seconds_since_epoch(date_time->timestamp());
+    }
+
+    //     apparent_age = max(0, response_time - date_value);
+    auto apparent_age = max(AK::Duration::zero(), response_time - date_value);
+
+    //     response_delay = response_time - request_time;
+    //     corrected_age_value = age_value + response_delay;
+    auto response_delay = response_time - request_time;
+    auto corrected_age_value = age_value + response_delay;
+
+    //     corrected_initial_age = max(apparent_age, corrected_age_value);
+    return max(apparent_age, corrected_age_value);
+}
+
+struct EntryMetadata {
+    String url;
+    String partition_key;
+    u32 status_code { 0 };
+    Optional<String> reason_phrase;
+    HTTP::HeaderMap headers;
+    UnixDateTime response_time;
+    AK::Duration corrected_initial_age;
+    AK::Duration freshness_lifetime;
+};
+
+static String serialize_metadata(EntryMetadata const& metadata)
+{
+    JsonArray headers;
+    for (auto const& header : metadata.headers.headers()) {
+        JsonArray header_pair;
+        header_pair.must_append(header.name.view());
+        header_pair.must_append(header.value.view());
+        headers.must_append(move(header_pair));
+    }
+
+    JsonObject object;
+    object.set("url"sv, metadata.url);
+    object.set("partition_key"sv, metadata.partition_key);
+    object.set("status_code"sv, metadata.status_code);
+    if (metadata.reason_phrase.has_value())
+        object.set("reason_phrase"sv, *metadata.reason_phrase);
+    object.set("response_time"sv, metadata.response_time.seconds_since_epoch());
+    object.set("corrected_initial_age"sv, metadata.corrected_initial_age.to_seconds());
+    object.set("freshness_lifetime"sv, metadata.freshness_lifetime.to_seconds());
+    object.set("headers"sv, move(headers));
+    return object.serialized();
+}
+
+static ErrorOr<EntryMetadata> parse_metadata(StringView contents)
+{
+    auto json = TRY(JsonValue::from_string(contents));
+    if (!json.is_object())
+        return Error::from_string_literal("Cache metadata is not an object");
+
+    auto const& object = json.as_object();
+    auto url = object.get_string("url"sv);
+    auto partition_key = object.get_string("partition_key"sv);
+    auto response_time = object.get_i64("response_time"sv);
+    auto initial_age = object.get_i64("corrected_initial_age"sv);
+    if (!url.has_value() || !partition_key.has_value() || !response_time.has_value() || !initial_age.has_value())
+        return Error::from_string_literal("Cache metadata is incomplete");
+
+    EntryMetadata metadata {
+        .url = *url,
+        .partition_key = *partition_key,
+        .status_code = object.get_u32("status_code"sv).value_or(200),
+        .reason_phrase = {},
+        .headers = {},
+        .response_time = UnixDateTime::from_seconds_since_epoch(*response_time),
+        .corrected_initial_age = AK::Duration::from_seconds(*initial_age),
+        .freshness_lifetime = AK::Duration::from_seconds(object.get_i64("freshness_lifetime"sv).value_or(0)),
+    };
+
+    if (auto reason_phrase = object.get_string("reason_phrase"sv); reason_phrase.has_value())
+        metadata.reason_phrase = *reason_phrase;
+
+    if (auto headers = object.get_array("headers"sv); headers.has_value()) {
+        for (auto const& header : headers->values()) {
+            if (!header.is_array() || header.as_array().size() != 2)
+                continue;
+            auto const& name = header.as_array().at(0);
+            auto const& value = header.as_array().at(1);
+            if (name.is_string() && value.is_string())
+                metadata.headers.set(name.as_string().to_byte_string(), value.as_string().to_byte_string());
+        }
+    }
+
+    return metadata;
+}
+
+// NOTE: Files are written under a temporary name first, so a concurrent reader never sees a partial entry.
+static ErrorOr<void> write_file(ByteString const& path, ReadonlyBytes bytes)
+{
+    auto temporary_path = ByteString::formatted("{}.tmp", path);
+    auto file = TRY(Core::File::open(temporary_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+    TRY(file->write_until_depleted(bytes));
+    TRY(Core::System::rename(temporary_path, path));
+    return {};
+}
+
+Optional<DiskCache::CachedResponse> DiskCache::open_entry(StringView method, URL::URL const& url, StringView partition_key, HTTP::HeaderMap const& request_headers)
+{
+    if (!is_cacheable(method, request_headers))
+        return {};
+
+    auto key = key_for(partition_key, url);
+
+    if (!m_index.contains(key)) {
+        ++m_statistics.misses;
+        return {};
+    }
+
+    auto cached_response = [&]() -> ErrorOr<Optional<CachedResponse>> {
+        auto metadata_file = TRY(Core::File::open(metadata_path(key), Core::File::OpenMode::Read));
+        auto metadata_contents = TRY(metadata_file->read_until_eof());
+        auto metadata = TRY(parse_metadata(metadata_contents));
+
+        if (metadata.url != url.serialize(URL::ExcludeFragment::Yes))
+            return Error::from_string_literal("Cache metadata does not match URL");
+        if (metadata.partition_key != partition_key)
+            return Error::from_string_literal("Cache metadata does not match partition key");
+
+        // https://httpwg.org/specs/rfc9111.html#age.calculations
+        //     resident_time = now - response_time;
+        //     current_age = corrected_initial_age + resident_time;
+        auto resident_time = UnixDateTime::now() - metadata.response_time;
+        auto current_age = metadata.corrected_initial_age + resident_time;
+
+        // https://httpwg.org/specs/rfc9111.html#expiration.model
+        Optional<HTTP::HeaderMap> revalidation_headers;
+        if (current_age >= metadata.freshness_lifetime) {
+            revalidation_headers = conditional_request_headers(metadata.headers);
+            if (!revalidation_headers.has_value())
+                return OptionalNone {};
+        }
+
+        return CachedResponse {
+            .status_code = metadata.status_code,
+            .reason_phrase = move(metadata.reason_phrase),
+            .headers = headers_with_age(metadata.headers, current_age),
+            .body = TRY(Core::MappedFile::map(body_path(key))),
+            .revalidation_headers = move(revalidation_headers),
+        };
+    }();
+
+    if (cached_response.is_error() || !cached_response.value().has_value()) {
+        if (cached_response.is_error())
+            dbgln("DiskCache: Unable to read entry for {}: {}", url, cached_response.error());
+        remove_entry(key);
+        ++m_statistics.misses;
+        return {};
+    }
+
+    auto response = cached_response.release_value().release_value();
+
+    // NOTE: A stale entry only counts as a hit once the origin server has confirmed that it is still valid.
+    if (response.revalidation_headers.has_value())
+        return response;
+
+    update_last_access_time(key);
+
+    ++m_statistics.hits;
+    m_statistics.bytes_served += response.body->bytes().size();
+
+    return response;
+}
+
+// https://httpwg.org/specs/rfc9111.html#validation.response
+bool DiskCache::revalidate_entry(CachedResponse& response, URL::URL const& url, StringView partition_key, u32 status_code, HTTP::HeaderMap const& response_headers, UnixDateTime request_time, UnixDateTime response_time)
+{
+    VERIFY(response.revalidation_headers.has_value());
+
+    auto key = key_for(partition_key, url);
+
+    // A full response (i.e., one containing content) indicates that none of the stored responses nominated in the
+    // conditional request are suitable. Instead, the cache MUST use the full response to satisfy the request.
+    // NOTE: The full response replaces the stale entry if it can be stored. Either way, the stale entry is of no use.
+    if (status_code != 304) {
+        remove_entry(key);
+        ++m_statistics.misses;
+        return false;
+    }
+
+    // The 304 (Not Modified) status code indicates that the stored response can be updated and reused.
+    // https://httpwg.org/specs/rfc9111.html#freshening.responses
+    EntryMetadata metadata {
+        .url = url.serialize(URL::ExcludeFragment::Yes),
+        .partition_key = MUST(String::from_utf8(partition_key)),
+        .status_code = response.status_code,
+        .reason_phrase = response.reason_phrase,
+        .headers = updated_stored_headers(response.headers, response_headers),
+        .response_time = response_time,
+        .corrected_initial_age = corrected_initial_age(response_headers, request_time, response_time),
+        .freshness_lifetime = {},
+    };
+    metadata.freshness_lifetime = freshness_lifetime(metadata.headers);
+
+    // NOTE: The entry may have been evicted while the conditional request was in flight. We still hold on to its body,
+    //       so the response can be used, but there is nothing left to update.
+    if (m_index.contains(key)) {
+        if (!is_cacheable(metadata.status_code, metadata.headers)) {
+            remove_entry(key);
+        } else if (auto result = write_file(metadata_path(key), serialize_metadata(metadata).bytes()); result.is_error()) {
+            dbgln("DiskCache: Unable to update entry for {}: {}", url, result.error());
+            remove_entry(key);
+        } else {
+            update_last_access_time(key);
+        }
+    }
+
+    response.headers = headers_with_age(metadata.headers, metadata.corrected_initial_age);
+    response.revalidation_headers.clear();
+
+    ++m_statistics.hits;
+    m_statistics.bytes_served += response.body->bytes().size();
+
+    return true;
+}
+
+void DiskCache::store_entry(ResponseToStore const& response)
+{
+    auto const& url = response.url;
+    auto body = response.body;
+
+    // NOTE: Empty bodies can't be mapped into memory, and aren't worth a disk round-trip anyway.
+    if (body.is_empty() || body.size() > maximum_entry_size || body.size() > m_maximum_size)
+        return;
+
+    auto key = key_for(response.partition_key, url);
+
+    EntryMetadata metadata {
+        .url = url.serialize(URL::ExcludeFragment::Yes),
+        .partition_key = response.partition_key,
+        .status_code = response.status_code,
+        .reason_phrase = response.reason_phrase,
+        .headers = {},
+        .response_time = response.response_time,
+        .corrected_initial_age = corrected_initial_age(response.headers, response.request_time, response.response_time),
+        .freshness_lifetime = freshness_lifetime(response.headers),
+    };
+
+    // NOTE: Don't bother storing a response that was already stale when it arrived, unless it can be revalidated.
+    if (metadata.corrected_initial_age >= metadata.freshness_lifetime && !conditional_request_headers(response.headers).has_value())
+        return;
+
+    for (auto const& header : response.headers.headers()) {
+        if (!is_exempted_for_storage(header.name))
+            metadata.headers.set(header.name, header.value);
+    }
+
+    remove_entry(key);
+
+    auto result = [&]() -> ErrorOr<void> {
+        TRY(write_file(body_path(key), body));
+        TRY(write_file(metadata_path(key), serialize_metadata(metadata).bytes()));
+        return {};
+    }();
+
+    if (result.is_error()) {
+        dbgln("DiskCache: Unable to store entry for {}: {}", url, result.error());
+        remove_entry(key);
+        return;
+    }
+
+    m_index.set(key, { .size = body.size(), .last_access_time = UnixDateTime::now() });
+    m_total_size += body.size();
+    m_statistics.bytes_stored += body.size();
+
+    evict_entries_if_needed();
+}
+
+void DiskCache::update_last_access_time(String const& key)
+{
+    auto index_entry = m_index.get(key);
+    if (!index_entry.has_value())
+        return;
+
+    index_entry->last_access_time = UnixDateTime::now();
+
+    // NOTE: The index is rebuilt from the body files' modification times on startup, so bump it as well to keep the
+    //       entry's place in the LRU order across restarts.
+    if (auto result = Core::System::utimensat(AT_FDCWD, body_path(key), nullptr, 0); result.is_error())
+        dbgln("DiskCache: Unable to update access time of {}: {}", body_path(key), result.error());
+}
+
+void DiskCache::remove_entry(String const& key)
+{
+    if (auto index_entry = m_index.take(key); index_entry.has_value())
+        m_total_size -= index_entry->size;
+
+    (void)Core::System::unlink(metadata_path(key));
+    (void)Core::System::unlink(body_path(key));
+}
+
+void DiskCache::evict_entries_if_needed()
+{
+    if (m_total_size <= m_maximum_size)
+        return;
+
+    Vector<String> keys_by_last_access;
+    keys_by_last_access.ensure_capacity(m_index.size());
+    for (auto const& it : m_index)
+        keys_by_last_access.unchecked_append(it.key);
+
+    quick_sort(keys_by_last_access, [&](auto const& a, auto const& b) {
+        return m_index.get(a)->last_access_time < m_index.get(b)->last_access_time;
+    });
+
+    for (auto const& key : keys_by_last_access) {
+        if (m_total_size <= m_maximum_size)
+            break;
+        remove_entry(key);
+    }
+}
+
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/HashMap.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <LibCore/MappedFile.h>
+#include <LibHTTP/HeaderMap.h>
+#include <LibURL/URL.h>
+
+namespace RequestServer {
+
+// A persistent HTTP cache shared by all clients of this RequestServer. Each entry is stored as a pair of files in the
+// cache directory, named after the SHA-256 of the request's partition key and URL: a JSON metadata file holding the
+// status and response headers, and the raw response body, which is mapped into memory when served.
+//
+// The partition key identifies the top-level site and the frame site that made the request, so that one site can't
+// find out whether another site has loaded a resource by timing how long it takes to load.
+//
+// Stale entries with an ETag or Last-Modified validator are kept, and revalidated with a conditional request before
+// they are used again, so an unchanged resource costs a 304 (Not Modified) response rather than a full download.
+//
+// https://httpwg.org/specs/rfc9111.html
+class DiskCache {
+public:
+    static constexpr u64 default_maximum_size = 256 * MiB;
+    static constexpr u64 maximum_entry_size = 32 * MiB;
+
+    static ErrorOr<NonnullOwnPtr<DiskCache>> create(u64 maximum_size = default_maximum_size);
+    static ErrorOr<NonnullOwnPtr<DiskCache>> create(ByteString directory, u64 maximum_size = default_maximum_size);
+
+    struct CachedResponse {
+        u32 status_code { 0 };
+        Optional<String> reason_phrase;
+        HTTP::HeaderMap headers;
+        NonnullOwnPtr<Core::MappedFile> body;
+
+        // Set if the entry is stale, in which case it may only be used once the origin server has confirmed that it is
+        // still valid. These are the conditional request headers that ask the server to do so.
+        // https://httpwg.org/specs/rfc9111.html#validation.sent
+        Optional<HTTP::HeaderMap> revalidation_headers;
+    };
+    Optional<CachedResponse> open_entry(StringView method, URL::URL const&, StringView partition_key, HTTP::HeaderMap const& request_headers);
+
+    // Updates a stale entry from the origin server's response to a conditional request. Returns whether the stored
+    // response may be used after all, in which case its headers have been updated to match.
+    bool revalidate_entry(CachedResponse&, URL::URL const&, StringView partition_key, u32 status_code, HTTP::HeaderMap const& response_headers, UnixDateTime request_time, UnixDateTime response_time);
+
+    static bool is_cacheable(StringView method, HTTP::HeaderMap const& request_headers);
+    static bool is_cacheable(u32 status_code, HTTP::HeaderMap const& response_headers);
+
+    struct ResponseToStore {
+        URL::URL url;
+        String partition_key;
+        u32 status_code { 0 };
+        Optional<String> reason_phrase;
+        HTTP::HeaderMap headers;
+        ReadonlyBytes body;
+        UnixDateTime request_time;
+        UnixDateTime response_time;
+    };
+    void store_entry(ResponseToStore const&);
+
+    struct Statistics {
+        u64 hits { 0 };
+        u64 misses { 0 };
+        u64 bytes_served { 0 };
+        u64 bytes_stored { 0 };
+    };
+    Statistics const& statistics() const { return m_statistics; }
+
+private:
+    DiskCache(ByteString directory, u64 maximum_size);
+
+    struct IndexEntry {
+        u64 size { 0 };
+        UnixDateTime last_access_time;
+    };
+
+    static String key_for(StringView partition_key, URL::URL const&);
+    ByteString metadata_path(StringView key) const;
+    ByteString body_path(StringView key) const;
+
+    void build_index();
+    void update_last_access_time(String const& key);
+    void remove_entry(String const& key);
+    void evict_entries_if_needed();
+
+    ByteString m_directory;
+    u64 m_maximum_size { 0 };
+    u64 m_total_size { 0 };
+
+    HashMap<String, IndexEntry> m_index;
+    Statistics m_statistics;
+};
+
+}
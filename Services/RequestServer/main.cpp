@@ -24,6 +24,7 @@
 
 namespace RequestServer {
 extern ByteString g_default_certificate_path;
+extern bool g_disk_cache_enabled;
 }
 
 static ErrorOr<ByteString> find_certificates(StringView serenity_resource_root)
@@ -42,12 +43,14 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     Vector<ByteString> certificates;
     StringView mach_server_name;
     bool wait_for_debugger = false;
+    bool enable_http_disk_cache = false;
 
     Core::ArgsParser args_parser;
     args_parser.add_option(certificates, "Path to a certificate file", "certificate", 'C', "certificate");
     args_parser.add_option(serenity_resource_root, "Absolute path to directory for serenity resources", "serenity-resource-root", 'r', "serenity-resource-root");
     args_parser.add_option(mach_server_name, "Mach server name", "mach-server-name", 0, "mach_server_name");
     args_parser.add_option(wait_for_debugger, "Wait for debugger", "wait-for-debugger");
+    args_parser.add_option(enable_http_disk_cache, "Enable the persistent HTTP disk cache", "enable-http-disk-cache");
     args_parser.parse(arguments);
 
     if (wait_for_debugger)
@@ -59,6 +62,8 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     else
         RequestServer::g_default_certificate_path = certificates.first();
 
+    RequestServer::g_disk_cache_enabled = enable_http_disk_cache;
+
     Core::EventLoop event_loop;
 
 #if defined(AK_OS_MACOS)
@@ -28,6 +28,8 @@ public:
     struct BackingStore {
         i32 bitmap_id { -1 };
         Web::Painting::BackingStore* store { nullptr };
+        // The store holding the frame that is currently presented.
+        Web::Painting::BackingStore* previous_frame_store { nullptr };
     };
 
     BackingStore acquire_store_for_next_frame()
@@ -35,6 +37,7 @@ public:
         BackingStore backing_store;
         backing_store.bitmap_id = m_back_bitmap_id;
         backing_store.store = m_back_store.ptr();
+        backing_store.previous_frame_store = m_front_store.ptr();
         swap_back_and_front();
         return backing_store;
     }
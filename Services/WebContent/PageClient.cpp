@@ -223,7 +223,7 @@ void PageClient::ready_to_paint()
 
 void PageClient::paint_next_frame()
 {
-    auto [backing_store_id, back_store] = m_backing_store_manager.acquire_store_for_next_frame();
+    auto [backing_store_id, back_store, previous_frame_store] = m_backing_store_manager.acquire_store_for_next_frame();
     if (!back_store)
         return;
 
@@ -231,12 +231,17 @@ void PageClient::paint_next_frame()
     m_number_of_queued_rasterization_tasks++;
 
     auto viewport_rect = page().css_to_device_rect(page().top_level_traversable()->viewport_rect());
-    start_display_list_rendering(viewport_rect, *back_store, {}, [this, viewport_rect, backing_store_id] {
+    start_display_list_rendering_impl(viewport_rect, *back_store, previous_frame_store, {}, [this, viewport_rect, backing_store_id] {
         client().async_did_paint(m_id, viewport_rect.to_type<int>(), backing_store_id);
     });
 }
 
 void PageClient::start_display_list_rendering(Web::DevicePixelRect const& content_rect, Web::Painting::BackingStore& target, Web::PaintOptions paint_options, Function<void()>&& callback)
+{
+    start_display_list_rendering_impl(content_rect, target, nullptr, paint_options, move(callback));
+}
+
+void PageClient::start_display_list_rendering_impl(Web::DevicePixelRect const& content_rect, Web::Painting::BackingStore& target, Web::Painting::BackingStore* previous_frame_store, Web::PaintOptions paint_options, Function<void()>&& callback)
 {
     paint_options.should_show_line_box_borders = m_should_show_line_box_borders;
     paint_options.has_focus = m_has_focus;
@@ -246,7 +251,7 @@ void PageClient::start_display_list_rendering(Web::DevicePixelRect const& conten
         callback();
         return;
     }
-    traversable.start_display_list_rendering(*display_list, target, move(callback));
+    traversable.start_display_list_rendering(*display_list, target, previous_frame_store, move(callback));
 }
 
 Queue<Web::QueuedInputEvent>& PageClient::input_event_queue()
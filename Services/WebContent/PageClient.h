@@ -107,6 +107,8 @@ private:
 
     virtual void visit_edges(JS::Cell::Visitor&) override;
 
+    void start_display_list_rendering_impl(Web::DevicePixelRect const& content_rect, Web::Painting::BackingStore&, Web::Painting::BackingStore* previous_frame_store, Web::PaintOptions, Function<void()>&& callback);
+
     // ^PageClient
     virtual bool is_connection_open() const override;
     virtual bool is_url_suitable_for_same_process_navigation(URL::URL const& current_url, URL::URL const& target_url) const override;
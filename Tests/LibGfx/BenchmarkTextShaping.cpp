@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/StringBuilder.h>
+#include <AK/Utf8View.h>
+#include <LibCore/MappedFile.h>
+#include <LibGfx/Font/Typeface.h>
+#include <LibGfx/TextLayout.h>
+#include <LibTest/TestCase.h>
+
+static NonnullRefPtr<Gfx::Font> test_font()
+{
+    // NOTE: Tests run from their source directory, so this is the font that ships in Base/res.
+    static auto file = MUST(Core::MappedFile::map("../../Base/res/fonts/SerenitySans-Regular.ttf"sv));
+    static auto typeface = MUST(Gfx::Typeface::try_load_from_externally_owned_memory(file->bytes()));
+    return typeface->font(12);
+}
+
+// Roughly the shape of a long article: a few thousand words, drawn from a limited vocabulary.
+static ByteString const& text_heavy_fixture()
+{
+    static ByteString fixture = [] {
+        constexpr auto paragraph = "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua. Ut enim ad minim veniam, quis nostrud exercitation ullamco laboris nisi ut aliquip ex ea commodo consequat. Duis aute irure dolor in reprehenderit in voluptate velit esse cillum dolore eu fugiat nulla pariatur. Excepteur sint occaecat cupidatat non proident, sunt in culpa qui officia deserunt mollit anim id est laborum. "sv;
+        StringBuilder builder;
+        for (size_t i = 0; i < 200; ++i)
+            builder.append(paragraph);
+        return builder.to_byte_string();
+    }();
+    return fixture;
+}
+
+// Shapes the fixture word by word, the way inline layout does.
+static void lay_out_fixture(Gfx::Font const& font)
+{
+    float x = 0;
+    for (auto word : text_heavy_fixture().view().split_view(' ')) {
+        auto glyph_run = Gfx::shape_text({ x, 0 }, 0, Utf8View { word }, font, Gfx::GlyphRun::TextType::Ltr, {});
+        x += glyph_run->width();
+    }
+}
+
+TEST_CASE(shaping_cache_result_is_independent_of_position)
+{
+    Gfx::clear_shaping_cache();
+    auto font = test_font();
+
+    auto first_run = Gfx::shape_text({ 0, 0 }, 0, Utf8View { "hello"sv }, *font, Gfx::GlyphRun::TextType::Ltr, {});
+    auto second_run = Gfx::shape_text({ 10, 0 }, 2, Utf8View { "hello"sv }, *font, Gfx::GlyphRun::TextType::Ltr, {});
+
+    auto statistics = Gfx::shaping_cache_statistics();
+    EXPECT_EQ(statistics.misses, 1u);
+    EXPECT_EQ(statistics.hits, 1u);
+
+    auto const& first_glyphs = first_run->glyphs();
+    auto const& second_glyphs = second_run->glyphs();
+    EXPECT_EQ(first_glyphs.size(), 5u);
+    EXPECT_EQ(second_glyphs.size(), first_glyphs.size());
+    for (size_t i = 0; i < first_glyphs.size(); ++i) {
+        EXPECT_EQ(second_glyphs[i].glyph_id, first_glyphs[i].glyph_id);
+        EXPECT_APPROXIMATE_WITH_ERROR(second_glyphs[i].position.x(), first_glyphs[i].position.x() + 10 + i * 2, 0.001f);
+    }
+    EXPECT_APPROXIMATE_WITH_ERROR(second_run->width(), first_run->width() + 4 * 2, 0.001f);
+}
+
+BENCHMARK_CASE(lay_out_text_heavy_fixture_without_cache)
+{
+    auto font = test_font();
+    Gfx::set_shaping_cache_enabled(false);
+    for (size_t pass = 0; pass < 10; ++pass)
+        lay_out_fixture(*font);
+    Gfx::set_shaping_cache_enabled(true);
+
+    EXPECT_EQ(Gfx::shaping_cache_statistics().entry_count, 0u);
+}
+
+BENCHMARK_CASE(lay_out_text_heavy_fixture_with_cache)
+{
+    Gfx::clear_shaping_cache();
+    auto font = test_font();
+    for (size_t pass = 0; pass < 10; ++pass)
+        lay_out_fixture(*font);
+}
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <LibCore/Socket.h>
+#include <LibCore/System.h>
+#include <LibIPC/TransportSocket.h>
+#include <LibTest/TestCase.h>
+#include <LibThreading/Thread.h>
+#include <fcntl.h>
+
+static Array<NonnullOwnPtr<IPC::TransportSocket>, 2> create_transport_pair()
+{
+    int fds[2] = {};
+    MUST(Core::System::socketpair(AF_LOCAL, SOCK_STREAM, 0, fds));
+    auto socket0 = MUST(Core::LocalSocket::adopt_fd(fds[0]));
+    MUST(socket0->set_blocking(false));
+    auto socket1 = MUST(Core::LocalSocket::adopt_fd(fds[1]));
+    MUST(socket1->set_blocking(false));
+
+    return Array { make<IPC::TransportSocket>(move(socket0)), make<IPC::TransportSocket>(move(socket1)) };
+}
+
+static Vector<u8> numbered_message(u32 number, size_t size)
+{
+    Vector<u8> bytes;
+    bytes.resize(max(size, sizeof(number)));
+    memcpy(bytes.data(), &number, sizeof(number));
+    return bytes;
+}
+
+static u32 message_number(Vector<u8> const& bytes)
+{
+    u32 number = 0;
+    memcpy(&number, bytes.data(), sizeof(number));
+    return number;
+}
+
+static void receive_messages(IPC::TransportSocket& transport, size_t count, Function<void(IPC::TransportSocket::Message&&)> callback)
+{
+    size_t received = 0;
+    while (received < count) {
+        transport.wait_until_readable();
+        auto result = transport.read_as_many_messages_as_possible_without_blocking([&](auto&& message) {
+            ++received;
+            callback(move(message));
+        });
+        VERIFY(result == IPC::TransportSocket::ShouldShutdown::No);
+    }
+}
+
+TEST_CASE(shared_memory_transport_keeps_messages_in_order)
+{
+    auto transports = create_transport_pair();
+    auto& sender = *transports[0];
+    auto& receiver = *transports[1];
+
+    EXPECT(!sender.is_using_shared_memory_transport());
+    MUST(sender.enable_shared_memory_transport());
+    EXPECT(sender.is_using_shared_memory_transport());
+
+    // Mix in messages that have to go through the socket: ones with file descriptors, and ones too big for the ring.
+    static constexpr u32 message_count = 2000;
+    auto carries_fd = [](u32 number) { return number % 97 == 0; };
+    auto is_huge = [](u32 number) { return number % 501 == 0; };
+
+    for (u32 i = 0; i < message_count; ++i) {
+        Vector<NonnullRefPtr<IPC::AutoCloseFileDescriptor>> fds;
+        if (carries_fd(i))
+            fds.append(adopt_ref(*new IPC::AutoCloseFileDescriptor(MUST(Core::System::anon_create(16, O_CLOEXEC)))));
+        sender.post_message(numbered_message(i, is_huge(i) ? IPC::SharedMemoryRing::DEFAULT_CAPACITY + 1 : 32), fds);
+    }
+
+    u32 expected_number = 0;
+    receive_messages(receiver, message_count, [&](auto&& message) {
+        EXPECT_EQ(message_number(message.bytes), expected_number);
+        EXPECT_EQ(message.fds.size(), carries_fd(expected_number) ? 1u : 0u);
+        ++expected_number;
+    });
+
+    // The receiver should have moved its own messages over to shared memory as well.
+    EXPECT(receiver.is_using_shared_memory_transport());
+
+    receiver.post_message(numbered_message(42, 32), {});
+    receive_messages(sender, 1, [&](auto&& message) {
+        EXPECT_EQ(message_number(message.bytes), 42u);
+    });
+}
+
+TEST_CASE(transport_using_shared_memory_cannot_be_transferred)
+{
+    auto transports = create_transport_pair();
+    MUST(transports[0]->enable_shared_memory_transport());
+    EXPECT(transports[0]->clone_for_transfer().is_error());
+    EXPECT(transports[0]->release_underlying_transport_for_transfer().is_error());
+}
+
+static constexpr u32 throughput_message_count = 500'000;
+static constexpr u32 latency_round_trip_count = 20'000;
+
+static void measure_throughput(bool use_shared_memory)
+{
+    auto transports = create_transport_pair();
+    auto& sender = *transports[0];
+    auto& receiver = *transports[1];
+    if (use_shared_memory)
+        MUST(sender.enable_shared_memory_transport());
+
+    auto receiver_thread = Threading::Thread::construct([receiver = &receiver]() -> intptr_t {
+        receive_messages(*receiver, throughput_message_count, [](auto&&) { });
+        return 0;
+    });
+    receiver_thread->start();
+
+    auto payload = numbered_message(0, 64);
+    for (u32 i = 0; i < throughput_message_count; ++i)
+        sender.post_message(payload, {});
+
+    (void)receiver_thread->join();
+}
+
+static void measure_latency(bool use_shared_memory)
+{
+    auto transports = create_transport_pair();
+    auto& client = *transports[0];
+    auto& server = *transports[1];
+    if (use_shared_memory)
+        MUST(client.enable_shared_memory_transport());
+
+    auto server_thread = Threading::Thread::construct([server = &server]() -> intptr_t {
+        receive_messages(*server, latency_round_trip_count, [server](auto&& message) {
+            server->post_message(message.bytes, {});
+        });
+        return 0;
+    });
+    server_thread->start();
+
+    for (u32 i = 0; i < latency_round_trip_count; ++i) {
+        client.post_message(numbered_message(i, 64), {});
+        receive_messages(client, 1, [&](auto&& message) {
+            EXPECT_EQ(message_number(message.bytes), i);
+        });
+    }
+
+    (void)server_thread->join();
+}
+
+BENCHMARK_CASE(socket_transport_throughput)
+{
+    measure_throughput(false);
+}
+
+BENCHMARK_CASE(shared_memory_transport_throughput)
+{
+    measure_throughput(true);
+}
+
+BENCHMARK_CASE(socket_transport_latency)
+{
+    measure_latency(false);
+}
+
+BENCHMARK_CASE(shared_memory_transport_latency)
+{
+    measure_latency(true);
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Runtime/Realm.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/Script.h>
+#include <LibTest/TestCase.h>
+
+static void run_script(StringView source)
+{
+    static auto vm = JS::VM::create();
+
+    JS::RootExecutionContextScope root_execution_context { *vm, MUST(JS::Realm::initialize_host_defined_realm(*vm, nullptr, nullptr)) };
+
+    auto script = JS::Script::parse(source, root_execution_context.realm());
+    VERIFY(!script.is_error());
+
+    auto result = vm->bytecode_interpreter().run(script.value());
+    VERIFY(!result.is_error());
+}
+
+BENCHMARK_CASE(fill_int32_array_by_index)
+{
+    run_script(R"~~~(
+        const array = [];
+        for (let i = 0; i < 1000000; ++i)
+            array[i] = i;
+    )~~~"sv);
+}
+
+BENCHMARK_CASE(sum_int32_array)
+{
+    run_script(R"~~~(
+        const array = [];
+        for (let i = 0; i < 100000; ++i)
+            array.push(i);
+        let sum = 0;
+        for (let round = 0; round < 10; ++round) {
+            for (let i = 0; i < array.length; ++i)
+                sum += array[i];
+        }
+    )~~~"sv);
+}
+
+BENCHMARK_CASE(scale_double_array_in_place)
+{
+    run_script(R"~~~(
+        const array = [];
+        for (let i = 0; i < 100000; ++i)
+            array[i] = i * 0.5;
+        for (let round = 0; round < 10; ++round) {
+            for (let i = 0; i < array.length; ++i)
+                array[i] = array[i] * 1.5 + 0.25;
+        }
+    )~~~"sv);
+}
+
+BENCHMARK_CASE(parse_csv_rows)
+{
+    run_script(R"~~~(
+        const rows = [];
+        for (let i = 0; i < 10000; ++i)
+            rows.push(`${i},${i * 2},${i * 3},${i / 7}`);
+        const columns = [[], [], [], []];
+        for (const row of rows) {
+            const fields = row.split(",");
+            for (let i = 0; i < fields.length; ++i)
+                columns[i][columns[i].length] = Number(fields[i]);
+        }
+        const totals = columns.map(column => column.reduce((a, b) => a + b, 0));
+    )~~~"sv);
+}
+
+BENCHMARK_CASE(search_int32_array)
+{
+    run_script(R"~~~(
+        const array = [];
+        for (let i = 0; i < 10000; ++i)
+            array[i] = i;
+        let found = 0;
+        for (let i = 0; i < 1000; ++i) {
+            if (array.includes(i * 10))
+                ++found;
+            if (array.indexOf("not a number") !== -1)
+                ++found;
+        }
+    )~~~"sv);
+}
+
+BENCHMARK_CASE(sum_holey_array)
+{
+    run_script(R"~~~(
+        const array = new Array(100000);
+        for (let i = 0; i < array.length; i += 2)
+            array[i] = i;
+        let sum = 0;
+        for (let round = 0; round < 10; ++round) {
+            for (let i = 0; i < array.length; ++i)
+                sum += array[i] ?? 0;
+        }
+    )~~~"sv);
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonValue.h>
+#include <AK/StringBuilder.h>
+#include <LibJS/Runtime/JSONObject.h>
+#include <LibJS/Runtime/Realm.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibTest/TestCase.h>
+
+static ByteString const& api_response()
+{
+    static auto const response = [] {
+        StringBuilder builder;
+        builder.append("{\"items\":["sv);
+        for (size_t i = 0; i < 20000; ++i) {
+            if (i != 0)
+                builder.append(',');
+            builder.appendff(R"~~~({{"id":{},"name":"Item number {}","price":{}.{},"tags":["red","green","blue"],"in_stock":{},"supplier":{{"id":{},"country":"NO"}}}})~~~",
+                i, i, i % 1000, i % 100, i % 2 == 0 ? "true"sv : "false"sv, i % 50);
+        }
+        builder.append("]}"sv);
+        return builder.to_byte_string();
+    }();
+    return response;
+}
+
+template<typename Callback>
+static void with_realm(Callback callback)
+{
+    static auto vm = JS::VM::create();
+
+    JS::RootExecutionContextScope root_execution_context { *vm, MUST(JS::Realm::initialize_host_defined_realm(*vm, nullptr, nullptr)) };
+
+    callback(*vm);
+}
+
+BENCHMARK_CASE(parse_directly_into_js_values)
+{
+    with_realm([](JS::VM& vm) {
+        auto result = JS::JSONObject::parse_json(vm, api_response());
+        EXPECT(!result.is_error());
+    });
+}
+
+BENCHMARK_CASE(parse_through_ak_json_value)
+{
+    with_realm([](JS::VM& vm) {
+        auto json = JsonValue::from_string(api_response());
+        EXPECT(!json.is_error());
+        auto result = JS::JSONObject::parse_json_value(vm, json.value());
+        EXPECT(result.is_object());
+    });
+}
+
+BENCHMARK_CASE(stringify_records_with_the_same_shape)
+{
+    with_realm([](JS::VM& vm) {
+        auto value = MUST(JS::JSONObject::parse_json(vm, api_response()));
+        for (size_t i = 0; i < 5; ++i) {
+            auto result = JS::JSONObject::stringify_impl(vm, value, JS::js_undefined(), JS::js_undefined());
+            EXPECT(!result.is_error());
+        }
+    });
+}
@@ -1296,3 +1296,38 @@ TEST_CASE(optimizer_repeat_offset)
         Regex<ECMA262> re("\\/?\\??#?([\\/?#]|[\\uD800-\\uDBFF]|%[c-f][0-9a-f](%[89ab][0-9a-f]){0,2}(%[89ab]?)?|%[0-9a-f]?)$"sv);
     }
 }
+
+TEST_CASE(prefilters)
+{
+    Array tests {
+        // Literal prefix search.
+        Tuple { "foo\\d+"sv, "xxxxxxxxxxxxxxxxxxxxfoxfoo12 foo3"sv, "foo12"sv },
+        Tuple { "ab"sv, "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaab"sv, "ab"sv },
+        Tuple { "(abc)x"sv, "abcabcabcabcabcabcabcabcabcx"sv, "abcx"sv },
+        Tuple { "^abc"sv, "xabc"sv, ""sv },
+        // Patterns the lazy DFA can rule out.
+        Tuple { "(a|a)*b"sv, "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"sv, ""sv },
+        Tuple { "[a-z]+@[a-z]+\\.com"sv, "me@example.org, you@example.com"sv, "you@example.com"sv },
+        Tuple { "x{2,3}y"sv, "xy xxxxy"sv, "xxxy"sv },
+        Tuple { "\\bcat\\b"sv, "concat cat"sv, "cat"sv },
+    };
+
+    for (auto& test : tests) {
+        Regex<ECMA262> re(test.get<0>());
+        auto result = re.match(test.get<1>());
+        EXPECT_EQ(result.success, !test.get<2>().is_empty());
+        if (result.success)
+            EXPECT_EQ(result.matches.at(0).view, test.get<2>());
+    }
+
+    {
+        Regex<ECMA262> re("ab+"sv, ECMAScriptFlags::Global);
+        auto result = re.match("ab xabbb abb"sv);
+        EXPECT_EQ(result.count, 3u);
+    }
+    {
+        Regex<ECMA262> re("ab"sv, ECMAScriptFlags::Insensitive);
+        auto result = re.match("xxxxAB"sv);
+        EXPECT_EQ(result.success, true);
+    }
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <AK/Time.h>
+#include <LibTest/TestCase.h>
+#include <LibThreading/Mutex.h>
+#include <LibThreading/ThreadPool.h>
+#include <unistd.h>
+
+using namespace AK::TimeLiterals;
+
+static void wait_until(Function<bool()> condition)
+{
+    static constexpr auto delay = 5_ms;
+
+    for (auto i = 0; i < 400; ++i) {
+        if (condition())
+            return;
+
+        usleep(delay.to_microseconds());
+    }
+
+    FAIL("Timed out waiting for thread pool");
+}
+
+// Occupies the (single) worker thread of a pool until released, so that jobs queue up behind it.
+class BlockingJob {
+public:
+    void submit_to(Threading::ThreadPool& pool)
+    {
+        pool.submit(0, Threading::ThreadPool::Priority::High, [this] {
+            m_started.store(true);
+            while (!m_released.load())
+                usleep(1000);
+        });
+        wait_until([this] { return m_started.load(); });
+    }
+
+    void release() { m_released.store(true); }
+
+private:
+    Atomic<bool> m_started { false };
+    Atomic<bool> m_released { false };
+};
+
+TEST_CASE(runs_all_jobs)
+{
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<int> completed_jobs = 0;
+
+    Threading::ThreadPool pool(4, "TestPool"sv);
+    for (size_t i = 0; i < 100; ++i)
+        pool.submit(i % 3, Threading::ThreadPool::Priority::Normal, [&] { ++completed_jobs; });
+
+    wait_until([&] { return completed_jobs.load() == 100; });
+    EXPECT_EQ(pool.queued_job_count(), 0u);
+}
+
+TEST_CASE(takes_turns_between_clients_and_prefers_higher_priority)
+{
+    IGNORE_USE_IN_ESCAPING_LAMBDA Threading::Mutex mutex;
+    IGNORE_USE_IN_ESCAPING_LAMBDA Vector<StringView> order;
+    auto record = [&](StringView name) {
+        return [&, name] {
+            Threading::MutexLocker locker(mutex);
+            order.append(name);
+        };
+    };
+
+    Threading::ThreadPool pool(1, "TestPool"sv);
+    BlockingJob blocking_job;
+    blocking_job.submit_to(pool);
+
+    pool.submit(1, Threading::ThreadPool::Priority::Normal, record("a1"sv));
+    pool.submit(1, Threading::ThreadPool::Priority::Normal, record("a2"sv));
+    pool.submit(1, Threading::ThreadPool::Priority::Normal, record("a3"sv));
+    pool.submit(2, Threading::ThreadPool::Priority::Normal, record("b1"sv));
+    pool.submit(2, Threading::ThreadPool::Priority::High, record("b-visible"sv));
+    EXPECT_EQ(pool.queued_job_count(), 5u);
+
+    blocking_job.release();
+    wait_until([&] {
+        Threading::MutexLocker locker(mutex);
+        return order.size() == 5;
+    });
+
+    EXPECT_EQ(order, (Vector { "b-visible"sv, "a1"sv, "b1"sv, "a2"sv, "a3"sv }));
+}
+
+TEST_CASE(queued_jobs_can_be_taken_back)
+{
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<int> completed_jobs = 0;
+
+    Threading::ThreadPool pool(1, "TestPool"sv);
+    BlockingJob blocking_job;
+    blocking_job.submit_to(pool);
+
+    auto job_to_keep = pool.submit(1, Threading::ThreadPool::Priority::Normal, [&] { ++completed_jobs; });
+    auto job_to_take = pool.submit(1, Threading::ThreadPool::Priority::Normal, [&] { completed_jobs += 100; });
+
+    auto taken_job = pool.take_queued_job(job_to_take);
+    EXPECT(taken_job.has_value());
+    EXPECT(!pool.take_queued_job(job_to_take).has_value());
+    EXPECT_EQ(pool.queued_job_count(), 1u);
+
+    blocking_job.release();
+    wait_until([&] { return completed_jobs.load() == 1; });
+
+    // The job has already run, so it can no longer be taken back.
+    EXPECT(!pool.take_queued_job(job_to_keep).has_value());
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include "TestCompiledFunctionCommon.h"
+#include <LibTest/TestCase.h>
+
+// These run integer compute kernels once compiled and once in the bytecode interpreter, to compare the two.
+
+static constexpr i32 iteration_count = 1 * MiB;
+
+// Runs a function of type [i32] -> [i32] with two extra i32 locals.
+static void run_kernel(ReadonlyBytes body, Compilation compilation)
+{
+    auto module_bytes = module_with_function(2, body);
+    auto result = run_function(module_bytes, iteration_count, compilation);
+    VERIFY(!result.is_trap());
+    AK::taint_for_optimizer(result);
+}
+
+// A xorshift random number generator, the kind of loop that hashing and noise generation code spends its time in:
+// local.set 1 (i32.const 1)
+// block
+//   loop
+//     local.get 0, i32.eqz, br_if 1
+//     local.get 1, local.get 1, i32.const 13, i32.shl, i32.xor, local.set 1
+//     local.get 1, local.get 1, i32.const 17, i32.shr_u, i32.xor, local.set 1
+//     local.get 1, local.get 1, i32.const 5, i32.shl, i32.xor, local.set 1
+//     local.get 0, i32.const 1, i32.sub, local.set 0
+//     br 0
+//   end
+// end
+// local.get 1
+static constexpr u8 xorshift_body[] = {
+    0x41, 0x01, 0x21, 0x01,
+    0x02, 0x40,
+    0x03, 0x40,
+    0x20, 0x00, 0x45, 0x0d, 0x01,
+    0x20, 0x01, 0x20, 0x01, 0x41, 0x0d, 0x74, 0x73, 0x21, 0x01,
+    0x20, 0x01, 0x20, 0x01, 0x41, 0x11, 0x76, 0x73, 0x21, 0x01,
+    0x20, 0x01, 0x20, 0x01, 0x41, 0x05, 0x74, 0x73, 0x21, 0x01,
+    0x20, 0x00, 0x41, 0x01, 0x6b, 0x21, 0x00,
+    0x0c, 0x00,
+    0x0b,
+    0x0b,
+    0x20, 0x01, 0x0b
+};
+
+BENCHMARK_CASE(xorshift_compiled)
+{
+    run_kernel({ xorshift_body, sizeof(xorshift_body) }, Compilation::Enabled);
+}
+
+BENCHMARK_CASE(xorshift_interpreted)
+{
+    run_kernel({ xorshift_body, sizeof(xorshift_body) }, Compilation::Disabled);
+}
+
+// A running dot product of two counters, which is what matrix and filter kernels reduce to once their loads are hoisted:
+// block
+//   loop
+//     local.get 0, i32.eqz, br_if 1
+//     local.get 2, local.get 0, local.get 1, i32.mul, i32.add, local.set 2
+//     local.get 1, i32.const 3, i32.add, local.set 1
+//     local.get 0, i32.const 1, i32.sub, local.set 0
+//     br 0
+//   end
+// end
+// local.get 2
+static constexpr u8 multiply_accumulate_body[] = {
+    0x02, 0x40,
+    0x03, 0x40,
+    0x20, 0x00, 0x45, 0x0d, 0x01,
+    0x20, 0x02, 0x20, 0x00, 0x20, 0x01, 0x6c, 0x6a, 0x21, 0x02,
+    0x20, 0x01, 0x41, 0x03, 0x6a, 0x21, 0x01,
+    0x20, 0x00, 0x41, 0x01, 0x6b, 0x21, 0x00,
+    0x0c, 0x00,
+    0x0b,
+    0x0b,
+    0x20, 0x02, 0x0b
+};
+
+BENCHMARK_CASE(multiply_accumulate_compiled)
+{
+    run_kernel({ multiply_accumulate_body, sizeof(multiply_accumulate_body) }, Compilation::Enabled);
+}
+
+BENCHMARK_CASE(multiply_accumulate_interpreted)
+{
+    run_kernel({ multiply_accumulate_body, sizeof(multiply_accumulate_body) }, Compilation::Disabled);
+}
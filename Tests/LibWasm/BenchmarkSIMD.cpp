@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Random.h>
+#include <AK/Vector.h>
+#include <LibTest/TestCase.h>
+#include <LibWasm/AbstractMachine/Operators.h>
+
+// These run the v128 operators the way the inner loops of image and audio codecs compiled to Wasm use them.
+
+static constexpr size_t vector_count = 64 * KiB;
+static constexpr size_t iteration_count = 64;
+
+static Vector<u128> const& input_vectors()
+{
+    static auto vectors = [] {
+        Vector<u128> vectors;
+        vectors.resize(vector_count);
+        fill_with_random({ vectors.data(), vectors.size() * sizeof(u128) });
+        return vectors;
+    }();
+    return vectors;
+}
+
+template<typename Op>
+static void run_binary_kernel()
+{
+    auto const& input = input_vectors();
+    Vector<u128> output;
+    output.resize(vector_count - 1);
+
+    Op op;
+    for (size_t iteration = 0; iteration < iteration_count; ++iteration) {
+        for (size_t i = 0; i < output.size(); ++i)
+            output[i] = op(input[i], input[i + 1]);
+    }
+    AK::taint_for_optimizer(output);
+}
+
+template<typename Op>
+static void run_unary_kernel()
+{
+    auto const& input = input_vectors();
+    Vector<u128> output;
+    output.resize(vector_count);
+
+    Op op;
+    for (size_t iteration = 0; iteration < iteration_count; ++iteration) {
+        for (size_t i = 0; i < output.size(); ++i)
+            output[i] = op(input[i]);
+    }
+    AK::taint_for_optimizer(output);
+}
+
+// Mixing two 16-bit sample streams.
+BENCHMARK_CASE(i16x8_add_sat_s)
+{
+    run_binary_kernel<Wasm::Operators::VectorIntegerBinaryOp<8, Wasm::Operators::SaturatingOp<i16, Wasm::Operators::Add>, MakeSigned>>();
+}
+
+// Subtracting a prediction from 8-bit pixels.
+BENCHMARK_CASE(u8x16_sub_sat_u)
+{
+    run_binary_kernel<Wasm::Operators::VectorIntegerBinaryOp<16, Wasm::Operators::SaturatingOp<u8, Wasm::Operators::Subtract>, MakeUnsigned>>();
+}
+
+// Clamping filtered samples back into 8-bit pixels.
+BENCHMARK_CASE(i16x8_narrow_to_u8x16)
+{
+    run_binary_kernel<Wasm::Operators::VectorNarrow<16, u8>>();
+}
+
+// The multiply-accumulate step of an inverse DCT.
+BENCHMARK_CASE(i32x4_dot_i16x8_s)
+{
+    run_binary_kernel<Wasm::Operators::VectorDotProduct<4>>();
+}
+
+// Widening pixels before filtering them.
+BENCHMARK_CASE(i16x8_extmul_low_i8x16_u)
+{
+    run_binary_kernel<Wasm::Operators::VectorIntegerExtOp<8, Wasm::Operators::Multiply, Wasm::Operators::VectorExt::Low, MakeUnsigned>>();
+}
+
+BENCHMARK_CASE(i16x8_extadd_pairwise_i8x16_u)
+{
+    run_unary_kernel<Wasm::Operators::VectorIntegerExtOpPairwise<8, Wasm::Operators::Add, MakeUnsigned>>();
+}
+
+// Comparing blocks for motion estimation.
+BENCHMARK_CASE(i8x16_eq)
+{
+    run_binary_kernel<Wasm::Operators::VectorCmpOp<16, Wasm::Operators::Equals>>();
+}
+
+BENCHMARK_CASE(f32x4_mul)
+{
+    run_binary_kernel<Wasm::Operators::VectorFloatBinaryOp<4, Wasm::Operators::Multiply>>();
+}
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include "TestCompiledFunctionCommon.h"
+#include <LibTest/TestCase.h>
+
+// These run small functions both compiled and in the bytecode interpreter, and check that both get the expected result.
+// Each one exercises a case where the compiler avoids copying values around, and has to get it right when it can't.
+// The types the functions use are listed in TestCompiledFunctionCommon.h.
+
+static i32 run(ReadonlyBytes module_bytes, i32 argument, Compilation compilation)
+{
+    auto result = run_function(module_bytes, argument, compilation);
+    VERIFY(!result.is_trap());
+    VERIFY(result.values().size() == 1);
+    return result.values().first().to<i32>();
+}
+
+static void expect_result(ReadonlyBytes module_bytes, i32 argument, i32 expected_result)
+{
+    EXPECT_EQ(run(module_bytes, argument, Compilation::Enabled), expected_result);
+    EXPECT_EQ(run(module_bytes, argument, Compilation::Disabled), expected_result);
+}
+
+TEST_CASE(local_tee_while_local_is_on_the_stack)
+{
+    // local.get 0, local.get 0, i32.const 1, i32.add, local.tee 0, i32.sub
+    // The first operand still has to read the old value of the local, even though the sum is computed into it.
+    u8 const body[] = { 0x20, 0x00, 0x20, 0x00, 0x41, 0x01, 0x6a, 0x22, 0x00, 0x6b, 0x0b };
+    auto module = module_with_function(0, body);
+    expect_result(module, 5, -1);
+    expect_result(module, -20, -1);
+}
+
+TEST_CASE(local_set_of_computed_value_while_local_is_on_the_stack)
+{
+    // local.get 0, local.get 0, i32.const 5, i32.mul, local.set 0, local.get 0, i32.add
+    u8 const body[] = { 0x20, 0x00, 0x20, 0x00, 0x41, 0x05, 0x6c, 0x21, 0x00, 0x20, 0x00, 0x6a, 0x0b };
+    auto module = module_with_function(0, body);
+    expect_result(module, 3, 18);
+    expect_result(module, -2, -12);
+}
+
+TEST_CASE(local_set_of_constant_while_local_is_on_the_stack)
+{
+    // local.get 0, i32.const 10, local.set 0, local.get 0, i32.mul
+    u8 const body[] = { 0x20, 0x00, 0x41, 0x0a, 0x21, 0x00, 0x20, 0x00, 0x6c, 0x0b };
+    auto module = module_with_function(0, body);
+    expect_result(module, 7, 70);
+}
+
+TEST_CASE(fused_comparison_at_loop_start)
+{
+    // Sums up 1 to n:
+    // block
+    //   loop
+    //     local.get 0, i32.eqz, br_if 1
+    //     local.get 1, local.get 0, i32.add, local.set 1
+    //     local.get 0, i32.const 1, i32.sub, local.set 0
+    //     br 0
+    //   end
+    // end
+    // local.get 1
+    u8 const body[] = {
+        0x02, 0x40,
+        0x03, 0x40,
+        0x20, 0x00, 0x45, 0x0d, 0x01,
+        0x20, 0x01, 0x20, 0x00, 0x6a, 0x21, 0x01,
+        0x20, 0x00, 0x41, 0x01, 0x6b, 0x21, 0x00,
+        0x0c, 0x00,
+        0x0b,
+        0x0b,
+        0x20, 0x01, 0x0b
+    };
+    auto module = module_with_function(1, body);
+    expect_result(module, 0, 0);
+    expect_result(module, 1, 1);
+    expect_result(module, 100, 5050);
+}
+
+TEST_CASE(comparison_before_loop_is_not_fused_into_loop)
+{
+    // Counts the steps it takes for x to reach 5. The comparison is passed into the loop as its parameter, so it can't
+    // be fused with the br_if at the start of the loop; the back edge has to recompute it.
+    // block
+    //   local.get 0, i32.const 5, i32.ge_s
+    //   loop (type 2)
+    //     br_if 1
+    //     local.get 1, i32.const 1, i32.add, local.set 1
+    //     local.get 0, i32.const 1, i32.add, local.tee 0
+    //     i32.const 5, i32.ge_s
+    //     br 0
+    //   end
+    // end
+    // local.get 1
+    u8 const body[] = {
+        0x02, 0x40,
+        0x20, 0x00, 0x41, 0x05, 0x4e,
+        0x03, 0x02,
+        0x0d, 0x01,
+        0x20, 0x01, 0x41, 0x01, 0x6a, 0x21, 0x01,
+        0x20, 0x00, 0x41, 0x01, 0x6a, 0x22, 0x00,
+        0x41, 0x05, 0x4e,
+        0x0c, 0x00,
+        0x0b,
+        0x0b,
+        0x20, 0x01, 0x0b
+    };
+    auto module = module_with_function(1, body);
+    expect_result(module, 0, 5);
+    expect_result(module, 3, 2);
+    expect_result(module, 7, 0);
+}
+
+TEST_CASE(multi_value_block_br_if)
+{
+    // block (type 1)
+    //   local.get 0, i32.const 100, local.get 0, br_if 0
+    //   drop, drop, i32.const 7, i32.const 8
+    // end
+    // i32.sub
+    // Both values the branch carries are read from elsewhere (a local and a constant), so it has to copy them first.
+    u8 const body[] = {
+        0x02, 0x01,
+        0x20, 0x00, 0x41, 0xe4, 0x00, 0x20, 0x00, 0x0d, 0x00,
+        0x1a, 0x1a, 0x41, 0x07, 0x41, 0x08,
+        0x0b,
+        0x6b, 0x0b
+    };
+    auto module = module_with_function(0, body);
+    expect_result(module, 5, -95);
+    expect_result(module, 0, -1);
+}
+
+TEST_CASE(multi_value_block_br_table)
+{
+    // block (type 1)
+    //   block (type 1)
+    //     block (type 1)
+    //       i32.const 10, local.get 0, local.get 0
+    //       br_table 0 1 2 2
+    //     end
+    //     i32.add, i32.const 1, br 1
+    //   end
+    //   i32.mul, i32.const 2
+    // end
+    // i32.const 100, i32.mul, i32.add
+    u8 const body[] = {
+        0x02, 0x01,
+        0x02, 0x01,
+        0x02, 0x01,
+        0x41, 0x0a, 0x20, 0x00, 0x20, 0x00,
+        0x0e, 0x03, 0x00, 0x01, 0x02, 0x02,
+        0x0b,
+        0x6a, 0x41, 0x01, 0x0c, 0x01,
+        0x0b,
+        0x6c, 0x41, 0x02,
+        0x0b,
+        0x41, 0xe4, 0x00, 0x6c, 0x6a, 0x0b
+    };
+    auto module = module_with_function(0, body);
+    expect_result(module, 0, 110);
+    expect_result(module, 1, 210);
+    expect_result(module, 3, 310);
+    expect_result(module, 9, 910);
+}
+
+TEST_CASE(multi_value_loop_br_if)
+{
+    // Computes the nth Fibonacci number, passing the pair along as the loop's parameters:
+    // i32.const 0, i32.const 1
+    // loop (type 3)
+    //   local.set 2, local.set 1
+    //   local.get 2, local.get 1, local.get 2, i32.add
+    //   local.get 0, i32.const 1, i32.sub, local.tee 0
+    //   br_if 0
+    // end
+    // drop
+    u8 const body[] = {
+        0x41, 0x00, 0x41, 0x01,
+        0x03, 0x03,
+        0x21, 0x02, 0x21, 0x01,
+        0x20, 0x02, 0x20, 0x01, 0x20, 0x02, 0x6a,
+        0x20, 0x00, 0x41, 0x01, 0x6b, 0x22, 0x00,
+        0x0d, 0x00,
+        0x0b,
+        0x1a, 0x0b
+    };
+    auto module = module_with_function(2, body);
+    expect_result(module, 1, 1);
+    expect_result(module, 2, 1);
+    expect_result(module, 10, 55);
+}
+
+TEST_CASE(instances_share_compiled_functions)
+{
+    // local.get 0, i32.const 1, i32.add
+    u8 const body[] = { 0x20, 0x00, 0x41, 0x01, 0x6a, 0x0b };
+    auto module_bytes = module_with_function(0, body);
+    FixedMemoryStream stream { module_bytes.span() };
+    auto module = MUST(Wasm::Module::parse(stream));
+
+    Wasm::AbstractMachine machine;
+    auto compiled_function_of = [&](Wasm::ModuleInstance const& instance) {
+        return machine.store().get(instance.functions().first())->get<Wasm::WasmFunction>().compiled_function();
+    };
+    auto first_instance = MUST(machine.instantiate(*module, {}));
+    auto second_instance = MUST(machine.instantiate(*module, {}));
+    EXPECT_NE(compiled_function_of(*first_instance), nullptr);
+    EXPECT_EQ(compiled_function_of(*second_instance), compiled_function_of(*first_instance));
+
+    // Another machine instantiating the same module reuses what the first one compiled.
+    Wasm::AbstractMachine other_machine;
+    auto other_instance = MUST(other_machine.instantiate(*module, {}));
+    EXPECT_EQ(other_machine.store().get(other_instance->functions().first())->get<Wasm::WasmFunction>().compiled_function(), compiled_function_of(*first_instance));
+}
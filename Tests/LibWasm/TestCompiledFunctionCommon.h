@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Function.h>
+#include <AK/MemoryStream.h>
+#include <AK/Vector.h>
+#include <LibWasm/AbstractMachine/AbstractMachine.h>
+#include <LibWasm/Types.h>
+
+enum class Compilation {
+    Enabled,
+    Disabled,
+};
+
+// Every function built below uses one of these types, by index:
+// 0: [i32] -> [i32]
+// 1: [] -> [i32 i32]
+// 2: [i32] -> []
+// 3: [i32 i32] -> [i32 i32]
+static constexpr u8 test_function_types[] = {
+    0x04,
+    0x60, 0x01, 0x7f, 0x01, 0x7f,
+    0x60, 0x00, 0x02, 0x7f, 0x7f,
+    0x60, 0x01, 0x7f, 0x00,
+    0x60, 0x02, 0x7f, 0x7f, 0x02, 0x7f, 0x7f
+};
+
+static inline void append_leb128(Vector<u8>& bytes, u32 value)
+{
+    do {
+        u8 byte = value & 0x7f;
+        value >>= 7;
+        if (value != 0)
+            byte |= 0x80;
+        bytes.append(byte);
+    } while (value != 0);
+}
+
+static inline void append_section(Vector<u8>& module, u8 id, ReadonlyBytes contents)
+{
+    module.append(id);
+    append_leb128(module, contents.size());
+    module.append(contents.data(), contents.size());
+}
+
+// Builds a module with the given number of functions of type 0, asking `body_for` for their bodies (locals included).
+// The size prefixes are taken from the bodies, unless `declared_size_for` says otherwise.
+static inline Vector<u8> module_with_functions(size_t function_count, Function<Vector<u8>(size_t)> const& body_for, Function<Optional<u32>(size_t)> const& declared_size_for = [](size_t) { return Optional<u32> {}; })
+{
+    Vector<u8> module { 0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00 };
+    append_section(module, 1, { test_function_types, sizeof(test_function_types) });
+
+    Vector<u8> function_section;
+    append_leb128(function_section, function_count);
+    for (size_t i = 0; i < function_count; ++i)
+        function_section.append(0x00);
+    append_section(module, 3, function_section);
+
+    Vector<u8> code_section;
+    append_leb128(code_section, function_count);
+    for (size_t i = 0; i < function_count; ++i) {
+        auto body = body_for(i);
+        append_leb128(code_section, declared_size_for(i).value_or(body.size()));
+        code_section.extend(move(body));
+    }
+    append_section(module, 10, code_section);
+    return module;
+}
+
+// Builds a module with a single function of type 0, which takes the given locals (on top of its parameter) and body.
+static inline Vector<u8> module_with_function(u8 extra_i32_local_count, ReadonlyBytes body)
+{
+    return module_with_functions(1, [&](size_t) {
+        Vector<u8> code;
+        if (extra_i32_local_count > 0)
+            code.extend({ 0x01, extra_i32_local_count, 0x7f });
+        else
+            code.append(0x00);
+        code.append(body.data(), body.size());
+        return code;
+    });
+}
+
+// Calls the module's only function with the given argument, and returns the result.
+static inline Wasm::Result run_function(ReadonlyBytes module_bytes, i32 argument, Compilation compilation)
+{
+    FixedMemoryStream stream { module_bytes };
+    auto module = MUST(Wasm::Module::parse(stream));
+
+    Wasm::AbstractMachine machine;
+    if (compilation == Compilation::Disabled)
+        machine.disable_function_compilation();
+    auto instance = MUST(machine.instantiate(*module, {}));
+
+    auto address = instance->functions().first();
+    auto& function = machine.store().get(address)->get<Wasm::WasmFunction>();
+    VERIFY((function.compiled_function() != nullptr) == (compilation == Compilation::Enabled));
+
+    return machine.invoke(address, { Wasm::Value(argument) });
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+#include <LibWasm/AbstractMachine/AbstractMachine.h>
+
+static constexpr size_t page_size = Wasm::Constants::page_size;
+
+TEST_CASE(growing_keeps_contents_and_zeroes_new_pages)
+{
+    auto memory = MUST(Wasm::MemoryInstance::create(Wasm::MemoryType { Wasm::Limits(1) }));
+    memory.data()[0] = 0x12;
+    memory.data()[page_size - 1] = 0x34;
+
+    EXPECT(memory.grow(3 * page_size));
+    EXPECT_EQ(memory.size(), 4 * page_size);
+    EXPECT_EQ(memory.data()[0], 0x12);
+    EXPECT_EQ(memory.data()[page_size - 1], 0x34);
+    for (size_t i = page_size; i < memory.size(); ++i) {
+        if (memory.data()[i] != 0) {
+            FAIL("Grown memory was not zeroed");
+            break;
+        }
+    }
+}
+
+TEST_CASE(growing_a_page_at_a_time_moves_the_memory_logarithmically_often)
+{
+    auto memory = MUST(Wasm::MemoryInstance::create(Wasm::MemoryType { Wasm::Limits(1) }));
+
+    size_t move_count = 0;
+    auto const* data = memory.data().data();
+    for (size_t page_count = 1; page_count < 1024; ++page_count) {
+        EXPECT(memory.grow(page_size));
+        if (memory.data().data() != data) {
+            data = memory.data().data();
+            ++move_count;
+        }
+    }
+    EXPECT_EQ(memory.size(), 1024 * page_size);
+    EXPECT(move_count <= 10);
+}
+
+TEST_CASE(capacity_is_capped_at_the_maximum)
+{
+    auto memory = MUST(Wasm::MemoryInstance::create(Wasm::MemoryType { Wasm::Limits(1, 3) }));
+    EXPECT(memory.grow(page_size));
+    EXPECT(memory.grow(page_size));
+    EXPECT_EQ(memory.size(), 3 * page_size);
+    EXPECT(memory.data().capacity() <= 3 * page_size);
+    EXPECT(!memory.grow(page_size));
+}
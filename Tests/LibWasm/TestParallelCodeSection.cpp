@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include "TestCompiledFunctionCommon.h"
+#include <AK/NumericLimits.h>
+#include <AK/ScopeGuard.h>
+#include <LibTest/TestCase.h>
+#include <LibWasm/AbstractMachine/Validator.h>
+#include <LibWasm/Parallel.h>
+
+// These parse, validate and run the same modules once with every code section processed in parallel and once with all
+// of them processed sequentially, and check that both ways get the same results and report the same errors.
+
+static constexpr size_t function_count = 300;
+
+enum class Processing {
+    Sequential,
+    Parallel,
+};
+
+template<typename Callback>
+static auto with_processing(Processing processing, Callback callback)
+{
+    Wasm::set_minimum_code_size_for_parallel_processing(processing == Processing::Parallel ? 0 : NumericLimits<size_t>::max());
+    ScopeGuard restore_default = [] { Wasm::set_minimum_code_size_for_parallel_processing({}); };
+    return callback();
+}
+
+// local.get 0, i32.const (index % 64), i32.add
+static Vector<u8> valid_body(size_t index)
+{
+    return { 0x00, 0x20, 0x00, 0x41, static_cast<u8>(index % 64), 0x6a, 0x0b };
+}
+
+static Wasm::ParseResult<NonnullRefPtr<Wasm::Module>> parse(ReadonlyBytes module_bytes, Processing processing)
+{
+    return with_processing(processing, [&] {
+        FixedMemoryStream stream { module_bytes };
+        return Wasm::Module::parse(stream);
+    });
+}
+
+static Wasm::ParseError parse_error(ReadonlyBytes module_bytes, Processing processing)
+{
+    auto result = parse(module_bytes, processing);
+    VERIFY(result.is_error());
+    return result.error();
+}
+
+static ByteString validation_error(ReadonlyBytes module_bytes, Processing processing)
+{
+    auto module = MUST(parse(module_bytes, processing));
+    return with_processing(processing, [&] {
+        Wasm::AbstractMachine machine;
+        auto result = machine.validate(*module);
+        VERIFY(result.is_error());
+        return result.error().error_string;
+    });
+}
+
+TEST_CASE(valid_module)
+{
+    auto module_bytes = module_with_functions(function_count, valid_body);
+
+    auto sequential_module = MUST(parse(module_bytes, Processing::Sequential));
+    auto parallel_module = MUST(parse(module_bytes, Processing::Parallel));
+
+    auto& sequential_functions = sequential_module->code_section().functions();
+    auto& parallel_functions = parallel_module->code_section().functions();
+    EXPECT_EQ(sequential_functions.size(), function_count);
+    EXPECT_EQ(parallel_functions.size(), function_count);
+    for (size_t i = 0; i < function_count; ++i) {
+        EXPECT_EQ(parallel_functions[i].size(), sequential_functions[i].size());
+        auto& sequential_instructions = sequential_functions[i].func().body().instructions();
+        auto& parallel_instructions = parallel_functions[i].func().body().instructions();
+        EXPECT_EQ(parallel_instructions.size(), sequential_instructions.size());
+        for (size_t j = 0; j < min(parallel_instructions.size(), sequential_instructions.size()); ++j)
+            EXPECT_EQ(parallel_instructions[j].opcode(), sequential_instructions[j].opcode());
+    }
+
+    with_processing(Processing::Parallel, [&] {
+        Wasm::AbstractMachine machine;
+        auto instance = MUST(machine.instantiate(*parallel_module, {}));
+        for (size_t i : { 0u, 150u, 299u }) {
+            auto result = machine.invoke(instance->functions()[i], { Wasm::Value(1000) });
+            VERIFY(!result.is_trap());
+            EXPECT_EQ(result.values().first().to<i32>(), static_cast<i32>(1000 + i % 64));
+        }
+    });
+}
+
+TEST_CASE(function_body_shorter_than_its_declared_size)
+{
+    // A nop after the end of the body, which the size prefix includes.
+    auto module_bytes = module_with_functions(function_count, [](size_t index) {
+        auto body = valid_body(index);
+        if (index == 120)
+            body.append(0x01);
+        return body;
+    });
+
+    EXPECT_EQ(parse_error(module_bytes, Processing::Sequential), Wasm::ParseError::SectionSizeMismatch);
+    EXPECT_EQ(parse_error(module_bytes, Processing::Parallel), Wasm::ParseError::SectionSizeMismatch);
+}
+
+TEST_CASE(function_body_longer_than_its_declared_size)
+{
+    // The size prefix leaves out the body's end.
+    auto module_bytes = module_with_functions(function_count, valid_body, [](size_t index) -> Optional<u32> {
+        if (index == 120)
+            return valid_body(index).size() - 1;
+        return {};
+    });
+
+    EXPECT_EQ(parse_error(module_bytes, Processing::Parallel), parse_error(module_bytes, Processing::Sequential));
+}
+
+TEST_CASE(lowest_index_parse_error_wins)
+{
+    // An invalid local type in function 40, and a reserved opcode in function 200.
+    auto body_with_errors = [](Vector<size_t> broken_functions) {
+        return [broken_functions = move(broken_functions)](size_t index) -> Vector<u8> {
+            if (index == 40 && broken_functions.contains_slow(40))
+                return { 0x01, 0x01, 0x00, 0x20, 0x00, 0x0b };
+            if (index == 200 && broken_functions.contains_slow(200))
+                return { 0x00, 0x27, 0x0b };
+            return valid_body(index);
+        };
+    };
+    auto module_bytes = module_with_functions(function_count, body_with_errors({ 40, 200 }));
+    auto first_error_only = module_with_functions(function_count, body_with_errors({ 40 }));
+    auto last_error_only = module_with_functions(function_count, body_with_errors({ 200 }));
+
+    auto expected_error = parse_error(first_error_only, Processing::Sequential);
+    EXPECT_NE(expected_error, parse_error(last_error_only, Processing::Sequential));
+    EXPECT_EQ(parse_error(module_bytes, Processing::Sequential), expected_error);
+    for (size_t run = 0; run < 10; ++run)
+        EXPECT_EQ(parse_error(module_bytes, Processing::Parallel), expected_error);
+}
+
+TEST_CASE(lowest_index_validation_error_wins)
+{
+    // Function 30 returns an i64, and function 250 reads a local it doesn't have.
+    auto body_with_errors = [](Vector<size_t> broken_functions) {
+        return [broken_functions = move(broken_functions)](size_t index) -> Vector<u8> {
+            if (index == 30 && broken_functions.contains_slow(30))
+                return { 0x00, 0x42, 0x01, 0x0b };
+            if (index == 250 && broken_functions.contains_slow(250))
+                return { 0x00, 0x20, 0x05, 0x0b };
+            return valid_body(index);
+        };
+    };
+    auto module_bytes = module_with_functions(function_count, body_with_errors({ 30, 250 }));
+    auto first_error_only = module_with_functions(function_count, body_with_errors({ 30 }));
+    auto last_error_only = module_with_functions(function_count, body_with_errors({ 250 }));
+
+    auto expected_error = validation_error(first_error_only, Processing::Sequential);
+    EXPECT_NE(expected_error, validation_error(last_error_only, Processing::Sequential));
+    EXPECT_EQ(validation_error(module_bytes, Processing::Sequential), expected_error);
+    for (size_t run = 0; run < 10; ++run)
+        EXPECT_EQ(validation_error(module_bytes, Processing::Parallel), expected_error);
+}
+
+TEST_CASE(every_function_failing_validation)
+{
+    // i64.const 1, i64.const 1, i32.add
+    // Every worker reports an error naming the same instruction at the same time.
+    auto module_bytes = module_with_functions(function_count, [](size_t) -> Vector<u8> {
+        return { 0x00, 0x42, 0x01, 0x42, 0x01, 0x6a, 0x0b };
+    });
+
+    auto expected_error = validation_error(module_bytes, Processing::Sequential);
+    for (size_t run = 0; run < 10; ++run)
+        EXPECT_EQ(validation_error(module_bytes, Processing::Parallel), expected_error);
+}
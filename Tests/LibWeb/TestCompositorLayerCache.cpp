@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/ImmutableBitmap.h>
+#include <LibGfx/PaintingSurface.h>
+#include <LibTest/TestCase.h>
+#include <LibWeb/Painting/CompositorLayerCache.h>
+#include <LibWeb/Painting/DisplayList.h>
+#include <LibWeb/Painting/DisplayListPlayerSkia.h>
+#include <LibWeb/Painting/TiledRasterizer.h>
+
+namespace Web::Painting {
+
+static constexpr u64 layer_id = 1;
+
+// A layer straddling the tile boundaries, so the tiled rasterizer paints it from several threads at once.
+static Gfx::IntRect const layer_rect { TiledRasterizer::tile_size - 100, TiledRasterizer::tile_size - 80, 200, 160 };
+
+static NonnullRefPtr<DisplayList> layer_content(Color color)
+{
+    auto display_list = DisplayList::create();
+    display_list->set_device_pixels_per_css_pixel(1);
+    display_list->append(FillRect { layer_rect, color }, {});
+    display_list->append(FillRect { layer_rect.shrunken(40, 40), Color::White }, {});
+    return display_list;
+}
+
+// A page with a background, and the layer translated by the given offset, like an element with an animated transform.
+static NonnullRefPtr<DisplayList> page_with_layer(Gfx::IntPoint offset, NonnullRefPtr<DisplayList> content)
+{
+    auto display_list = DisplayList::create();
+    display_list->set_device_pixels_per_css_pixel(1);
+    display_list->append(FillRect { { 0, 0, 2 * TiledRasterizer::tile_size, 2 * TiledRasterizer::tile_size }, Color::Blue }, {});
+    display_list->append(Save {}, {});
+    display_list->append(Translate { offset }, {});
+    display_list->append(PaintCompositorLayer { .layer_id = layer_id, .display_list = move(content) }, {});
+    display_list->append(Restore {}, {});
+    return display_list;
+}
+
+static NonnullRefPtr<Gfx::Bitmap> create_bitmap()
+{
+    return MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, { 2 * TiledRasterizer::tile_size, 2 * TiledRasterizer::tile_size }));
+}
+
+static NonnullRefPtr<Gfx::Bitmap> render_without_cache(DisplayList& display_list)
+{
+    auto bitmap = create_bitmap();
+    DisplayListPlayerSkia player;
+    player.execute(display_list, {}, Gfx::PaintingSurface::wrap_bitmap(bitmap));
+    return bitmap;
+}
+
+static NonnullRefPtr<Gfx::Bitmap> render_tiled(DisplayList& display_list, CompositorLayerCache& cache)
+{
+    auto bitmap = create_bitmap();
+    TiledRasterizer rasterizer;
+    rasterizer.rasterize(display_list, {}, bitmap, bitmap->rect(), &cache);
+    return bitmap;
+}
+
+// Calls find_or_rasterize() for the layer painted by the given display list, counting how often it has to rasterize.
+static Optional<CompositorLayerCache::RasterizedLayer> find_or_rasterize(CompositorLayerCache& cache, NonnullRefPtr<DisplayList> content, size_t& rasterize_count)
+{
+    PaintCompositorLayer command { .layer_id = layer_id, .display_list = move(content) };
+    return cache.find_or_rasterize(command, {}, [&](Gfx::IntRect const& rect) -> RefPtr<Gfx::ImmutableBitmap> {
+        ++rasterize_count;
+        return Gfx::ImmutableBitmap::create(MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, rect.size())));
+    });
+}
+
+TEST_CASE(unchanged_layer_is_reused)
+{
+    CompositorLayerCache cache;
+    size_t rasterize_count = 0;
+
+    auto first = find_or_rasterize(cache, layer_content(Color::Red), rasterize_count);
+    EXPECT(first.has_value());
+    EXPECT_EQ(first->rect, layer_rect);
+    EXPECT_EQ(rasterize_count, 1u);
+
+    // A new display list with the same content, as painted for the next frame.
+    auto second = find_or_rasterize(cache, layer_content(Color::Red), rasterize_count);
+    EXPECT(second.has_value());
+    EXPECT_EQ(second->bitmap.ptr(), first->bitmap.ptr());
+    EXPECT_EQ(rasterize_count, 1u);
+}
+
+TEST_CASE(changed_layer_is_rasterized_again)
+{
+    CompositorLayerCache cache;
+    size_t rasterize_count = 0;
+
+    auto first = find_or_rasterize(cache, layer_content(Color::Red), rasterize_count);
+    auto second = find_or_rasterize(cache, layer_content(Color::Green), rasterize_count);
+    EXPECT(first.has_value());
+    EXPECT(second.has_value());
+    EXPECT_NE(second->bitmap.ptr(), first->bitmap.ptr());
+    EXPECT_EQ(rasterize_count, 2u);
+}
+
+TEST_CASE(layers_no_longer_painted_are_dropped)
+{
+    CompositorLayerCache cache;
+    size_t rasterize_count = 0;
+
+    (void)find_or_rasterize(cache, layer_content(Color::Red), rasterize_count);
+    cache.retain_only_layers_in(*page_with_layer({}, layer_content(Color::Red)));
+    (void)find_or_rasterize(cache, layer_content(Color::Red), rasterize_count);
+    EXPECT_EQ(rasterize_count, 1u);
+
+    auto page_without_layer = DisplayList::create();
+    page_without_layer->append(FillRect { layer_rect, Color::Red }, {});
+    cache.retain_only_layers_in(*page_without_layer);
+    (void)find_or_rasterize(cache, layer_content(Color::Red), rasterize_count);
+    EXPECT_EQ(rasterize_count, 2u);
+}
+
+TEST_CASE(empty_and_oversized_layers_are_not_cached)
+{
+    CompositorLayerCache cache;
+    size_t rasterize_count = 0;
+
+    EXPECT(!find_or_rasterize(cache, DisplayList::create(), rasterize_count).has_value());
+
+    auto oversized_content = DisplayList::create();
+    oversized_content->append(FillRect { { 0, 0, 4097, 4096 }, Color::Red }, {});
+    EXPECT(!find_or_rasterize(cache, oversized_content, rasterize_count).has_value());
+    EXPECT_EQ(rasterize_count, 0u);
+}
+
+TEST_CASE(tiled_rasterization_matches_uncached_rendering)
+{
+    CompositorLayerCache cache;
+
+    // Move the layer around like an animation would, then change its content, checking every frame against a player
+    // that paints the layer's commands directly.
+    struct Frame {
+        Gfx::IntPoint offset;
+        Color color;
+    };
+    for (auto const& frame : { Frame { { 0, 0 }, Color::Red }, Frame { { 30, 10 }, Color::Red }, Frame { { 60, 20 }, Color::Red }, Frame { { 60, 20 }, Color::Green } }) {
+        auto display_list = page_with_layer(frame.offset, layer_content(frame.color));
+        auto tiled = render_tiled(*display_list, cache);
+        auto uncached = render_without_cache(*display_list);
+        EXPECT(tiled->visually_equals(*uncached));
+    }
+}
+
+}
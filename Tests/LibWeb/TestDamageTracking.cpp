@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+#include <LibWeb/Painting/DamageTracking.h>
+#include <LibWeb/Painting/DisplayList.h>
+
+namespace Web::Painting {
+
+static Gfx::IntRect const header_rect { 0, 0, 800, 50 };
+static Gfx::IntRect const box_rect { 100, 100, 40, 40 };
+static Gfx::IntRect const footer_rect { 0, 550, 800, 50 };
+
+static NonnullRefPtr<DisplayList> create_display_list(double device_pixels_per_css_pixel = 1)
+{
+    auto display_list = DisplayList::create();
+    display_list->set_device_pixels_per_css_pixel(device_pixels_per_css_pixel);
+    return display_list;
+}
+
+// A header and a footer that don't change, with a box in between.
+static NonnullRefPtr<DisplayList> page_with_box(Gfx::IntRect box, Color box_color = Color::Red, Optional<i32> box_scroll_frame_id = {})
+{
+    auto display_list = create_display_list();
+    display_list->append(FillRect { header_rect, Color::Blue }, {});
+    display_list->append(FillRect { box, box_color }, box_scroll_frame_id);
+    display_list->append(FillRect { footer_rect, Color::Green }, {});
+    return display_list;
+}
+
+static ScrollStateSnapshot scroll_state_with_offset(CSSPixelPoint offset)
+{
+    return ScrollStateSnapshot::create(Vector<ScrollStateSnapshot::Entry> { { offset, offset } });
+}
+
+TEST_CASE(unchanged_display_list)
+{
+    auto previous = page_with_box(box_rect);
+    auto next = page_with_box(box_rect);
+
+    auto damage = compute_damage_rect(*previous, {}, *next, {});
+    EXPECT(damage.has_value());
+    EXPECT(damage->is_empty());
+}
+
+TEST_CASE(recolored_item)
+{
+    auto previous = page_with_box(box_rect);
+    auto next = page_with_box(box_rect, Color::Yellow);
+
+    auto damage = compute_damage_rect(*previous, {}, *next, {});
+    EXPECT(damage.has_value());
+    EXPECT(damage->contains(box_rect));
+    EXPECT(!damage->intersects(header_rect));
+    EXPECT(!damage->intersects(footer_rect));
+}
+
+TEST_CASE(moved_item)
+{
+    auto moved_box_rect = box_rect.translated(200, 100);
+    auto previous = page_with_box(box_rect);
+    auto next = page_with_box(moved_box_rect);
+
+    auto damage = compute_damage_rect(*previous, {}, *next, {});
+    EXPECT(damage.has_value());
+    EXPECT(damage->contains(box_rect));
+    EXPECT(damage->contains(moved_box_rect));
+    EXPECT(!damage->intersects(header_rect));
+    EXPECT(!damage->intersects(footer_rect));
+}
+
+TEST_CASE(moved_item_under_translation)
+{
+    auto translated_page_with_box = [](Gfx::IntRect box) {
+        auto display_list = create_display_list();
+        display_list->append(Save {}, {});
+        display_list->append(Translate { { 0, 300 } }, {});
+        display_list->append(FillRect { box, Color::Red }, {});
+        display_list->append(Restore {}, {});
+        return display_list;
+    };
+    auto previous = translated_page_with_box(box_rect);
+    auto next = translated_page_with_box(box_rect.translated(10, 0));
+
+    auto damage = compute_damage_rect(*previous, {}, *next, {});
+    EXPECT(damage.has_value());
+    EXPECT(damage->contains(box_rect.translated(0, 300)));
+    EXPECT(damage->contains(box_rect.translated(10, 300)));
+    EXPECT(!damage->intersects(box_rect));
+}
+
+TEST_CASE(added_item)
+{
+    auto added_rect = Gfx::IntRect { 400, 300, 20, 20 };
+    auto previous = page_with_box(box_rect);
+    auto next = create_display_list();
+    next->append(FillRect { header_rect, Color::Blue }, {});
+    next->append(FillRect { box_rect, Color::Red }, {});
+    next->append(FillRect { added_rect, Color::Black }, {});
+    next->append(FillRect { footer_rect, Color::Green }, {});
+
+    auto damage = compute_damage_rect(*previous, {}, *next, {});
+    EXPECT(damage.has_value());
+    EXPECT(damage->contains(added_rect));
+    EXPECT(!damage->intersects(box_rect));
+    EXPECT(!damage->intersects(header_rect));
+    EXPECT(!damage->intersects(footer_rect));
+}
+
+TEST_CASE(scroll_offset_change)
+{
+    auto previous = page_with_box(box_rect, Color::Red, 0);
+    auto next = page_with_box(box_rect, Color::Red, 0);
+    auto previous_scroll_state = scroll_state_with_offset({ 0, 0 });
+    auto next_scroll_state = scroll_state_with_offset({ 0, -60 });
+
+    auto damage = compute_damage_rect(*previous, previous_scroll_state, *next, next_scroll_state);
+    EXPECT(damage.has_value());
+    EXPECT(damage->contains(box_rect));
+    EXPECT(damage->contains(box_rect.translated(0, -60)));
+    EXPECT(!damage->intersects(footer_rect));
+
+    // The same scroll offset on both sides paints the same thing.
+    damage = compute_damage_rect(*previous, next_scroll_state, *next, next_scroll_state);
+    EXPECT(damage.has_value());
+    EXPECT(damage->is_empty());
+}
+
+TEST_CASE(device_pixel_ratio_change_repaints_everything)
+{
+    auto previous = page_with_box(box_rect);
+    auto next = create_display_list(2);
+    next->append(FillRect { header_rect, Color::Blue }, {});
+    next->append(FillRect { box_rect, Color::Red }, {});
+    next->append(FillRect { footer_rect, Color::Green }, {});
+
+    EXPECT(!compute_damage_rect(*previous, {}, *next, {}).has_value());
+}
+
+TEST_CASE(added_clip_repaints_everything)
+{
+    // The clip changes how everything after it is painted, which we don't try to bound.
+    auto previous = page_with_box(box_rect);
+    auto next = create_display_list();
+    next->append(FillRect { header_rect, Color::Blue }, {});
+    next->append(Save {}, {});
+    next->append(AddClipRect { box_rect.shrunken(10, 10) }, {});
+    next->append(FillRect { box_rect, Color::Red }, {});
+    next->append(Restore {}, {});
+    next->append(FillRect { footer_rect, Color::Green }, {});
+
+    EXPECT(!compute_damage_rect(*previous, {}, *next, {}).has_value());
+}
+
+TEST_CASE(change_under_filter_repaints_everything)
+{
+    auto page_with_filtered_box = [](Color box_color) {
+        auto display_list = create_display_list();
+        display_list->append(FillRect { header_rect, Color::Blue }, {});
+        display_list->append(SaveLayer {}, {});
+        display_list->append(ApplyFilters { {} }, {});
+        display_list->append(FillRect { box_rect, box_color }, {});
+        display_list->append(Restore {}, {});
+        return display_list;
+    };
+
+    // NOTE: Filters such as blur() spread the change beyond the box, so we can't bound the damage.
+    auto previous = page_with_filtered_box(Color::Red);
+    auto next = page_with_filtered_box(Color::Yellow);
+    EXPECT(!compute_damage_rect(*previous, {}, *next, {}).has_value());
+}
+
+}
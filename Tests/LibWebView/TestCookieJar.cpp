@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <LibTest/TestCase.h>
+#include <LibURL/Parser.h>
+#include <LibWebView/CookieJar.h>
+
+static URL::URL parse_url(StringView url)
+{
+    auto parsed_url = URL::Parser::basic_parse(url);
+    VERIFY(parsed_url.has_value());
+    return parsed_url.release_value();
+}
+
+static Web::Cookie::Cookie make_cookie(String name, String domain, String path, bool host_only, AK::Duration lifetime = AK::Duration::from_seconds(3600))
+{
+    // NOTE: Give every cookie a distinct creation time, so that the order of cookies in a cookie-string is deterministic.
+    static i64 creation_order = 0;
+
+    Web::Cookie::Cookie cookie { move(name), "value"_string };
+    cookie.creation_time = UnixDateTime::now() + AK::Duration::from_nanoseconds(++creation_order);
+    cookie.last_access_time = cookie.creation_time;
+    cookie.expiry_time = cookie.creation_time + lifetime;
+    cookie.domain = move(domain);
+    cookie.path = move(path);
+    cookie.host_only = host_only;
+    cookie.persistent = true;
+    return cookie;
+}
+
+TEST_CASE(cookies_are_matched_by_host_and_parent_domains)
+{
+    auto cookie_jar = WebView::CookieJar::create();
+    cookie_jar->update_cookie(make_cookie("a"_string, "example.com"_string, "/"_string, false));
+    cookie_jar->update_cookie(make_cookie("b"_string, "www.example.com"_string, "/"_string, true));
+    cookie_jar->update_cookie(make_cookie("c"_string, "example.com"_string, "/"_string, true));
+    cookie_jar->update_cookie(make_cookie("d"_string, "other.example.com"_string, "/"_string, false));
+    cookie_jar->update_cookie(make_cookie("e"_string, "example.com"_string, "/account"_string, false));
+
+    EXPECT_EQ(cookie_jar->get_cookie(parse_url("https://www.example.com/"sv), Web::Cookie::Source::Http), "a=value; b=value"sv);
+    EXPECT_EQ(cookie_jar->get_cookie(parse_url("https://example.com/account/settings"sv), Web::Cookie::Source::Http), "e=value; a=value; c=value"sv);
+    EXPECT_EQ(cookie_jar->get_cookie(parse_url("https://deep.other.example.com/"sv), Web::Cookie::Source::Http), "a=value; d=value"sv);
+    EXPECT_EQ(cookie_jar->get_cookie(parse_url("https://notexample.com/"sv), Web::Cookie::Source::Http), ""sv);
+}
+
+TEST_CASE(expired_cookies_are_purged)
+{
+    auto cookie_jar = WebView::CookieJar::create();
+    auto url = parse_url("https://example.com/"sv);
+
+    cookie_jar->update_cookie(make_cookie("short"_string, "example.com"_string, "/"_string, true, AK::Duration::from_seconds(60)));
+    cookie_jar->update_cookie(make_cookie("long"_string, "example.com"_string, "/"_string, true, AK::Duration::from_seconds(600)));
+    EXPECT_EQ(cookie_jar->get_all_cookies().size(), 2u);
+
+    // Extending a cookie's lifetime must not let its old expiry time purge it.
+    cookie_jar->update_cookie(make_cookie("short"_string, "example.com"_string, "/"_string, true, AK::Duration::from_seconds(1200)));
+
+    cookie_jar->expire_cookies_with_time_offset(AK::Duration::from_seconds(300));
+    EXPECT_EQ(cookie_jar->get_all_cookies().size(), 2u);
+
+    cookie_jar->expire_cookies_with_time_offset(AK::Duration::from_seconds(900));
+    EXPECT_EQ(cookie_jar->get_cookie(url, Web::Cookie::Source::Http), "short=value"sv);
+
+    cookie_jar->clear_all_cookies();
+    EXPECT(cookie_jar->get_all_cookies().is_empty());
+    EXPECT_EQ(cookie_jar->get_cookie(url, Web::Cookie::Source::Http), ""sv);
+}
+
+// Roughly what a long-lived profile accumulates: 5000 sites with 10 cookies each, spread over a few subdomains.
+static constexpr size_t site_count = 5000;
+static constexpr size_t request_count = 100'000;
+
+static NonnullOwnPtr<WebView::CookieJar> create_populated_cookie_jar()
+{
+    static constexpr Array subdomains { "www"sv, "cdn"sv, "api"sv };
+    static constexpr Array paths { "/"sv, "/"sv, "/"sv, "/account"sv, "/static/images"sv };
+
+    auto cookie_jar = WebView::CookieJar::create();
+
+    for (size_t site = 0; site < site_count; ++site) {
+        auto domain = MUST(String::formatted("site{}.com", site));
+
+        for (size_t i = 0; i < 10; ++i) {
+            auto name = MUST(String::formatted("cookie{}", i));
+            auto path = MUST(String::from_utf8(paths[i % paths.size()]));
+
+            if (i % 2 == 0) {
+                cookie_jar->update_cookie(make_cookie(move(name), domain, move(path), false));
+            } else {
+                auto host = MUST(String::formatted("{}.{}", subdomains[i % subdomains.size()], domain));
+                cookie_jar->update_cookie(make_cookie(move(name), move(host), move(path), true));
+            }
+        }
+    }
+
+    return cookie_jar;
+}
+
+static Vector<URL::URL> create_request_urls()
+{
+    Vector<URL::URL> urls;
+
+    for (size_t site = 0; site < site_count; site += 50) {
+        urls.append(parse_url(MUST(String::formatted("https://www.site{}.com/index.html", site))));
+        urls.append(parse_url(MUST(String::formatted("https://cdn.site{}.com/static/images/logo.png", site))));
+        urls.append(parse_url(MUST(String::formatted("https://api.site{}.com/account/profile", site))));
+    }
+
+    return urls;
+}
+
+BENCHMARK_CASE(get_cookie_for_subresource_requests)
+{
+    auto cookie_jar = create_populated_cookie_jar();
+    auto urls = create_request_urls();
+
+    for (size_t i = 0; i < request_count; ++i)
+        (void)cookie_jar->get_cookie(urls[i % urls.size()], Web::Cookie::Source::Http);
+}
+
+BENCHMARK_CASE(update_cookies_with_new_expiry_times)
+{
+    auto cookie_jar = create_populated_cookie_jar();
+
+    for (size_t i = 0; i < request_count; ++i) {
+        auto domain = MUST(String::formatted("site{}.com", i % site_count));
+        auto lifetime = AK::Duration::from_seconds(3600 + static_cast<i64>(i));
+        cookie_jar->update_cookie(make_cookie("cookie0"_string, move(domain), "/"_string, false, lifetime));
+    }
+}
@@ -0,0 +1,322 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ScopeGuard.h>
+#include <LibCore/System.h>
+#include <LibFileSystem/FileSystem.h>
+#include <LibTest/TestCase.h>
+#include <LibURL/Parser.h>
+#include <RequestServer/DiskCache.h>
+
+using RequestServer::DiskCache;
+
+static constexpr auto partition_key = "https://example.com https://example.com"sv;
+static constexpr auto body = "Well hello friends!"sv;
+
+static ByteString create_cache_directory()
+{
+    char pattern[] = "/tmp/TestDiskCache.XXXXXX";
+    return MUST(Core::System::mkdtemp(pattern)).to_byte_string();
+}
+
+static URL::URL url_for(StringView path)
+{
+    return URL::Parser::basic_parse(ByteString::formatted("https://example.com/{}", path)).release_value();
+}
+
+static DiskCache::ResponseToStore response_for(URL::URL url, HTTP::HeaderMap headers, StringView body = ::body, AK::Duration age = {})
+{
+    // NOTE: A response without a Date header is as old as the time since it was received.
+    auto response_time = UnixDateTime::now() - age;
+
+    return DiskCache::ResponseToStore {
+        .url = move(url),
+        .partition_key = MUST(String::from_utf8(partition_key)),
+        .status_code = 200,
+        .reason_phrase = {},
+        .headers = move(headers),
+        .body = body.bytes(),
+        .request_time = response_time,
+        .response_time = response_time,
+    };
+}
+
+static HTTP::HeaderMap headers_with_cache_control(ByteString cache_control)
+{
+    HTTP::HeaderMap headers;
+    headers.set("Cache-Control", move(cache_control));
+    return headers;
+}
+
+static size_t count_headers(HTTP::HeaderMap const& headers, StringView name)
+{
+    size_t count = 0;
+    for (auto const& header : headers.headers()) {
+        if (header.name.equals_ignoring_ascii_case(name))
+            ++count;
+    }
+    return count;
+}
+
+static Optional<DiskCache::CachedResponse> open_entry(DiskCache& cache, URL::URL const& url, StringView partition_key = ::partition_key)
+{
+    return cache.open_entry("GET"sv, url, partition_key, {});
+}
+
+TEST_CASE(stored_response_is_found)
+{
+    auto directory = create_cache_directory();
+    ScopeGuard remove_directory = [&] { (void)FileSystem::remove(directory, FileSystem::RecursionMode::Allowed); };
+    auto cache = MUST(DiskCache::create(directory));
+
+    auto url = url_for("script.js"sv);
+    EXPECT(!open_entry(*cache, url).has_value());
+
+    cache->store_entry(response_for(url, headers_with_cache_control("max-age=3600")));
+
+    auto response = open_entry(*cache, url);
+    EXPECT(response.has_value());
+    EXPECT_EQ(response->status_code, 200u);
+    EXPECT_EQ(StringView { response->body->bytes() }, body);
+    EXPECT_EQ(response->headers.get("Cache-Control").value(), "max-age=3600"sv);
+    EXPECT(!response->revalidation_headers.has_value());
+
+    EXPECT(!open_entry(*cache, url_for("other.js"sv)).has_value());
+
+    EXPECT_EQ(cache->statistics().hits, 1u);
+    EXPECT_EQ(cache->statistics().misses, 2u);
+    EXPECT_EQ(cache->statistics().bytes_served, body.length());
+    EXPECT_EQ(cache->statistics().bytes_stored, body.length());
+}
+
+TEST_CASE(uncacheable_requests_bypass_the_cache)
+{
+    auto directory = create_cache_directory();
+    ScopeGuard remove_directory = [&] { (void)FileSystem::remove(directory, FileSystem::RecursionMode::Allowed); };
+    auto cache = MUST(DiskCache::create(directory));
+
+    auto url = url_for("script.js"sv);
+    cache->store_entry(response_for(url, headers_with_cache_control("max-age=3600")));
+
+    EXPECT(!cache->open_entry("POST"sv, url, partition_key, {}).has_value());
+    EXPECT(!cache->open_entry("GET"sv, url, partition_key, headers_with_cache_control("no-cache")).has_value());
+
+    HTTP::HeaderMap conditional_request_headers;
+    conditional_request_headers.set("If-None-Match", "\"v1\"");
+    EXPECT(!cache->open_entry("GET"sv, url, partition_key, conditional_request_headers).has_value());
+
+    EXPECT(open_entry(*cache, url).has_value());
+}
+
+TEST_CASE(uncacheable_responses_are_not_stored)
+{
+    auto directory = create_cache_directory();
+    ScopeGuard remove_directory = [&] { (void)FileSystem::remove(directory, FileSystem::RecursionMode::Allowed); };
+
+    EXPECT(DiskCache::is_cacheable(200, headers_with_cache_control("max-age=3600")));
+    EXPECT(!DiskCache::is_cacheable(404, headers_with_cache_control("max-age=3600")));
+    EXPECT(!DiskCache::is_cacheable(200, headers_with_cache_control("no-store, max-age=3600")));
+
+    // NOTE: Responses that are stale as soon as they're stored are only worth storing if they can be revalidated.
+    EXPECT(!DiskCache::is_cacheable(200, headers_with_cache_control("no-cache")));
+    EXPECT(!DiskCache::is_cacheable(200, {}));
+
+    auto revalidatable_headers = headers_with_cache_control("no-cache");
+    revalidatable_headers.set("ETag", "\"v1\"");
+    EXPECT(DiskCache::is_cacheable(200, revalidatable_headers));
+
+    auto cookie_headers = headers_with_cache_control("max-age=3600");
+    cookie_headers.set("Set-Cookie", "name=value");
+    EXPECT(!DiskCache::is_cacheable(200, cookie_headers));
+
+    // NOTE: A response that was already stale when it arrived is dropped.
+    auto cache = MUST(DiskCache::create(directory));
+    auto url = url_for("script.js"sv);
+    cache->store_entry(response_for(url, headers_with_cache_control("max-age=60"), body, AK::Duration::from_seconds(120)));
+    EXPECT(!open_entry(*cache, url).has_value());
+    EXPECT_EQ(cache->statistics().bytes_stored, 0u);
+}
+
+TEST_CASE(entries_are_partitioned_by_site)
+{
+    auto directory = create_cache_directory();
+    ScopeGuard remove_directory = [&] { (void)FileSystem::remove(directory, FileSystem::RecursionMode::Allowed); };
+    auto cache = MUST(DiskCache::create(directory));
+
+    auto url = url_for("script.js"sv);
+    cache->store_entry(response_for(url, headers_with_cache_control("max-age=3600")));
+
+    EXPECT(!open_entry(*cache, url, "https://other.com https://other.com"sv).has_value());
+    EXPECT(!open_entry(*cache, url, "https://other.com https://example.com"sv).has_value());
+    EXPECT(open_entry(*cache, url).has_value());
+}
+
+TEST_CASE(entries_survive_a_restart)
+{
+    auto directory = create_cache_directory();
+    ScopeGuard remove_directory = [&] { (void)FileSystem::remove(directory, FileSystem::RecursionMode::Allowed); };
+
+    auto url = url_for("script.js"sv);
+    MUST(DiskCache::create(directory))->store_entry(response_for(url, headers_with_cache_control("max-age=3600")));
+
+    auto cache = MUST(DiskCache::create(directory));
+    auto response = open_entry(*cache, url);
+    EXPECT(response.has_value());
+    EXPECT_EQ(StringView { response->body->bytes() }, body);
+}
+
+TEST_CASE(age_includes_the_time_before_the_response_was_stored)
+{
+    auto directory = create_cache_directory();
+    ScopeGuard remove_directory = [&] { (void)FileSystem::remove(directory, FileSystem::RecursionMode::Allowed); };
+    auto cache = MUST(DiskCache::create(directory));
+
+    auto headers = headers_with_cache_control("max-age=3600");
+    headers.set("Age", "100");
+
+    auto url = url_for("script.js"sv);
+    cache->store_entry(response_for(url, move(headers), body, AK::Duration::from_seconds(20)));
+
+    // NOTE: The Age header sent by the server is replaced by the entry's current age.
+    auto response = open_entry(*cache, url);
+    EXPECT(response.has_value());
+    EXPECT_EQ(response->headers.get("Age").value(), "120"sv);
+    EXPECT_EQ(count_headers(response->headers, "Age"sv), 1u);
+}
+
+TEST_CASE(stale_entry_without_validator_is_removed)
+{
+    auto directory = create_cache_directory();
+    ScopeGuard remove_directory = [&] { (void)FileSystem::remove(directory, FileSystem::RecursionMode::Allowed); };
+    auto cache = MUST(DiskCache::create(directory));
+
+    auto url = url_for("script.js"sv);
+    cache->store_entry(response_for(url, headers_with_cache_control("max-age=1")));
+    EXPECT(open_entry(*cache, url).has_value());
+
+    MUST(Core::System::sleep_ms(1100));
+
+    EXPECT(!open_entry(*cache, url).has_value());
+
+    // NOTE: The entry was removed from disk too, so it doesn't come back after a restart.
+    cache = MUST(DiskCache::create(directory));
+    EXPECT(!open_entry(*cache, url).has_value());
+}
+
+TEST_CASE(stale_entry_is_revalidated)
+{
+    auto directory = create_cache_directory();
+    ScopeGuard remove_directory = [&] { (void)FileSystem::remove(directory, FileSystem::RecursionMode::Allowed); };
+    auto cache = MUST(DiskCache::create(directory));
+
+    auto headers = headers_with_cache_control("no-cache");
+    headers.set("ETag", "\"v1\"");
+    headers.set("Last-Modified", "Wed, 21 Oct 2015 07:28:00 GMT");
+
+    auto url = url_for("script.js"sv);
+    cache->store_entry(response_for(url, move(headers)));
+
+    auto response = open_entry(*cache, url);
+    EXPECT(response.has_value());
+    EXPECT(response->revalidation_headers.has_value());
+    EXPECT_EQ(response->revalidation_headers->get("If-None-Match").value(), "\"v1\""sv);
+    EXPECT_EQ(response->revalidation_headers->get("If-Modified-Since").value(), "Wed, 21 Oct 2015 07:28:00 GMT"sv);
+    EXPECT_EQ(cache->statistics().hits, 0u);
+
+    auto not_modified_headers = headers_with_cache_control("max-age=3600");
+    not_modified_headers.set("ETag", "\"v1\"");
+    not_modified_headers.set("Content-Length", "0");
+
+    auto now = UnixDateTime::now();
+    EXPECT(cache->revalidate_entry(*response, url, partition_key, 304, not_modified_headers, now, now));
+    EXPECT(!response->revalidation_headers.has_value());
+    EXPECT_EQ(StringView { response->body->bytes() }, body);
+    EXPECT_EQ(response->headers.get("Cache-Control").value(), "max-age=3600"sv);
+    EXPECT_EQ(response->headers.get("Last-Modified").value(), "Wed, 21 Oct 2015 07:28:00 GMT"sv);
+    EXPECT(!response->headers.contains("Content-Length"));
+    EXPECT_EQ(count_headers(response->headers, "Cache-Control"sv), 1u);
+    EXPECT_EQ(cache->statistics().hits, 1u);
+
+    // NOTE: The 304 made the entry fresh again.
+    response = open_entry(*cache, url);
+    EXPECT(response.has_value());
+    EXPECT(!response->revalidation_headers.has_value());
+    EXPECT_EQ(response->headers.get("Cache-Control").value(), "max-age=3600"sv);
+    EXPECT_EQ(cache->statistics().hits, 2u);
+}
+
+TEST_CASE(full_response_to_revalidation_replaces_entry)
+{
+    auto directory = create_cache_directory();
+    ScopeGuard remove_directory = [&] { (void)FileSystem::remove(directory, FileSystem::RecursionMode::Allowed); };
+    auto cache = MUST(DiskCache::create(directory));
+
+    auto headers = headers_with_cache_control("no-cache");
+    headers.set("ETag", "\"v1\"");
+
+    auto url = url_for("script.js"sv);
+    cache->store_entry(response_for(url, move(headers)));
+
+    auto response = open_entry(*cache, url);
+    EXPECT(response.has_value());
+
+    auto now = UnixDateTime::now();
+    EXPECT(!cache->revalidate_entry(*response, url, partition_key, 200, headers_with_cache_control("max-age=3600"), now, now));
+    EXPECT(!open_entry(*cache, url).has_value());
+}
+
+TEST_CASE(least_recently_used_entries_are_evicted)
+{
+    auto directory = create_cache_directory();
+    ScopeGuard remove_directory = [&] { (void)FileSystem::remove(directory, FileSystem::RecursionMode::Allowed); };
+    auto cache = MUST(DiskCache::create(directory, 3 * body.length()));
+
+    auto first = url_for("first.js"sv);
+    auto second = url_for("second.js"sv);
+    auto third = url_for("third.js"sv);
+    auto fourth = url_for("fourth.js"sv);
+
+    // NOTE: Access times are compared, so make sure each step happens at a later time than the one before.
+    auto store = [&](URL::URL const& url) {
+        cache->store_entry(response_for(url, headers_with_cache_control("max-age=3600")));
+        MUST(Core::System::sleep_ms(10));
+    };
+
+    store(first);
+    store(second);
+    store(third);
+    EXPECT(open_entry(*cache, first).has_value());
+    MUST(Core::System::sleep_ms(10));
+    store(fourth);
+
+    EXPECT(!open_entry(*cache, second).has_value());
+    EXPECT(open_entry(*cache, first).has_value());
+    EXPECT(open_entry(*cache, third).has_value());
+    EXPECT(open_entry(*cache, fourth).has_value());
+}
+
+TEST_CASE(access_order_survives_a_restart)
+{
+    auto directory = create_cache_directory();
+    ScopeGuard remove_directory = [&] { (void)FileSystem::remove(directory, FileSystem::RecursionMode::Allowed); };
+
+    auto first = url_for("first.js"sv);
+    auto second = url_for("second.js"sv);
+
+    // NOTE: The order is recovered from file modification times, which may only have a resolution of one second.
+    {
+        auto cache = MUST(DiskCache::create(directory));
+        cache->store_entry(response_for(first, headers_with_cache_control("max-age=3600")));
+        MUST(Core::System::sleep_ms(1100));
+        cache->store_entry(response_for(second, headers_with_cache_control("max-age=3600")));
+        MUST(Core::System::sleep_ms(1100));
+        EXPECT(open_entry(*cache, first).has_value());
+    }
+
+    auto cache = MUST(DiskCache::create(directory, body.length()));
+    EXPECT(open_entry(*cache, first).has_value());
+    EXPECT(!open_entry(*cache, second).has_value());
+}
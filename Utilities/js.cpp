@@ -222,7 +222,8 @@ static ErrorOr<bool> parse_and_run(JS::Realm& realm, StringView source, StringVi
     };
 
     if (!s_as_module) {
-        auto script_or_error = JS::Script::parse(source, realm, source_name);
+        // NOTE: Everything run here comes from the command line, so it can all share a single cache partition.
+        auto script_or_error = JS::Script::parse(source, realm, source_name, nullptr, 1, ""sv);
         if (script_or_error.is_error()) {
             auto error = script_or_error.error()[0];
             auto hint = error.source_location_hint(source);
@@ -534,6 +535,9 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     bool disable_syntax_highlight = false;
     bool disable_debug_printing = false;
     bool use_test262_global = false;
+    bool dump_script_cache_statistics = false;
+    bool disable_bytecode_optimization = false;
+    size_t run_count = 1;
     StringView evaluate_script;
     Vector<StringView> script_paths;
 
@@ -541,6 +545,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     args_parser.set_general_help("This is a JavaScript interpreter.");
     args_parser.add_option(s_dump_ast, "Dump the AST", "dump-ast", 'A');
     args_parser.add_option(JS::Bytecode::g_dump_bytecode, "Dump the bytecode", "dump-bytecode", 'd');
+    args_parser.add_option(JS::Bytecode::g_dump_bytecode_instruction_counts, "Report the number of bytecode instructions in each function before and after optimization", "dump-bytecode-instruction-counts", {});
     args_parser.add_option(s_as_module, "Treat as module", "as-module", 'm');
     args_parser.add_option(s_print_last_result, "Print last result", "print-last-result", 'l');
     args_parser.add_option(s_strip_ansi, "Disable ANSI colors", "disable-ansi-colors", 'i');
@@ -550,11 +555,16 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     args_parser.add_option(disable_debug_printing, "Disable debug output", "disable-debug-output", {});
     args_parser.add_option(evaluate_script, "Evaluate argument as a script", "evaluate", 'c', "script");
     args_parser.add_option(use_test262_global, "Use test262 global ($262)", "use-test262-global", {});
+    args_parser.add_option(run_count, "Run the script this many times, each in a fresh realm", "repeat", {}, "count");
+    args_parser.add_option(dump_script_cache_statistics, "Report script cache hits and time saved", "dump-script-cache-statistics", {});
+    args_parser.add_option(disable_bytecode_optimization, "Run bytecode as generated, without optimization passes", "disable-bytecode-optimization", {});
     args_parser.add_positional_argument(script_paths, "Path to script files", "scripts", Core::ArgsParser::Required::No);
     args_parser.parse(arguments);
 
     bool syntax_highlight = !disable_syntax_highlight;
 
+    JS::Bytecode::g_optimize_bytecode = !disable_bytecode_optimization;
+
     AK::set_debug_enabled(!disable_debug_printing);
     s_history_path = TRY(String::formatted("{}/.js-history", Core::StandardPaths::home_directory()));
 
@@ -811,18 +821,6 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
         TRY(repl(realm));
         s_editor->save_history(s_history_path.to_byte_string());
     } else {
-        OwnPtr<JS::ExecutionContext> root_execution_context;
-        if (use_test262_global)
-            root_execution_context = JS::create_simple_execution_context<JS::Test262::GlobalObject>(*g_vm);
-        else
-            root_execution_context = JS::create_simple_execution_context<ScriptObject>(*g_vm);
-
-        auto& realm = *root_execution_context->realm;
-        auto& console_object = *realm.intrinsics().console_object();
-        ReplConsoleClient console_client(console_object.console());
-        console_object.console().set_client(console_client);
-        g_vm->heap().set_should_collect_on_every_allocation(gc_on_every_allocation);
-
         StringBuilder builder;
         StringView source_name;
 
@@ -852,10 +850,32 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
             source_name = "eval"sv;
         }
 
-        // We resolve modules as if it is the first file
+        // NOTE: Each run gets a fresh realm, as a page load would.
+        for (size_t run = 0; run < run_count; ++run) {
+            JS::RootExecutionContextScope root_execution_context {
+                *g_vm,
+                use_test262_global
+                    ? JS::create_simple_execution_context<JS::Test262::GlobalObject>(*g_vm)
+                    : JS::create_simple_execution_context<ScriptObject>(*g_vm),
+            };
+
+            auto& realm = root_execution_context.realm();
+            auto& console_object = *realm.intrinsics().console_object();
+            ReplConsoleClient console_client(console_object.console());
+            console_object.console().set_client(console_client);
+            g_vm->heap().set_should_collect_on_every_allocation(gc_on_every_allocation);
+
+            // We resolve modules as if it is the first file
 
-        if (!TRY(parse_and_run(realm, builder.string_view(), source_name)))
-            return 1;
+            if (!TRY(parse_and_run(realm, builder.string_view(), source_name)))
+                return 1;
+        }
+
+        if (dump_script_cache_statistics) {
+            auto const& statistics = g_vm->script_cache().statistics();
+            warnln("Script cache: {} hits, {} misses, {} evictions, {}ms saved",
+                statistics.hits, statistics.misses, statistics.evictions, statistics.time_saved.to_milliseconds());
+        }
     }
 
     return s_exit_code;
@@ -524,6 +524,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     bool export_all_imports = false;
     bool shell_mode = false;
     bool wasi = false;
+    bool disable_compilation = false;
     ByteString exported_function_to_execute;
     Vector<ParsedValue> values_to_push;
     Vector<ByteString> modules_to_link_in;
@@ -539,6 +540,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     parser.add_option(export_all_imports, "Export noop functions corresponding to imports", "export-noop");
     parser.add_option(shell_mode, "Launch a REPL in the module's context (implies -i)", "shell", 's');
     parser.add_option(wasi, "Enable WASI", "wasi", 'w');
+    parser.add_option(disable_compilation, "Run functions in the bytecode interpreter instead of compiling them first", "no-compile");
     parser.add_option(Core::ArgsParser::Option {
         .argument_mode = Core::ArgsParser::OptionArgumentMode::Required,
         .help_string = "Directory mappings to expose via WASI",
@@ -617,6 +619,9 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
 
     if (attempt_instantiate) {
         Wasm::AbstractMachine machine;
+        // NOTE: The debugger steps through the module's bytecode, which compiled functions don't run.
+        if (disable_compilation || debug)
+            machine.disable_function_compilation();
         Optional<Wasm::Wasi::Implementation> wasi_impl;
 
         if (wasi) {